@@ -2,5 +2,12 @@ dnl Function to detect if libexe dependencies are available
 AC_DEFUN([AX_LIBEXE_CHECK_LOCAL],
  [dnl Check for internationalization functions in libexe/libexe_i18n.c 
  AC_CHECK_FUNCS([bindtextdomain])
+
+ dnl Headers included in libexe/libexe_access_advice.c, libexe/libexe_advice_io_handle.c
+ dnl and libexe/libexe_direct_io_handle.c
+ AC_CHECK_HEADERS([errno.h fcntl.h unistd.h])
+
+ dnl Check for posix_fadvise in libexe/libexe_access_advice.c
+ AX_LIBCFILE_CHECK_FUNC_POSIX_FADVISE
  ])
 
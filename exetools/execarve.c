@@ -0,0 +1,338 @@
+/*
+ * Carves executables (EXE) embedded in raw data, such as disk or memory images
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exeoutput.h"
+#include "exetools_libcerror.h"
+#include "exetools_libclocale.h"
+#include "exetools_libcnotify.h"
+#include "exetools_libcstring.h"
+#include "exetools_libcsystem.h"
+#include "exetools_libexe.h"
+
+int execarve_abort = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use execarve to find executables (EXE) embedded in raw data,\n"
+	                 "such as a disk or memory image.\n\n" );
+
+	fprintf( stream, "Usage: execarve [ -t number_of_threads ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-t:     the number of threads used to scan the source\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for execarve
+ */
+void execarve_signal_handler(
+      libcsystem_signal_t signal LIBCSYSTEM_ATTRIBUTE_UNUSED )
+{
+	static char *function = "execarve_signal_handler";
+
+	LIBCSYSTEM_UNREFERENCED_PARAMETER( signal )
+
+	execarve_abort = 1;
+
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+	if( libcsystem_file_io_close(
+	     0 ) != 0 )
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* Prints an embedded executable
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int execarve_image_fprint(
+     off64_t image_offset,
+     size64_t image_size,
+     uint16_t target_architecture_type,
+     uint16_t characteristic_flags,
+     void *callback_data )
+{
+	FILE *stream = NULL;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	stream = (FILE *) callback_data;
+
+	fprintf(
+	 stream,
+	 "%" PRIi64 "\t0x%08" PRIx64 "\t%" PRIu64 "\t0x%04" PRIx16 "\t0x%04" PRIx16 "\t%s\n",
+	 image_offset,
+	 image_offset,
+	 image_size,
+	 target_architecture_type,
+	 characteristic_flags,
+	 ( ( characteristic_flags & LIBEXE_FILE_CHARACTERISTIC_FLAG_DLL ) != 0 ) ? "DLL" : "EXE" );
+
+	if( execarve_abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                                = NULL;
+	libcstring_system_character_t *option_number_of_threads = NULL;
+	libcstring_system_character_t *source                   = NULL;
+	char *program                                           = "execarve";
+	libcstring_system_integer_t option                      = 0;
+	size_t string_length                                    = 0;
+	uint64_t number_of_threads                              = 1;
+	int verbose                                             = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "exetools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( libcsystem_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize system values.\n" );
+
+		goto on_error;
+	}
+	exeoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _LIBCSTRING_SYSTEM_STRING( "ht:vV" ) ) ) != (libcstring_system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (libcstring_system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_LIBCSTRING_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (libcstring_system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (libcstring_system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (libcstring_system_integer_t) 'V':
+				exeoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_number_of_threads != NULL )
+	{
+		string_length = libcstring_system_string_length(
+		                 option_number_of_threads );
+
+		if( ( libcsystem_string_decimal_copy_to_64_bit(
+		       option_number_of_threads,
+		       string_length + 1,
+		       &number_of_threads,
+		       &error ) != 1 )
+		 || ( number_of_threads == 0 )
+		 || ( number_of_threads > (uint64_t) INT_MAX ) )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			number_of_threads = 1;
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %" PRIu64 ".\n",
+			 number_of_threads );
+		}
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libexe_notify_set_stream(
+	 stderr,
+	 NULL );
+	libexe_notify_set_verbose(
+	 verbose );
+
+	if( libcsystem_signal_attach(
+	     execarve_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "Embedded executables:\n" );
+
+	fprintf(
+	 stdout,
+	 "offset\t\toffset (hex)\tsize\ttarget\tflags\ttype\n" );
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libexe_carve_file_wide(
+	     source,
+	     (int) number_of_threads,
+	     &execarve_image_fprint,
+	     (void *) stdout,
+	     &error ) != 1 )
+#else
+	if( libexe_carve_file(
+	     source,
+	     (int) number_of_threads,
+	     &execarve_image_fprint,
+	     (void *) stdout,
+	     &error ) != 1 )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to carve: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( libcsystem_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( execarve_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -56,7 +56,7 @@ void usage_fprint(
 	fprintf( stream, "Use exeinfo to determine information about an executable\n"
 	                 "(EXE) file.\n\n" );
 
-	fprintf( stream, "Usage: exeinfo [ -c codepage ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: exeinfo [ -c codepage ] [ -hmvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -66,6 +66,9 @@ void usage_fprint(
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     source is a memory image, such as a dump of a loaded\n"
+	                 "\t        module, where the sections are stored at their virtual\n"
+	                 "\t        address\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -122,6 +125,7 @@ int main( int argc, char * const argv[] )
 	libcstring_system_character_t *source                = NULL;
 	char *program                                        = "exeinfo";
 	libcstring_system_integer_t option                   = 0;
+	int option_memory_image                              = 0;
 	int result                                           = 0;
 	int verbose                                          = 0;
 
@@ -158,7 +162,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "c:hvV" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "c:hmvV" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -185,6 +189,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'm':
+				option_memory_image = 1;
+
+				break;
+
 			case (libcstring_system_integer_t) 'v':
 				verbose = 1;
 
@@ -250,6 +259,10 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_memory_image != 0 )
+	{
+		exeinfo_info_handle->access_flags |= LIBEXE_ACCESS_FLAG_MEMORY_IMAGE;
+	}
 	if( info_handle_open_input(
 	     exeinfo_info_handle,
 	     source,
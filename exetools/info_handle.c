@@ -106,6 +106,7 @@ int info_handle_initialize(
 		goto on_error;
 	}
 	( *info_handle )->ascii_codepage = LIBEXE_CODEPAGE_WINDOWS_1252;
+	( *info_handle )->access_flags   = LIBEXE_OPEN_READ;
 	( *info_handle )->notify_stream  = INFO_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
@@ -293,13 +294,13 @@ int info_handle_open_input(
 	if( libexe_file_open_wide(
 	     info_handle->input_file,
 	     filename,
-	     LIBEXE_OPEN_READ,
+	     info_handle->access_flags,
 	     error ) != 1 )
 #else
 	if( libexe_file_open(
 	     info_handle->input_file,
 	     filename,
-	     LIBEXE_OPEN_READ,
+	     info_handle->access_flags,
 	     error ) != 1 )
 #endif
 	{
@@ -365,6 +366,7 @@ int info_handle_file_fprint(
 	off64_t start_offset      = 0;
 	size64_t size             = 0;
 	uint32_t virtual_address  = 0;
+	int number_of_functions   = 0;
 	int number_of_sections    = 0;
 	int section_index         = 0;
 
@@ -393,6 +395,20 @@ int info_handle_file_fprint(
 
 		goto on_error;
 	}
+	if( libexe_file_get_number_of_functions(
+	     info_handle->input_file,
+	     &number_of_functions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of functions.",
+		 function );
+
+		goto on_error;
+	}
 	fprintf(
 	 info_handle->notify_stream,
 	 "Executable (EXE) information:\n" );
@@ -404,6 +420,14 @@ int info_handle_file_fprint(
 	 "\tNumber of sections\t: %d\n",
 	 number_of_sections );
 
+	if( number_of_functions > 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of functions\t: %d\n",
+		 number_of_functions );
+	}
+
 	fprintf(
 	 info_handle->notify_stream,
 	 "\n" );
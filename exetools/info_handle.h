@@ -46,6 +46,10 @@ struct info_handle
 	 */
 	int ascii_codepage;
 
+	/* The access flags used to open the input
+	 */
+	int access_flags;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -0,0 +1,58 @@
+/*
+ * The certificate table definition of an executable (EXE) file
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_CERTIFICATE_TABLE_H )
+#define _EXE_CERTIFICATE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct exe_certificate_table_entry_header exe_certificate_table_entry_header_t;
+
+struct exe_certificate_table_entry_header
+{
+	/* The size
+	 * Consists of 4 bytes
+	 * Contains the size of the entry including the header
+	 */
+	uint8_t size[ 4 ];
+
+	/* The revision
+	 * Consists of 2 bytes
+	 */
+	uint8_t revision[ 2 ];
+
+	/* The certificate type
+	 * Consists of 2 bytes
+	 */
+	uint8_t certificate_type[ 2 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
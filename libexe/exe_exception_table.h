@@ -0,0 +1,77 @@
+/*
+ * The exception table definition of an executable (EXE) file
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_EXCEPTION_TABLE_H )
+#define _EXE_EXCEPTION_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct exe_exception_table_entry exe_exception_table_entry_t;
+
+struct exe_exception_table_entry
+{
+	/* The begin address
+	 * Consists of 4 bytes
+	 * Contains a RVA
+	 */
+	uint8_t begin_address[ 4 ];
+
+	/* The end address
+	 * Consists of 4 bytes
+	 * Contains a RVA
+	 */
+	uint8_t end_address[ 4 ];
+
+	/* The unwind information address
+	 * Consists of 4 bytes
+	 * Contains a RVA
+	 */
+	uint8_t unwind_information_address[ 4 ];
+};
+
+typedef struct exe_exception_table_entry_arm exe_exception_table_entry_arm_t;
+
+struct exe_exception_table_entry_arm
+{
+	/* The begin address
+	 * Consists of 4 bytes
+	 * Contains a RVA
+	 */
+	uint8_t begin_address[ 4 ];
+
+	/* The unwind data
+	 * Consists of 4 bytes
+	 * Contains either packed unwind data or the RVA of the unwind information
+	 */
+	uint8_t unwind_data[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -240,17 +240,17 @@ struct exe_coff_optional_header
 	 * Consists of 4 bytes
 	 */
 	uint8_t code_base_offset[ 4 ];
-
-	/* The data base offset
-	 * Consists of 4 bytes
-	 */
-	uint8_t data_base_offset[ 4 ];
 };
 
 typedef struct exe_coff_optional_header_pe32 exe_coff_optional_header_pe32_t;
 
 struct exe_coff_optional_header_pe32
 {
+	/* The data base offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_base_offset[ 4 ];
+
 	/* The image base offset
 	 * Consists of 4 bytes
 	 */
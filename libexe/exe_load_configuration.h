@@ -0,0 +1,587 @@
+/*
+ * The load configuration directory definition of an executable (EXE) file
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_LOAD_CONFIGURATION_H )
+#define _EXE_LOAD_CONFIGURATION_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct exe_load_configuration_directory32 exe_load_configuration_directory32_t;
+
+struct exe_load_configuration_directory32
+{
+	/* The size
+	 * Consists of 4 bytes
+	 * Contains the size of the structure in bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The creation time
+	 * Consists of 4 bytes
+	 * Contains a POSIX timestamp
+	 */
+	uint8_t creation_time[ 4 ];
+
+	/* The major version
+	 * Consists of 2 bytes
+	 */
+	uint8_t major_version[ 2 ];
+
+	/* The minor version
+	 * Consists of 2 bytes
+	 */
+	uint8_t minor_version[ 2 ];
+
+	/* The global flags to clear
+	 * Consists of 4 bytes
+	 */
+	uint8_t global_flags_clear[ 4 ];
+
+	/* The global flags to set
+	 * Consists of 4 bytes
+	 */
+	uint8_t global_flags_set[ 4 ];
+
+	/* The critical section default timeout
+	 * Consists of 4 bytes
+	 */
+	uint8_t critical_section_default_timeout[ 4 ];
+
+	/* The de-commit free block threshold
+	 * Consists of 4 bytes
+	 */
+	uint8_t de_commit_free_block_threshold[ 4 ];
+
+	/* The de-commit total free threshold
+	 * Consists of 4 bytes
+	 */
+	uint8_t de_commit_total_free_threshold[ 4 ];
+
+	/* The lock prefix table
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t lock_prefix_table[ 4 ];
+
+	/* The maximum allocation size
+	 * Consists of 4 bytes
+	 */
+	uint8_t maximum_allocation_size[ 4 ];
+
+	/* The virtual memory threshold
+	 * Consists of 4 bytes
+	 */
+	uint8_t virtual_memory_threshold[ 4 ];
+
+	/* The process heap flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t process_heap_flags[ 4 ];
+
+	/* The process affinity mask
+	 * Consists of 4 bytes
+	 */
+	uint8_t process_affinity_mask[ 4 ];
+
+	/* The CSD version
+	 * Consists of 2 bytes
+	 */
+	uint8_t csd_version[ 2 ];
+
+	/* The dependent load flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t dependent_load_flags[ 2 ];
+
+	/* The edit list
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t edit_list[ 4 ];
+
+	/* The security cookie
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t security_cookie[ 4 ];
+
+	/* The SE handler table
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t se_handler_table[ 4 ];
+
+	/* The SE handler count
+	 * Consists of 4 bytes
+	 */
+	uint8_t se_handler_count[ 4 ];
+
+	/* The control flow guard check function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_cf_check_function_pointer[ 4 ];
+
+	/* The control flow guard dispatch function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_cf_dispatch_function_pointer[ 4 ];
+
+	/* The control flow guard function table
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_cf_function_table[ 4 ];
+
+	/* The control flow guard function count
+	 * Consists of 4 bytes
+	 */
+	uint8_t guard_cf_function_count[ 4 ];
+
+	/* The control flow guard flags
+	 * Consists of 4 bytes
+	 * The upper 4 bits contain the number of additional bytes per function table entry
+	 */
+	uint8_t guard_flags[ 4 ];
+
+	/* The code integrity
+	 * Consists of 12 bytes
+	 */
+	uint8_t code_integrity[ 12 ];
+
+	/* The control flow guard address taken IAT entry table
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_address_taken_iat_entry_table[ 4 ];
+
+	/* The control flow guard address taken IAT entry count
+	 * Consists of 4 bytes
+	 */
+	uint8_t guard_address_taken_iat_entry_count[ 4 ];
+
+	/* The control flow guard long jump target table
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_long_jump_target_table[ 4 ];
+
+	/* The control flow guard long jump target count
+	 * Consists of 4 bytes
+	 */
+	uint8_t guard_long_jump_target_count[ 4 ];
+
+	/* The dynamic value relocation table
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t dynamic_value_relocation_table[ 4 ];
+
+	/* The CHPE metadata pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t chpe_metadata_pointer[ 4 ];
+
+	/* The return flow guard failure routine
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_rf_failure_routine[ 4 ];
+
+	/* The return flow guard failure routine function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_rf_failure_routine_function_pointer[ 4 ];
+
+	/* The dynamic value relocation table offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t dynamic_value_relocation_table_offset[ 4 ];
+
+	/* The dynamic value relocation table section
+	 * Consists of 2 bytes
+	 */
+	uint8_t dynamic_value_relocation_table_section[ 2 ];
+
+	/* Unknown (reserved)
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown1[ 2 ];
+
+	/* The return flow guard verify stack pointer function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_rf_verify_stack_pointer_function_pointer[ 4 ];
+
+	/* The hot patch table offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t hot_patch_table_offset[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown2[ 4 ];
+
+	/* The enclave configuration pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t enclave_configuration_pointer[ 4 ];
+
+	/* The volatile metadata pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t volatile_metadata_pointer[ 4 ];
+
+	/* The exception handling continuation table
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_eh_continuation_table[ 4 ];
+
+	/* The exception handling continuation count
+	 * Consists of 4 bytes
+	 */
+	uint8_t guard_eh_continuation_count[ 4 ];
+
+	/* The extended flow guard check function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_xfg_check_function_pointer[ 4 ];
+
+	/* The extended flow guard dispatch function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_xfg_dispatch_function_pointer[ 4 ];
+
+	/* The extended flow guard table dispatch function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_xfg_table_dispatch_function_pointer[ 4 ];
+
+	/* The cast guard OS determined failure mode
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t cast_guard_os_determined_failure_mode[ 4 ];
+
+	/* The guard memcpy function pointer
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_memcpy_function_pointer[ 4 ];
+};
+
+typedef struct exe_load_configuration_directory64 exe_load_configuration_directory64_t;
+
+struct exe_load_configuration_directory64
+{
+	/* The size
+	 * Consists of 4 bytes
+	 * Contains the size of the structure in bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The creation time
+	 * Consists of 4 bytes
+	 * Contains a POSIX timestamp
+	 */
+	uint8_t creation_time[ 4 ];
+
+	/* The major version
+	 * Consists of 2 bytes
+	 */
+	uint8_t major_version[ 2 ];
+
+	/* The minor version
+	 * Consists of 2 bytes
+	 */
+	uint8_t minor_version[ 2 ];
+
+	/* The global flags to clear
+	 * Consists of 4 bytes
+	 */
+	uint8_t global_flags_clear[ 4 ];
+
+	/* The global flags to set
+	 * Consists of 4 bytes
+	 */
+	uint8_t global_flags_set[ 4 ];
+
+	/* The critical section default timeout
+	 * Consists of 4 bytes
+	 */
+	uint8_t critical_section_default_timeout[ 4 ];
+
+	/* The de-commit free block threshold
+	 * Consists of 8 bytes
+	 */
+	uint8_t de_commit_free_block_threshold[ 8 ];
+
+	/* The de-commit total free threshold
+	 * Consists of 8 bytes
+	 */
+	uint8_t de_commit_total_free_threshold[ 8 ];
+
+	/* The lock prefix table
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t lock_prefix_table[ 8 ];
+
+	/* The maximum allocation size
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_allocation_size[ 8 ];
+
+	/* The virtual memory threshold
+	 * Consists of 8 bytes
+	 */
+	uint8_t virtual_memory_threshold[ 8 ];
+
+	/* The process affinity mask
+	 * Consists of 8 bytes
+	 */
+	uint8_t process_affinity_mask[ 8 ];
+
+	/* The process heap flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t process_heap_flags[ 4 ];
+
+	/* The CSD version
+	 * Consists of 2 bytes
+	 */
+	uint8_t csd_version[ 2 ];
+
+	/* The dependent load flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t dependent_load_flags[ 2 ];
+
+	/* The edit list
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t edit_list[ 8 ];
+
+	/* The security cookie
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t security_cookie[ 8 ];
+
+	/* The SE handler table
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t se_handler_table[ 8 ];
+
+	/* The SE handler count
+	 * Consists of 8 bytes
+	 */
+	uint8_t se_handler_count[ 8 ];
+
+	/* The control flow guard check function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_cf_check_function_pointer[ 8 ];
+
+	/* The control flow guard dispatch function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_cf_dispatch_function_pointer[ 8 ];
+
+	/* The control flow guard function table
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_cf_function_table[ 8 ];
+
+	/* The control flow guard function count
+	 * Consists of 8 bytes
+	 */
+	uint8_t guard_cf_function_count[ 8 ];
+
+	/* The control flow guard flags
+	 * Consists of 4 bytes
+	 * The upper 4 bits contain the number of additional bytes per function table entry
+	 */
+	uint8_t guard_flags[ 4 ];
+
+	/* The code integrity
+	 * Consists of 12 bytes
+	 */
+	uint8_t code_integrity[ 12 ];
+
+	/* The control flow guard address taken IAT entry table
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_address_taken_iat_entry_table[ 8 ];
+
+	/* The control flow guard address taken IAT entry count
+	 * Consists of 8 bytes
+	 */
+	uint8_t guard_address_taken_iat_entry_count[ 8 ];
+
+	/* The control flow guard long jump target table
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_long_jump_target_table[ 8 ];
+
+	/* The control flow guard long jump target count
+	 * Consists of 8 bytes
+	 */
+	uint8_t guard_long_jump_target_count[ 8 ];
+
+	/* The dynamic value relocation table
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t dynamic_value_relocation_table[ 8 ];
+
+	/* The CHPE metadata pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t chpe_metadata_pointer[ 8 ];
+
+	/* The return flow guard failure routine
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_rf_failure_routine[ 8 ];
+
+	/* The return flow guard failure routine function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_rf_failure_routine_function_pointer[ 8 ];
+
+	/* The dynamic value relocation table offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t dynamic_value_relocation_table_offset[ 4 ];
+
+	/* The dynamic value relocation table section
+	 * Consists of 2 bytes
+	 */
+	uint8_t dynamic_value_relocation_table_section[ 2 ];
+
+	/* Unknown (reserved)
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown1[ 2 ];
+
+	/* The return flow guard verify stack pointer function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_rf_verify_stack_pointer_function_pointer[ 8 ];
+
+	/* The hot patch table offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t hot_patch_table_offset[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown2[ 4 ];
+
+	/* The enclave configuration pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t enclave_configuration_pointer[ 8 ];
+
+	/* The volatile metadata pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t volatile_metadata_pointer[ 8 ];
+
+	/* The exception handling continuation table
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_eh_continuation_table[ 8 ];
+
+	/* The exception handling continuation count
+	 * Consists of 8 bytes
+	 */
+	uint8_t guard_eh_continuation_count[ 8 ];
+
+	/* The extended flow guard check function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_xfg_check_function_pointer[ 8 ];
+
+	/* The extended flow guard dispatch function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_xfg_dispatch_function_pointer[ 8 ];
+
+	/* The extended flow guard table dispatch function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_xfg_table_dispatch_function_pointer[ 8 ];
+
+	/* The cast guard OS determined failure mode
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t cast_guard_os_determined_failure_mode[ 8 ];
+
+	/* The guard memcpy function pointer
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t guard_memcpy_function_pointer[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
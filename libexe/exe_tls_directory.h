@@ -0,0 +1,115 @@
+/*
+ * The thread local storage (TLS) directory definition of an executable (EXE) file
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_TLS_DIRECTORY_H )
+#define _EXE_TLS_DIRECTORY_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct exe_tls_directory32 exe_tls_directory32_t;
+
+struct exe_tls_directory32
+{
+	/* The raw data start address
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t raw_data_start_address[ 4 ];
+
+	/* The raw data end address
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t raw_data_end_address[ 4 ];
+
+	/* The index address
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t index_address[ 4 ];
+
+	/* The callbacks address
+	 * Consists of 4 bytes
+	 * Contains a VA
+	 */
+	uint8_t callbacks_address[ 4 ];
+
+	/* The size of zero fill
+	 * Consists of 4 bytes
+	 */
+	uint8_t size_of_zero_fill[ 4 ];
+
+	/* The characteristics
+	 * Consists of 4 bytes
+	 */
+	uint8_t characteristics[ 4 ];
+};
+
+typedef struct exe_tls_directory64 exe_tls_directory64_t;
+
+struct exe_tls_directory64
+{
+	/* The raw data start address
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t raw_data_start_address[ 8 ];
+
+	/* The raw data end address
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t raw_data_end_address[ 8 ];
+
+	/* The index address
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t index_address[ 8 ];
+
+	/* The callbacks address
+	 * Consists of 8 bytes
+	 * Contains a VA
+	 */
+	uint8_t callbacks_address[ 8 ];
+
+	/* The size of zero fill
+	 * Consists of 4 bytes
+	 */
+	uint8_t size_of_zero_fill[ 4 ];
+
+	/* The characteristics
+	 * Consists of 4 bytes
+	 */
+	uint8_t characteristics[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,97 @@
+/*
+ * The unwind information definition of an executable (EXE) file
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_UNWIND_INFORMATION_H )
+#define _EXE_UNWIND_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct exe_unwind_information_header exe_unwind_information_header_t;
+
+struct exe_unwind_information_header
+{
+	/* The version and flags
+	 * Consists of 1 byte
+	 * Contains the version in the lower 3 bits and the flags in the upper 5 bits
+	 */
+	uint8_t version_and_flags;
+
+	/* The prolog size
+	 * Consists of 1 byte
+	 */
+	uint8_t prolog_size;
+
+	/* The number of unwind codes
+	 * Consists of 1 byte
+	 */
+	uint8_t number_of_unwind_codes;
+
+	/* The frame register and offset
+	 * Consists of 1 byte
+	 * Contains the frame register in the lower 4 bits and the scaled frame offset in the upper 4 bits
+	 */
+	uint8_t frame_register_and_offset;
+
+	/* The unwind codes
+	 * Consists of 2 bytes per unwind code
+	 * The array is padded to an even number of unwind codes
+	 */
+
+	/* The exception handler address
+	 * Consists of 4 bytes
+	 * Contains a RVA
+	 * Only stored if the exception or termination handler flag is set
+	 */
+
+	/* The chained exception table entry
+	 * Consists of 12 bytes
+	 * Only stored if the chained information flag is set
+	 */
+};
+
+typedef struct exe_unwind_code exe_unwind_code_t;
+
+struct exe_unwind_code
+{
+	/* The code offset
+	 * Consists of 1 byte
+	 * Contains the offset of the end of the prolog instruction
+	 */
+	uint8_t code_offset;
+
+	/* The operation code and information
+	 * Consists of 1 byte
+	 * Contains the operation code in the lower 4 bits and the operation information in the upper 4 bits
+	 */
+	uint8_t operation_code_and_information;
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
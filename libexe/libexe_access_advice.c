@@ -0,0 +1,664 @@
+/*
+ * Access advice functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libexe_access_advice.h"
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+
+/* Creates access advice
+ * Make sure the value access_advice is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_initialize(
+     libexe_access_advice_t **access_advice,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_initialize";
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_advice != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access advice value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*access_advice = memory_allocate_structure(
+	                  libexe_access_advice_t );
+
+	if( *access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access advice.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *access_advice,
+	     0,
+	     sizeof( libexe_access_advice_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear access advice.",
+		 function );
+
+		goto on_error;
+	}
+	( *access_advice )->access_pattern = LIBEXE_ACCESS_PATTERN_NORMAL;
+	( *access_advice )->descriptor     = -1;
+
+	return( 1 );
+
+on_error:
+	if( *access_advice != NULL )
+	{
+		memory_free(
+		 *access_advice );
+
+		*access_advice = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees access advice
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_free(
+     libexe_access_advice_t **access_advice,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_free";
+	int result            = 1;
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_advice != NULL )
+	{
+		if( ( *access_advice )->descriptor != -1 )
+		{
+			if( libexe_access_advice_close(
+			     *access_advice,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close access advice.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *access_advice );
+
+		*access_advice = NULL;
+	}
+	return( result );
+}
+
+/* Sets the file descriptor used to pass advice to the operating system
+ * The descriptor must be the one the file IO handle reads from, since
+ * the access pattern advice applies to the reads of that descriptor.
+ * The descriptor is not closed by the access advice
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_set_descriptor(
+     libexe_access_advice_t *access_advice,
+     int descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_set_descriptor";
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_advice->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access advice - descriptor already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid descriptor value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	access_advice->descriptor = descriptor;
+
+	/* A size of 0 represents the remainder of the file
+	 */
+	if( libexe_access_advice_advise_access_pattern(
+	     access_advice,
+	     0,
+	     0,
+	     access_advice->access_pattern,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise access pattern.",
+		 function );
+
+		access_advice->descriptor = -1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the access advice
+ * If the access pattern is one-shot the cached data of the file is released
+ * This function must be called before the descriptor is closed by the file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_access_advice_close(
+     libexe_access_advice_t *access_advice,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_close";
+	int result            = 0;
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_advice->descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( access_advice->access_pattern == LIBEXE_ACCESS_PATTERN_ONE_SHOT )
+	{
+		/* A size of 0 represents the remainder of the file
+		 */
+		if( libexe_access_advice_advise_range(
+		     access_advice,
+		     0,
+		     0,
+		     LIBEXE_ACCESS_ADVICE_DONT_NEED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release cached data.",
+			 function );
+
+			result = -1;
+		}
+	}
+	access_advice->descriptor = -1;
+
+	return( result );
+}
+
+/* Retrieves the access pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_get_access_pattern(
+     libexe_access_advice_t *access_advice,
+     int *access_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_get_access_pattern";
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access pattern.",
+		 function );
+
+		return( -1 );
+	}
+	*access_pattern = access_advice->access_pattern;
+
+	return( 1 );
+}
+
+/* Sets the access pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_set_access_pattern(
+     libexe_access_advice_t *access_advice,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_set_access_pattern";
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_pattern != LIBEXE_ACCESS_PATTERN_NORMAL )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_SEQUENTIAL )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_RANDOM )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_ONE_SHOT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern: %d.",
+		 function,
+		 access_pattern );
+
+		return( -1 );
+	}
+	access_advice->access_pattern = access_pattern;
+
+	if( libexe_access_advice_advise_access_pattern(
+	     access_advice,
+	     0,
+	     0,
+	     access_pattern,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise access pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the buffer used to read the data of a pass over the file
+ * Sequential and one-shot access uses larger reads and random access smaller reads
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_get_read_buffer_size(
+     libexe_access_advice_t *access_advice,
+     size_t *read_buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_get_read_buffer_size";
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( access_advice->access_pattern )
+	{
+		case LIBEXE_ACCESS_PATTERN_SEQUENTIAL:
+		case LIBEXE_ACCESS_PATTERN_ONE_SHOT:
+			*read_buffer_size = LIBEXE_ACCESS_ADVICE_SEQUENTIAL_READ_BUFFER_SIZE;
+			break;
+
+		case LIBEXE_ACCESS_PATTERN_RANDOM:
+			*read_buffer_size = LIBEXE_ACCESS_ADVICE_RANDOM_READ_BUFFER_SIZE;
+			break;
+
+		default:
+			*read_buffer_size = LIBEXE_ACCESS_ADVICE_READ_BUFFER_SIZE;
+			break;
+	}
+	return( 1 );
+}
+
+/* Passes advice about a range of the file to the operating system
+ * A size of 0 represents the remainder of the file
+ * The advice is ignored if not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_advise_range(
+     libexe_access_advice_t *access_advice,
+     off64_t offset,
+     size64_t size,
+     int advice,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_advise_range";
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( advice != LIBEXE_ACCESS_ADVICE_WILL_NEED )
+	 && ( advice != LIBEXE_ACCESS_ADVICE_DONT_NEED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported advice: %d.",
+		 function,
+		 advice );
+
+		return( -1 );
+	}
+	if( access_advice->descriptor == -1 )
+	{
+		return( 1 );
+	}
+#if defined( LIBEXE_HAVE_ACCESS_ADVICE )
+	/* The advice is a hint, failing to apply it is not considered an error
+	 */
+	if( advice == LIBEXE_ACCESS_ADVICE_WILL_NEED )
+	{
+		posix_fadvise(
+		 access_advice->descriptor,
+		 (off_t) offset,
+		 (off_t) size,
+		 POSIX_FADV_WILLNEED );
+	}
+	else
+	{
+		posix_fadvise(
+		 access_advice->descriptor,
+		 (off_t) offset,
+		 (off_t) size,
+		 POSIX_FADV_DONTNEED );
+	}
+#endif
+	return( 1 );
+}
+
+/* Passes the access pattern of a range of the file to the operating system
+ * Sequential and one-shot access enlarges the read-ahead and random access disables it
+ * A size of 0 represents the remainder of the file
+ * The advice is ignored if not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_advise_access_pattern(
+     libexe_access_advice_t *access_advice,
+     off64_t offset,
+     size64_t size,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_advise_access_pattern";
+
+#if defined( LIBEXE_HAVE_ACCESS_ADVICE )
+	int advice            = 0;
+#endif
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_pattern != LIBEXE_ACCESS_PATTERN_NORMAL )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_SEQUENTIAL )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_RANDOM )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_ONE_SHOT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern: %d.",
+		 function,
+		 access_pattern );
+
+		return( -1 );
+	}
+	if( access_advice->descriptor == -1 )
+	{
+		return( 1 );
+	}
+#if defined( LIBEXE_HAVE_ACCESS_ADVICE )
+	switch( access_pattern )
+	{
+		case LIBEXE_ACCESS_PATTERN_SEQUENTIAL:
+		case LIBEXE_ACCESS_PATTERN_ONE_SHOT:
+			advice = POSIX_FADV_SEQUENTIAL;
+			break;
+
+		case LIBEXE_ACCESS_PATTERN_RANDOM:
+			advice = POSIX_FADV_RANDOM;
+			break;
+
+		default:
+			advice = POSIX_FADV_NORMAL;
+			break;
+	}
+	/* The advice is a hint, failing to apply it is not considered an error
+	 */
+	posix_fadvise(
+	 access_advice->descriptor,
+	 (off_t) offset,
+	 (off_t) size,
+	 advice );
+#endif
+	return( 1 );
+}
+
+/* Passes advice after a read of a pass over the file
+ * For sequential and one-shot access the data following the read is requested
+ * in advance. For one-shot access the data that was read is released, so that a pass
+ * over a large file does not evict the cached data of other files
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_access_advice_read_completed(
+     libexe_access_advice_t *access_advice,
+     off64_t offset,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_access_advice_read_completed";
+
+	if( access_advice == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_advice->descriptor == -1 )
+	 || ( read_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( access_advice->access_pattern == LIBEXE_ACCESS_PATTERN_SEQUENTIAL )
+	 || ( access_advice->access_pattern == LIBEXE_ACCESS_PATTERN_ONE_SHOT ) )
+	{
+		if( libexe_access_advice_advise_range(
+		     access_advice,
+		     offset + (off64_t) read_size,
+		     (size64_t) read_size,
+		     LIBEXE_ACCESS_ADVICE_WILL_NEED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to request data in advance.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( access_advice->access_pattern == LIBEXE_ACCESS_PATTERN_ONE_SHOT )
+	{
+		if( libexe_access_advice_advise_range(
+		     access_advice,
+		     offset,
+		     (size64_t) read_size,
+		     LIBEXE_ACCESS_ADVICE_DONT_NEED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
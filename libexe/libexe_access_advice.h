@@ -0,0 +1,110 @@
+/*
+ * Access advice functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_ACCESS_ADVICE_H )
+#define _LIBEXE_ACCESS_ADVICE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI )
+#define LIBEXE_HAVE_ACCESS_ADVICE
+#endif
+
+typedef struct libexe_access_advice libexe_access_advice_t;
+
+struct libexe_access_advice
+{
+	/* The access pattern
+	 */
+	int access_pattern;
+
+	/* The file descriptor used to pass advice to the operating system
+	 * The descriptor is owned by the file IO handle
+	 * Contains -1 if not available
+	 */
+	int descriptor;
+};
+
+int libexe_access_advice_initialize(
+     libexe_access_advice_t **access_advice,
+     libcerror_error_t **error );
+
+int libexe_access_advice_free(
+     libexe_access_advice_t **access_advice,
+     libcerror_error_t **error );
+
+int libexe_access_advice_set_descriptor(
+     libexe_access_advice_t *access_advice,
+     int descriptor,
+     libcerror_error_t **error );
+
+int libexe_access_advice_close(
+     libexe_access_advice_t *access_advice,
+     libcerror_error_t **error );
+
+int libexe_access_advice_get_access_pattern(
+     libexe_access_advice_t *access_advice,
+     int *access_pattern,
+     libcerror_error_t **error );
+
+int libexe_access_advice_set_access_pattern(
+     libexe_access_advice_t *access_advice,
+     int access_pattern,
+     libcerror_error_t **error );
+
+int libexe_access_advice_get_read_buffer_size(
+     libexe_access_advice_t *access_advice,
+     size_t *read_buffer_size,
+     libcerror_error_t **error );
+
+int libexe_access_advice_advise_range(
+     libexe_access_advice_t *access_advice,
+     off64_t offset,
+     size64_t size,
+     int advice,
+     libcerror_error_t **error );
+
+int libexe_access_advice_advise_access_pattern(
+     libexe_access_advice_t *access_advice,
+     off64_t offset,
+     size64_t size,
+     int access_pattern,
+     libcerror_error_t **error );
+
+int libexe_access_advice_read_completed(
+     libexe_access_advice_t *access_advice,
+     off64_t offset,
+     size_t read_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_ACCESS_ADVICE_H ) */
+
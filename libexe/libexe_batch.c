@@ -0,0 +1,1059 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_batch.h"
+#include "libexe_definitions.h"
+#include "libexe_file.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+
+/* Opens the file of the thread arguments
+ * A file that cannot be opened is not considered an error, in which case the file is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_open_file(
+     libexe_batch_thread_arguments_t *thread_arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_open_file";
+	int result            = 0;
+
+	if( thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread arguments.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_arguments->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread arguments - file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_file_initialize(
+	     &( thread_arguments->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file: %d.",
+		 function,
+		 thread_arguments->file_index );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( thread_arguments->filename_wide != NULL )
+	{
+		result = libexe_file_open_wide(
+		          thread_arguments->file,
+		          thread_arguments->filename_wide,
+		          thread_arguments->access_flags,
+		          NULL );
+	}
+	else
+#endif
+	{
+		result = libexe_file_open(
+		          thread_arguments->file,
+		          thread_arguments->filename,
+		          thread_arguments->access_flags,
+		          NULL );
+	}
+	/* The error of a file that cannot be opened is not returned
+	 * since the other files of the batch are still processed
+	 */
+	if( result != 1 )
+	{
+		if( libexe_file_free(
+		     &( thread_arguments->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file: %d.",
+			 function,
+			 thread_arguments->file_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Opens files of the queue in a worker thread
+ * Every worker thread takes the next file of the queue when it has opened a file,
+ * as long as the number of files that are opened ahead of the file callback
+ * does not exceed the maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_queue_thread_callback(
+     void *arguments )
+{
+	libexe_batch_queue_t *queue = NULL;
+	int file_index              = 0;
+	int result                  = 0;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	queue = (libexe_batch_queue_t *) arguments;
+
+	while( 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     queue->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		while( ( queue->abort == 0 )
+		    && ( queue->next_file_index < queue->number_of_files )
+		    && ( queue->next_file_index >= ( queue->callback_file_index + queue->maximum_number_of_open_files ) ) )
+		{
+			if( libcthreads_condition_wait(
+			     queue->condition,
+			     queue->mutex,
+			     NULL ) != 1 )
+			{
+				libcthreads_mutex_release(
+				 queue->mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( ( queue->abort != 0 )
+		 || ( queue->next_file_index >= queue->number_of_files ) )
+		{
+			libcthreads_mutex_release(
+			 queue->mutex,
+			 NULL );
+
+			break;
+		}
+		file_index = queue->next_file_index;
+
+		queue->next_file_index += 1;
+
+		if( libcthreads_mutex_release(
+		     queue->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		result = libexe_batch_open_file(
+		          &( queue->thread_arguments[ file_index ] ),
+		          NULL );
+
+		if( libcthreads_mutex_grab(
+		     queue->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		queue->thread_arguments[ file_index ].result = result;
+
+		if( libcthreads_condition_broadcast(
+		     queue->condition,
+		     NULL ) != 1 )
+		{
+			libcthreads_mutex_release(
+			 queue->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libcthreads_mutex_release(
+		     queue->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Signals the worker threads that the file callback has processed a file
+ * or that no more files should be opened
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_queue_signal(
+     libexe_batch_queue_t *queue,
+     int callback_file_index,
+     uint8_t abort,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_queue_signal";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	queue->callback_file_index = callback_file_index;
+
+	if( abort != 0 )
+	{
+		queue->abort = abort;
+	}
+	if( libcthreads_condition_broadcast(
+	     queue->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 queue->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits until a worker thread has opened a specific file of the queue
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_queue_wait_for_file(
+     libexe_batch_queue_t *queue,
+     int file_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_queue_wait_for_file";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( file_index >= queue->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( queue->thread_arguments[ file_index ].result == 0 )
+	{
+		if( libcthreads_condition_wait(
+		     queue->condition,
+		     queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 queue->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Closes and frees the files of the thread arguments
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_free_files(
+     libexe_batch_thread_arguments_t *thread_arguments,
+     int number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_free_files";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread arguments.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_files;
+	     thread_index++ )
+	{
+		if( thread_arguments[ thread_index ].file == NULL )
+		{
+			continue;
+		}
+		if( libexe_file_close(
+		     thread_arguments[ thread_index ].file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file: %d.",
+			 function,
+			 thread_arguments[ thread_index ].file_index );
+
+			result = -1;
+		}
+		if( libexe_file_free(
+		     &( thread_arguments[ thread_index ].file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file: %d.",
+			 function,
+			 thread_arguments[ thread_index ].file_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Opens a batch of files
+ * The worker threads take the next file from a shared queue as soon as they have
+ * opened a file, which reads its headers, section table and data directories,
+ * so that the reads of multiple files are outstanding at the same time
+ * The opened files are passed to the file callback in order of file index
+ * and are closed and freed after the file callback returns
+ * Without multi-threading support or if the number of threads is 1 or less
+ * the files are opened in the calling thread
+ * The file callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_open_files(
+     const char **filenames,
+     const wchar_t **filenames_wide,
+     int number_of_files,
+     int number_of_threads,
+     int access_flags,
+     int (*file_callback)(
+            int file_index,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_batch_thread_arguments_t *thread_arguments = NULL;
+	static char *function                             = "libexe_batch_open_files";
+	int callback_result                               = 1;
+	int file_index                                    = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libexe_batch_queue_t queue;
+
+	libcthreads_thread_t **threads                    = NULL;
+	int number_of_created_threads                     = 0;
+	int thread_index                                  = 0;
+#endif
+
+	if( ( filenames == NULL )
+	 && ( filenames_wide == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( filenames_wide != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported wide filenames.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( number_of_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of files value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( memory_set(
+	     &queue,
+	     0,
+	     sizeof( libexe_batch_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads > LIBEXE_MAXIMUM_NUMBER_OF_BATCH_THREADS )
+	{
+		number_of_threads = LIBEXE_MAXIMUM_NUMBER_OF_BATCH_THREADS;
+	}
+	if( number_of_threads > number_of_files )
+	{
+		number_of_threads = number_of_files;
+	}
+	if( number_of_threads < 1 )
+	{
+		number_of_threads = 1;
+	}
+#else
+	number_of_threads = 1;
+#endif
+	/* Every file has its own thread arguments so that a worker thread can take
+	 * the next file while the file callback processes an earlier file
+	 */
+	thread_arguments = (libexe_batch_thread_arguments_t *) memory_allocate(
+	                                                        sizeof( libexe_batch_thread_arguments_t ) * number_of_files );
+
+	if( thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread arguments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     thread_arguments,
+	     0,
+	     sizeof( libexe_batch_thread_arguments_t ) * number_of_files ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread arguments.",
+		 function );
+
+		memory_free(
+		 thread_arguments );
+
+		thread_arguments = NULL;
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		thread_arguments[ file_index ].file_index   = file_index;
+		thread_arguments[ file_index ].access_flags = access_flags;
+
+		if( filenames != NULL )
+		{
+			thread_arguments[ file_index ].filename = filenames[ file_index ];
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		else
+		{
+			thread_arguments[ file_index ].filename_wide = filenames_wide[ file_index ];
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		queue.thread_arguments = thread_arguments;
+		queue.number_of_files  = number_of_files;
+
+		/* The number of files that are opened ahead of the file callback is limited
+		 * so that the number of open files does not depend on the size of the batch
+		 */
+		queue.maximum_number_of_open_files = number_of_threads * 2;
+
+		if( libcthreads_mutex_initialize(
+		     &( queue.mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( queue.condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create condition.",
+			 function );
+
+			goto on_error;
+		}
+		threads = (libcthreads_thread_t **) memory_allocate(
+		                                     sizeof( libcthreads_thread_t * ) * number_of_threads );
+
+		if( threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     threads,
+		     0,
+		     sizeof( libcthreads_thread_t * ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			memory_free(
+			 threads );
+
+			threads = NULL;
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( threads[ thread_index ] ),
+			     NULL,
+			     &libexe_batch_queue_thread_callback,
+			     (void *) &queue,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			number_of_created_threads++;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( file_index = 0;
+	     ( callback_result == 1 )
+	  && ( file_index < number_of_files );
+	     file_index++ )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( threads != NULL )
+		{
+			if( libexe_batch_queue_wait_for_file(
+			     &queue,
+			     file_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for file: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+		{
+			thread_arguments[ file_index ].result = libexe_batch_open_file(
+			                                         &( thread_arguments[ file_index ] ),
+			                                         error );
+		}
+		if( thread_arguments[ file_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to open file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		callback_result = file_callback(
+		                   file_index,
+		                   thread_arguments[ file_index ].file,
+		                   callback_data );
+
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: file callback failed for file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libexe_batch_free_files(
+		     &( thread_arguments[ file_index ] ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( threads != NULL )
+		{
+			if( libexe_batch_queue_signal(
+			     &queue,
+			     file_index + 1,
+			     (uint8_t) ( callback_result != 1 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal queue.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_created_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 threads );
+
+		threads = NULL;
+	}
+	if( queue.condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( queue.condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( queue.mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( queue.mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Free the files that were opened ahead of the file callback
+	 * when the file callback stopped the batch
+	 */
+	if( libexe_batch_free_files(
+	     thread_arguments,
+	     number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free files.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 thread_arguments );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( threads != NULL )
+	{
+		libexe_batch_queue_signal(
+		 &queue,
+		 queue.callback_file_index,
+		 1,
+		 NULL );
+
+		for( thread_index = 0;
+		     thread_index < number_of_created_threads;
+		     thread_index++ )
+		{
+			if( threads[ thread_index ] != NULL )
+			{
+				libcthreads_thread_join(
+				 &( threads[ thread_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 threads );
+	}
+	if( queue.condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( queue.condition ),
+		 NULL );
+	}
+	if( queue.mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( queue.mutex ),
+		 NULL );
+	}
+#endif
+	if( thread_arguments != NULL )
+	{
+		libexe_batch_free_files(
+		 thread_arguments,
+		 number_of_files,
+		 NULL );
+
+		memory_free(
+		 thread_arguments );
+	}
+	return( -1 );
+}
+
+/* Opens a batch of files using a pool of worker threads
+ * The worker threads take the next file from a shared queue as soon as they have
+ * opened a file, so that the blocking reads of multiple files are outstanding
+ * at the same time. No asynchronous IO interface, such as io_uring, is used
+ * The file callback is called from the calling thread for every file in order of
+ * file index with the opened file, or NULL if the file could not be opened.
+ * The file is closed and freed after the file callback returns
+ * Without multi-threading support or if the number of threads is 1 or less
+ * the files are opened in the calling thread
+ * The file callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_open_threaded(
+     const char **filenames,
+     int number_of_files,
+     int number_of_threads,
+     int access_flags,
+     int (*file_callback)(
+            int file_index,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_open_threaded";
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_batch_open_files(
+	     filenames,
+	     NULL,
+	     number_of_files,
+	     number_of_threads,
+	     access_flags,
+	     file_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to open batch of files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a batch of files using a pool of worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_open_threaded_wide(
+     const wchar_t **filenames,
+     int number_of_files,
+     int number_of_threads,
+     int access_flags,
+     int (*file_callback)(
+            int file_index,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_open_threaded_wide";
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_batch_open_files(
+	     NULL,
+	     filenames,
+	     number_of_files,
+	     number_of_threads,
+	     access_flags,
+	     file_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to open batch of files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
@@ -0,0 +1,184 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_BATCH_H )
+#define _LIBEXE_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_extern.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_batch_thread_arguments libexe_batch_thread_arguments_t;
+
+struct libexe_batch_thread_arguments
+{
+	/* The index of the file
+	 */
+	int file_index;
+
+	/* The filename, NULL if the wide filename is used
+	 */
+	const char *filename;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide filename, NULL if the narrow filename is used
+	 */
+	const wchar_t *filename_wide;
+#endif
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The file, NULL if the file could not be opened
+	 */
+	libexe_file_t *file;
+
+	/* The result, 0 while the file has not been opened
+	 */
+	int result;
+};
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libexe_batch_queue libexe_batch_queue_t;
+
+struct libexe_batch_queue
+{
+	/* The thread arguments of every file
+	 */
+	libexe_batch_thread_arguments_t *thread_arguments;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The index of the next file to open
+	 */
+	int next_file_index;
+
+	/* The index of the next file to pass to the file callback
+	 */
+	int callback_file_index;
+
+	/* The maximum number of files that are opened ahead of the file callback
+	 */
+	int maximum_number_of_open_files;
+
+	/* Value to indicate no more files should be opened
+	 */
+	uint8_t abort;
+
+	/* The mutex that protects the queue
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a file was opened or passed to the file callback
+	 */
+	libcthreads_condition_t *condition;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libexe_batch_open_file(
+     libexe_batch_thread_arguments_t *thread_arguments,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libexe_batch_queue_thread_callback(
+     void *arguments );
+
+int libexe_batch_queue_signal(
+     libexe_batch_queue_t *queue,
+     int callback_file_index,
+     uint8_t abort,
+     libcerror_error_t **error );
+
+int libexe_batch_queue_wait_for_file(
+     libexe_batch_queue_t *queue,
+     int file_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libexe_batch_free_files(
+     libexe_batch_thread_arguments_t *thread_arguments,
+     int number_of_files,
+     libcerror_error_t **error );
+
+int libexe_batch_open_files(
+     const char **filenames,
+     const wchar_t **filenames_wide,
+     int number_of_files,
+     int number_of_threads,
+     int access_flags,
+     int (*file_callback)(
+            int file_index,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_batch_open_threaded(
+     const char **filenames,
+     int number_of_files,
+     int number_of_threads,
+     int access_flags,
+     int (*file_callback)(
+            int file_index,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEXE_EXTERN \
+int libexe_batch_open_threaded_wide(
+     const wchar_t **filenames,
+     int number_of_files,
+     int number_of_threads,
+     int access_flags,
+     int (*file_callback)(
+            int file_index,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_BATCH_H ) */
+
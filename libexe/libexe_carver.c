@@ -0,0 +1,1546 @@
+/*
+ * Embedded executable carver functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_carver.h"
+#include "libexe_definitions.h"
+#include "libexe_io_handle.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcstring.h"
+#include "libexe_libcthreads.h"
+
+#include "exe_file_header.h"
+#include "exe_section_table.h"
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEXE_CARVER_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Searches the data for the next MZ signature
+ * The signature is searched for at the offsets from search offset up to search end offset
+ * Returns the offset of the signature or search end offset if not found
+ */
+size_t libexe_carver_find_signature(
+        const uint8_t *data,
+        size_t data_size,
+        size_t search_offset,
+        size_t search_end_offset )
+{
+#if defined( LIBEXE_CARVER_HAVE_SSE2 )
+	__m128i first_byte_values  = _mm_set1_epi8( exe_mz_signature[ 0 ] );
+	__m128i second_byte_values = _mm_set1_epi8( exe_mz_signature[ 1 ] );
+	__m128i matches            = _mm_setzero_si128();
+	int matches_mask           = 0;
+#endif
+	size_t last_offset         = 0;
+
+	if( ( data == NULL )
+	 || ( data_size < 2 ) )
+	{
+		return( search_end_offset );
+	}
+	/* The second byte of the signature must be in the data
+	 */
+	last_offset = data_size - 1;
+
+	if( last_offset > search_end_offset )
+	{
+		last_offset = search_end_offset;
+	}
+#if defined( LIBEXE_CARVER_HAVE_SSE2 )
+	/* Compare 16 offsets at once, the first and second signature bytes
+	 * are compared with the data at the offsets and the next offsets
+	 */
+	while( ( search_offset + 16 ) <= last_offset )
+	{
+		matches = _mm_and_si128(
+		           _mm_cmpeq_epi8(
+		            _mm_loadu_si128(
+		             (__m128i *) &( data[ search_offset ] ) ),
+		            first_byte_values ),
+		           _mm_cmpeq_epi8(
+		            _mm_loadu_si128(
+		             (__m128i *) &( data[ search_offset + 1 ] ) ),
+		            second_byte_values ) );
+
+		matches_mask = _mm_movemask_epi8(
+		                matches );
+
+		if( matches_mask != 0 )
+		{
+			while( ( matches_mask & 1 ) == 0 )
+			{
+				matches_mask >>= 1;
+
+				search_offset++;
+			}
+			return( search_offset );
+		}
+		search_offset += 16;
+	}
+#endif /* defined( LIBEXE_CARVER_HAVE_SSE2 ) */
+
+	while( search_offset < last_offset )
+	{
+		if( ( data[ search_offset ] == (uint8_t) exe_mz_signature[ 0 ] )
+		 && ( data[ search_offset + 1 ] == (uint8_t) exe_mz_signature[ 1 ] ) )
+		{
+			return( search_offset );
+		}
+		search_offset++;
+	}
+	return( search_end_offset );
+}
+
+/* Reads the headers of an embedded executable
+ * The data must start with the MZ header, remaining data size contains the size
+ * of the data from the start of the MZ header up to the end of all data
+ * The image size is determined from the headers, the section table and the certificate table
+ * and is limited to the remaining data size
+ * Returns 1 if successful, 0 if the data does not contain a supported executable or -1 on error
+ */
+int libexe_carver_read_image_headers(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t remaining_data_size,
+     libexe_carver_image_t *image,
+     libcerror_error_t **error )
+{
+	exe_coff_header_t *coff_header                                       = NULL;
+	exe_coff_optional_header_t *coff_optional_header                     = NULL;
+	exe_coff_optional_header_pe32_t *coff_optional_header_pe32           = NULL;
+	exe_coff_optional_header_pe32_plus_t *coff_optional_header_pe32_plus = NULL;
+	exe_coff_optional_header_data_directories_t *data_directories        = NULL;
+	exe_mz_header_t *mz_header                                           = NULL;
+	exe_section_table_entry_t *section_table_entry                       = NULL;
+	static char *function                                                = "libexe_carver_read_image_headers";
+	size64_t image_size                                                  = 0;
+	size_t coff_header_offset                                            = 0;
+	size_t data_directories_offset                                       = 0;
+	size_t optional_header_offset                                        = 0;
+	size_t section_table_offset                                          = 0;
+	size_t section_table_size                                            = 0;
+	uint32_t certificate_table_offset                                    = 0;
+	uint32_t certificate_table_size                                      = 0;
+	uint32_t extended_header_offset                                      = 0;
+	uint32_t file_alignment_size                                         = 0;
+	uint32_t headers_size                                                = 0;
+	uint32_t number_of_data_directories_entries                          = 0;
+	uint32_t section_alignment_size                                      = 0;
+	uint32_t section_data_offset                                         = 0;
+	uint32_t section_data_size                                           = 0;
+	uint16_t characteristic_flags                                        = 0;
+	uint16_t number_of_sections                                          = 0;
+	uint16_t optional_header_size                                        = 0;
+	uint16_t relocation_table_offset                                     = 0;
+	uint16_t section_index                                               = 0;
+	uint16_t signature                                                   = 0;
+	uint16_t target_architecture_type                                    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( image == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image.",
+		 function );
+
+		return( -1 );
+	}
+	/* The cheap checks first: the MZ header, the extended header offset and the PE signature
+	 */
+	if( data_size < sizeof( exe_mz_header_t ) )
+	{
+		return( 0 );
+	}
+	mz_header = (exe_mz_header_t *) data;
+
+	if( memory_compare(
+	     mz_header->signature,
+	     exe_mz_signature,
+	     2 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 mz_header->relocation_table_offset,
+	 relocation_table_offset );
+
+	/* The extended header offset is only used if the relocation table offset is 0x40 or more
+	 * as in libexe_io_handle_read_mz_header
+	 */
+	if( relocation_table_offset < 0x40 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 mz_header->extended_header_offset,
+	 extended_header_offset );
+
+	if( ( extended_header_offset == 0 )
+	 || ( extended_header_offset > LIBEXE_CARVER_MAXIMUM_EXTENDED_HEADER_OFFSET ) )
+	{
+		return( 0 );
+	}
+	coff_header_offset = (size_t) extended_header_offset + sizeof( exe_pe_header_t );
+
+	if( ( coff_header_offset + sizeof( exe_coff_header_t ) ) > data_size )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     &( data[ extended_header_offset ] ),
+	     exe_pe_signature,
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	/* The COFF header, optional header and section table
+	 */
+	coff_header = (exe_coff_header_t *) &( data[ coff_header_offset ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->target_architecture_type,
+	 target_architecture_type );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->number_of_sections,
+	 number_of_sections );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->optional_header_size,
+	 optional_header_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->characteristic_flags,
+	 characteristic_flags );
+
+	if( ( number_of_sections == 0 )
+	 || ( number_of_sections > LIBEXE_CARVER_MAXIMUM_NUMBER_OF_SECTIONS ) )
+	{
+		return( 0 );
+	}
+	if( ( characteristic_flags & LIBEXE_FILE_CHARACTERISTIC_FLAG_EXECUTABLE_IMAGE ) == 0 )
+	{
+		return( 0 );
+	}
+	if( (size_t) optional_header_size < sizeof( exe_coff_optional_header_t ) )
+	{
+		return( 0 );
+	}
+	optional_header_offset = coff_header_offset + sizeof( exe_coff_header_t );
+	section_table_offset   = optional_header_offset + optional_header_size;
+	section_table_size   = sizeof( exe_section_table_entry_t ) * number_of_sections;
+
+	if( ( section_table_offset + section_table_size ) > data_size )
+	{
+		return( 0 );
+	}
+	coff_optional_header = (exe_coff_optional_header_t *) &( data[ optional_header_offset ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_optional_header->signature,
+	 signature );
+
+	if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	{
+		data_directories_offset = sizeof( exe_coff_optional_header_t ) + sizeof( exe_coff_optional_header_pe32_t );
+
+		if( (size_t) optional_header_size < data_directories_offset )
+		{
+			return( 0 );
+		}
+		coff_optional_header_pe32 = (exe_coff_optional_header_pe32_t *) &( data[ optional_header_offset + sizeof( exe_coff_optional_header_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32->section_alignment_size,
+		 section_alignment_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32->file_alignment_size,
+		 file_alignment_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32->headers_size,
+		 headers_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32->number_of_data_directories_entries,
+		 number_of_data_directories_entries );
+	}
+	else if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	{
+		data_directories_offset = sizeof( exe_coff_optional_header_t ) + sizeof( exe_coff_optional_header_pe32_plus_t );
+
+		if( (size_t) optional_header_size < data_directories_offset )
+		{
+			return( 0 );
+		}
+		coff_optional_header_pe32_plus = (exe_coff_optional_header_pe32_plus_t *) &( data[ optional_header_offset + sizeof( exe_coff_optional_header_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32_plus->section_alignment_size,
+		 section_alignment_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32_plus->file_alignment_size,
+		 file_alignment_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32_plus->headers_size,
+		 headers_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 coff_optional_header_pe32_plus->number_of_data_directories_entries,
+		 number_of_data_directories_entries );
+	}
+	else
+	{
+		return( 0 );
+	}
+	/* The file alignment size must be a power of 2 and not exceed the section alignment size
+	 */
+	if( ( file_alignment_size == 0 )
+	 || ( ( file_alignment_size & ( file_alignment_size - 1 ) ) != 0 )
+	 || ( section_alignment_size < file_alignment_size ) )
+	{
+		return( 0 );
+	}
+	image_size = (size64_t) section_table_offset + section_table_size;
+
+	if( (size64_t) headers_size > image_size )
+	{
+		image_size = (size64_t) headers_size;
+	}
+	section_table_entry = (exe_section_table_entry_t *) &( data[ section_table_offset ] );
+
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 section_table_entry->data_offset,
+		 section_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 section_table_entry->data_size,
+		 section_data_size );
+
+		if( section_data_size > 0 )
+		{
+			if( ( (size64_t) section_data_offset + section_data_size ) > image_size )
+			{
+				image_size = (size64_t) section_data_offset + section_data_size;
+			}
+		}
+		section_table_entry++;
+	}
+	/* The certificate table is stored after the sections and is referenced by file offset
+	 */
+	if( ( number_of_data_directories_entries >= 5 )
+	 && ( (size_t) optional_header_size >= ( data_directories_offset + 40 ) ) )
+	{
+		data_directories = (exe_coff_optional_header_data_directories_t *) &( data[ optional_header_offset + data_directories_offset ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 data_directories->certificate_table_rva,
+		 certificate_table_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 data_directories->certificate_table_size,
+		 certificate_table_size );
+
+		if( ( certificate_table_offset != 0 )
+		 && ( certificate_table_size != 0 ) )
+		{
+			if( ( (size64_t) certificate_table_offset + certificate_table_size ) > image_size )
+			{
+				image_size = (size64_t) certificate_table_offset + certificate_table_size;
+			}
+		}
+	}
+	if( image_size > remaining_data_size )
+	{
+		image_size = remaining_data_size;
+	}
+	image->size                     = image_size;
+	image->target_architecture_type = target_architecture_type;
+	image->characteristic_flags     = characteristic_flags;
+
+	return( 1 );
+}
+
+/* Scans a chunk for embedded executables
+ * The images found are stored in the thread arguments
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carver_scan_chunk(
+     libexe_carver_thread_arguments_t *thread_arguments,
+     libcerror_error_t **error )
+{
+	libexe_carver_image_t image;
+
+	const uint8_t *chunk_data      = NULL;
+	static char *function          = "libexe_carver_scan_chunk";
+	void *reallocation             = NULL;
+	size64_t remaining_data_size   = 0;
+	size_t read_size               = 0;
+	size_t search_offset           = 0;
+	ssize_t read_count             = 0;
+	int number_of_allocated_images = 0;
+	int result                     = 0;
+
+	if( thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread arguments.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( thread_arguments->chunk_offset < 0 )
+	 || ( (size64_t) thread_arguments->chunk_offset >= thread_arguments->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread arguments - chunk offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_arguments->chunk_size > (size_t) LIBEXE_CARVER_CHUNK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread arguments - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_data_size = thread_arguments->data_size - thread_arguments->chunk_offset;
+
+	read_size = thread_arguments->chunk_size + LIBEXE_CARVER_HEADERS_MAXIMUM_SIZE;
+
+	if( (size64_t) read_size > remaining_data_size )
+	{
+		read_size = (size_t) remaining_data_size;
+	}
+	if( thread_arguments->data != NULL )
+	{
+		chunk_data = &( thread_arguments->data[ thread_arguments->chunk_offset ] );
+	}
+	else
+	{
+		if( thread_arguments->chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid thread arguments - missing chunk data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_handle_seek_offset(
+		     thread_arguments->file_io_handle,
+		     thread_arguments->chunk_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek chunk offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 thread_arguments->chunk_offset,
+			 thread_arguments->chunk_offset );
+
+			return( -1 );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              thread_arguments->file_io_handle,
+		              thread_arguments->chunk_data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk data.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_data = thread_arguments->chunk_data;
+	}
+	thread_arguments->number_of_images = 0;
+
+	while( search_offset < thread_arguments->chunk_size )
+	{
+		search_offset = libexe_carver_find_signature(
+		                 chunk_data,
+		                 read_size,
+		                 search_offset,
+		                 thread_arguments->chunk_size );
+
+		if( search_offset >= thread_arguments->chunk_size )
+		{
+			break;
+		}
+		result = libexe_carver_read_image_headers(
+		          &( chunk_data[ search_offset ] ),
+		          read_size - search_offset,
+		          remaining_data_size - search_offset,
+		          &image,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read image headers at offset: %" PRIzd ".",
+			 function,
+			 search_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( thread_arguments->number_of_images >= thread_arguments->number_of_allocated_images )
+			{
+				number_of_allocated_images = thread_arguments->number_of_allocated_images * 2;
+
+				if( number_of_allocated_images == 0 )
+				{
+					number_of_allocated_images = 16;
+				}
+				reallocation = memory_reallocate(
+				                thread_arguments->images,
+				                sizeof( libexe_carver_image_t ) * number_of_allocated_images );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize images.",
+					 function );
+
+					return( -1 );
+				}
+				thread_arguments->images                     = (libexe_carver_image_t *) reallocation;
+				thread_arguments->number_of_allocated_images = number_of_allocated_images;
+			}
+			image.offset = thread_arguments->chunk_offset + (off64_t) search_offset;
+
+			thread_arguments->images[ thread_arguments->number_of_images ] = image;
+
+			thread_arguments->number_of_images += 1;
+		}
+		search_offset++;
+	}
+	return( 1 );
+}
+
+/* Scans a chunk for embedded executables in a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carver_scan_chunk_thread_callback(
+     void *arguments )
+{
+	libexe_carver_thread_arguments_t *thread_arguments = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments = (libexe_carver_thread_arguments_t *) arguments;
+
+	thread_arguments->result = libexe_carver_scan_chunk(
+	                            thread_arguments,
+	                            NULL );
+
+	return( thread_arguments->result );
+}
+
+/* Frees the thread arguments
+ * The file IO handles of the thread arguments are freed unless they refer to the file IO handle of the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carver_free_thread_arguments(
+     libexe_carver_thread_arguments_t **thread_arguments,
+     int number_of_threads,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_carver_free_thread_arguments";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread arguments.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_arguments != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( ( ( *thread_arguments )[ thread_index ].file_io_handle != NULL )
+			 && ( ( *thread_arguments )[ thread_index ].file_io_handle != file_io_handle ) )
+			{
+				if( libbfio_handle_free(
+				     &( ( *thread_arguments )[ thread_index ].file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+			if( ( *thread_arguments )[ thread_index ].chunk_data != NULL )
+			{
+				memory_free(
+				 ( *thread_arguments )[ thread_index ].chunk_data );
+			}
+			if( ( *thread_arguments )[ thread_index ].images != NULL )
+			{
+				memory_free(
+				 ( *thread_arguments )[ thread_index ].images );
+			}
+		}
+		memory_free(
+		 *thread_arguments );
+
+		*thread_arguments = NULL;
+	}
+	return( result );
+}
+
+/* Carves embedded executables from data or a file IO handle
+ * The data is split into chunks, every round each worker thread scans one chunk,
+ * with its own file IO handle if the data is read from a file IO handle
+ * The images found are passed to the image callback in order of offset after every round
+ * Without multi-threading support or if the number of threads is 1 or less
+ * the chunks are scanned in the calling thread
+ * The image callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carver_carve(
+     const uint8_t *data,
+     libbfio_handle_t *file_io_handle,
+     size64_t data_size,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_carver_image_t *image                       = NULL;
+	libexe_carver_thread_arguments_t *thread_arguments = NULL;
+	static char *function                              = "libexe_carver_carve";
+	size64_t number_of_chunks                          = 0;
+	off64_t chunk_offset                               = 0;
+	int callback_result                                = 1;
+	int image_index                                    = 0;
+	int number_of_round_chunks                         = 0;
+	int thread_index                                   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t **threads                     = NULL;
+	int result                                         = 0;
+#endif
+
+	if( ( data == NULL )
+	 && ( file_io_handle == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data and file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	number_of_chunks = ( data_size + LIBEXE_CARVER_CHUNK_SIZE - 1 ) / LIBEXE_CARVER_CHUNK_SIZE;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > LIBEXE_MAXIMUM_NUMBER_OF_CARVER_THREADS )
+	{
+		number_of_threads = LIBEXE_MAXIMUM_NUMBER_OF_CARVER_THREADS;
+	}
+	if( (size64_t) number_of_threads > number_of_chunks )
+	{
+		number_of_threads = (int) number_of_chunks;
+	}
+	if( number_of_threads < 1 )
+	{
+		number_of_threads = 1;
+	}
+#else
+	number_of_threads = 1;
+#endif
+	thread_arguments = (libexe_carver_thread_arguments_t *) memory_allocate(
+	                                                         sizeof( libexe_carver_thread_arguments_t ) * number_of_threads );
+
+	if( thread_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread arguments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     thread_arguments,
+	     0,
+	     sizeof( libexe_carver_thread_arguments_t ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread arguments.",
+		 function );
+
+		memory_free(
+		 thread_arguments );
+
+		thread_arguments = NULL;
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		thread_arguments[ thread_index ].data      = data;
+		thread_arguments[ thread_index ].data_size = data_size;
+
+		if( data != NULL )
+		{
+			continue;
+		}
+		thread_arguments[ thread_index ].chunk_data = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * ( LIBEXE_CARVER_CHUNK_SIZE + LIBEXE_CARVER_HEADERS_MAXIMUM_SIZE ) );
+
+		if( thread_arguments[ thread_index ].chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk data: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		if( number_of_threads == 1 )
+		{
+			thread_arguments[ thread_index ].file_io_handle = file_io_handle;
+
+			continue;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* Every thread uses its own file IO handle since the offset is shared
+		 */
+		if( libbfio_handle_clone(
+		     &( thread_arguments[ thread_index ].file_io_handle ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          thread_arguments[ thread_index ].file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     thread_arguments[ thread_index ].file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		threads = (libcthreads_thread_t **) memory_allocate(
+		                                     sizeof( libcthreads_thread_t * ) * number_of_threads );
+
+		if( threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     threads,
+		     0,
+		     sizeof( libcthreads_thread_t * ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			memory_free(
+			 threads );
+
+			threads = NULL;
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	while( ( callback_result == 1 )
+	    && ( (size64_t) chunk_offset < data_size ) )
+	{
+		for( number_of_round_chunks = 0;
+		     number_of_round_chunks < number_of_threads;
+		     number_of_round_chunks++ )
+		{
+			if( (size64_t) chunk_offset >= data_size )
+			{
+				break;
+			}
+			thread_arguments[ number_of_round_chunks ].chunk_offset = chunk_offset;
+			thread_arguments[ number_of_round_chunks ].chunk_size   = LIBEXE_CARVER_CHUNK_SIZE;
+			thread_arguments[ number_of_round_chunks ].result       = -1;
+
+			if( (size64_t) thread_arguments[ number_of_round_chunks ].chunk_size > ( data_size - chunk_offset ) )
+			{
+				thread_arguments[ number_of_round_chunks ].chunk_size = (size_t) ( data_size - chunk_offset );
+			}
+			chunk_offset += thread_arguments[ number_of_round_chunks ].chunk_size;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_round_chunks > 1 )
+		{
+			for( thread_index = 0;
+			     thread_index < number_of_round_chunks;
+			     thread_index++ )
+			{
+				if( libcthreads_thread_create(
+				     &( threads[ thread_index ] ),
+				     NULL,
+				     &libexe_carver_scan_chunk_thread_callback,
+				     (void *) &( thread_arguments[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create thread: %d.",
+					 function,
+					 thread_index );
+
+					goto on_error;
+				}
+			}
+			for( thread_index = 0;
+			     thread_index < number_of_round_chunks;
+			     thread_index++ )
+			{
+				if( libcthreads_thread_join(
+				     &( threads[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread: %d.",
+					 function,
+					 thread_index );
+
+					goto on_error;
+				}
+			}
+		}
+		else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+		{
+			thread_arguments[ 0 ].result = libexe_carver_scan_chunk(
+			                                &( thread_arguments[ 0 ] ),
+			                                error );
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_round_chunks;
+		     thread_index++ )
+		{
+			if( thread_arguments[ thread_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 thread_arguments[ thread_index ].chunk_offset,
+				 thread_arguments[ thread_index ].chunk_offset );
+
+				goto on_error;
+			}
+			for( image_index = 0;
+			     image_index < thread_arguments[ thread_index ].number_of_images;
+			     image_index++ )
+			{
+				image = &( thread_arguments[ thread_index ].images[ image_index ] );
+
+				callback_result = image_callback(
+				                   image->offset,
+				                   image->size,
+				                   image->target_architecture_type,
+				                   image->characteristic_flags,
+				                   callback_data );
+
+				if( callback_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: image callback failed for image at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 image->offset,
+					 image->offset );
+
+					goto on_error;
+				}
+				else if( callback_result == 0 )
+				{
+					break;
+				}
+			}
+			if( callback_result == 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( libexe_carver_free_thread_arguments(
+	     &thread_arguments,
+	     number_of_threads,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free thread arguments.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( threads[ thread_index ] != NULL )
+			{
+				libcthreads_thread_join(
+				 &( threads[ thread_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 threads );
+	}
+#endif
+	if( thread_arguments != NULL )
+	{
+		libexe_carver_free_thread_arguments(
+		 &thread_arguments,
+		 number_of_threads,
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Carves embedded executables from a buffer
+ * The buffer is scanned for MZ signatures, the headers at every signature are validated
+ * and the image size is determined from the section and certificate tables
+ * The image callback is called for every embedded executable in order of offset
+ * with the offset and size of the image, the target architecture type and the characteristic flags
+ * The image callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carve_buffer(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_carve_buffer";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_carver_carve(
+	     buffer,
+	     NULL,
+	     (size64_t) buffer_size,
+	     number_of_threads,
+	     image_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Carves embedded executables from a file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carve_file(
+     const char *filename,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libexe_carve_file";
+	size_t filename_length           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = libcstring_narrow_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_carve_file_io_handle(
+	     file_io_handle,
+	     number_of_threads,
+	     image_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve file using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Carves embedded executables from a file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carve_file_wide(
+     const wchar_t *filename,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libexe_carve_file_wide";
+	size_t filename_length           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = libcstring_wide_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_carve_file_io_handle(
+	     file_io_handle,
+	     number_of_threads,
+	     image_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve file using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Carves embedded executables using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_carve_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function      = "libexe_carve_file_io_handle";
+	size64_t file_size         = 0;
+	int file_io_handle_is_open = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_carver_carve(
+	     NULL,
+	     file_io_handle,
+	     file_size,
+	     number_of_threads,
+	     image_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,205 @@
+/*
+ * Embedded executable carver functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_CARVER_H )
+#define _LIBEXE_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_extern.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_carver_image libexe_carver_image_t;
+
+struct libexe_carver_image
+{
+	/* The offset of the image
+	 */
+	off64_t offset;
+
+	/* The size of the image
+	 */
+	size64_t size;
+
+	/* The target architecture type
+	 */
+	uint16_t target_architecture_type;
+
+	/* The characteristic flags
+	 */
+	uint16_t characteristic_flags;
+};
+
+typedef struct libexe_carver_thread_arguments libexe_carver_thread_arguments_t;
+
+struct libexe_carver_thread_arguments
+{
+	/* The data, NULL if the chunks are read using the file IO handle
+	 */
+	const uint8_t *data;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The size of the data
+	 */
+	size64_t data_size;
+
+	/* The chunk data
+	 */
+	uint8_t *chunk_data;
+
+	/* The offset of the chunk
+	 */
+	off64_t chunk_offset;
+
+	/* The size of the chunk, the headers of an image can extend beyond the chunk
+	 */
+	size_t chunk_size;
+
+	/* The images found in the chunk
+	 */
+	libexe_carver_image_t *images;
+
+	/* The number of images
+	 */
+	int number_of_images;
+
+	/* The number of allocated images
+	 */
+	int number_of_allocated_images;
+
+	/* The result
+	 */
+	int result;
+};
+
+size_t libexe_carver_find_signature(
+        const uint8_t *data,
+        size_t data_size,
+        size_t search_offset,
+        size_t search_end_offset );
+
+int libexe_carver_read_image_headers(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t remaining_data_size,
+     libexe_carver_image_t *image,
+     libcerror_error_t **error );
+
+int libexe_carver_scan_chunk(
+     libexe_carver_thread_arguments_t *thread_arguments,
+     libcerror_error_t **error );
+
+int libexe_carver_scan_chunk_thread_callback(
+     void *arguments );
+
+int libexe_carver_free_thread_arguments(
+     libexe_carver_thread_arguments_t **thread_arguments,
+     int number_of_threads,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libexe_carver_carve(
+     const uint8_t *data,
+     libbfio_handle_t *file_io_handle,
+     size64_t data_size,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_carve_buffer(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_carve_file(
+     const char *filename,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEXE_EXTERN \
+int libexe_carve_file_wide(
+     const wchar_t *filename,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEXE_EXTERN \
+int libexe_carve_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     int (*image_callback)(
+            off64_t image_offset,
+            size64_t image_size,
+            uint16_t target_architecture_type,
+            uint16_t characteristic_flags,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_CARVER_H ) */
+
@@ -0,0 +1,463 @@
+/*
+ * Certificate table functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_certificate_table.h"
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+
+#include "exe_certificate_table.h"
+
+/* Creates a certificate table
+ * Make sure the value certificate_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_certificate_table_initialize(
+     libexe_certificate_table_t **certificate_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_certificate_table_initialize";
+
+	if( certificate_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *certificate_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid certificate table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*certificate_table = memory_allocate_structure(
+	                      libexe_certificate_table_t );
+
+	if( *certificate_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create certificate table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *certificate_table,
+	     0,
+	     sizeof( libexe_certificate_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear certificate table.",
+		 function );
+
+		memory_free(
+		 *certificate_table );
+
+		*certificate_table = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *certificate_table != NULL )
+	{
+		memory_free(
+		 *certificate_table );
+
+		*certificate_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a certificate table
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_certificate_table_free(
+     libexe_certificate_table_t **certificate_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_certificate_table_free";
+
+	if( certificate_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *certificate_table != NULL )
+	{
+		if( ( *certificate_table )->certificates != NULL )
+		{
+			memory_free(
+			 ( *certificate_table )->certificates );
+		}
+		memory_free(
+		 *certificate_table );
+
+		*certificate_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the certificate table
+ * Only the entry headers are read, the certificate data itself is not copied
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_certificate_table_read(
+     libexe_certificate_table_t *certificate_table,
+     libbfio_handle_t *file_io_handle,
+     uint32_t file_offset,
+     uint32_t size,
+     libcerror_error_t **error )
+{
+	uint8_t entry_header_data[ sizeof( exe_certificate_table_entry_header_t ) ];
+
+	libexe_certificate_t *certificate = NULL;
+	void *reallocation                = NULL;
+	static char *function             = "libexe_certificate_table_read";
+	size64_t file_size                = 0;
+	ssize_t read_count                = 0;
+	uint32_t entry_offset             = 0;
+	uint32_t entry_size               = 0;
+	int maximum_number_of_entries     = 0;
+
+	if( certificate_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	if( certificate_table->certificates != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid certificate table - certificates value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size64_t) file_offset > file_size )
+	 || ( (size64_t) size > ( file_size - file_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid certificate table offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( size - entry_offset ) >= sizeof( exe_certificate_table_entry_header_t ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading certificate table entry: %d header at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+			 function,
+			 certificate_table->number_of_certificates,
+			 file_offset + entry_offset,
+			 file_offset + entry_offset );
+		}
+#endif
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     (off64_t) file_offset + entry_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek certificate table entry: %d offset: %" PRIu32 ".",
+			 function,
+			 certificate_table->number_of_certificates,
+			 file_offset + entry_offset );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              entry_header_data,
+		              sizeof( exe_certificate_table_entry_header_t ),
+		              error );
+
+		if( read_count != (ssize_t) sizeof( exe_certificate_table_entry_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read certificate table entry: %d header.",
+			 function,
+			 certificate_table->number_of_certificates );
+
+			goto on_error;
+		}
+		/* The certificates are allocated as needed since the size of the table
+		 * can be set to an arbitrary value
+		 */
+		if( certificate_table->number_of_certificates >= maximum_number_of_entries )
+		{
+			if( maximum_number_of_entries == 0 )
+			{
+				maximum_number_of_entries = 1;
+			}
+			else
+			{
+				maximum_number_of_entries *= 2;
+			}
+			reallocation = memory_reallocate(
+			                certificate_table->certificates,
+			                sizeof( libexe_certificate_t ) * maximum_number_of_entries );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize certificates.",
+				 function );
+
+				goto on_error;
+			}
+			certificate_table->certificates = (libexe_certificate_t *) reallocation;
+		}
+		certificate = &( certificate_table->certificates[ certificate_table->number_of_certificates ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_certificate_table_entry_header_t *) entry_header_data )->size,
+		 entry_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_certificate_table_entry_header_t *) entry_header_data )->revision,
+		 certificate->revision );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_certificate_table_entry_header_t *) entry_header_data )->certificate_type,
+		 certificate->certificate_type );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: size\t\t\t\t: %" PRIu32 "\n",
+			 function,
+			 entry_size );
+
+			libcnotify_printf(
+			 "%s: revision\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 certificate->revision );
+
+			libcnotify_printf(
+			 "%s: certificate type\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 certificate->certificate_type );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( ( entry_size < sizeof( exe_certificate_table_entry_header_t ) )
+		 || ( entry_size > ( size - entry_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid certificate table entry: %d size value out of bounds.",
+			 function,
+			 certificate_table->number_of_certificates );
+
+			goto on_error;
+		}
+		certificate->data_offset = file_offset + entry_offset + (uint32_t) sizeof( exe_certificate_table_entry_header_t );
+		certificate->data_size   = entry_size - (uint32_t) sizeof( exe_certificate_table_entry_header_t );
+
+		certificate_table->number_of_certificates += 1;
+
+		/* The next entry is aligned to 8 bytes
+		 */
+		if( ( entry_size % LIBEXE_CERTIFICATE_ALIGNMENT ) != 0 )
+		{
+			entry_size += LIBEXE_CERTIFICATE_ALIGNMENT - ( entry_size % LIBEXE_CERTIFICATE_ALIGNMENT );
+		}
+		if( entry_size >= ( size - entry_offset ) )
+		{
+			break;
+		}
+		entry_offset += entry_size;
+	}
+	return( 1 );
+
+on_error:
+	if( certificate_table->certificates != NULL )
+	{
+		memory_free(
+		 certificate_table->certificates );
+
+		certificate_table->certificates = NULL;
+	}
+	certificate_table->number_of_certificates = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of certificates
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_certificate_table_get_number_of_certificates(
+     libexe_certificate_table_t *certificate_table,
+     int *number_of_certificates,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_certificate_table_get_number_of_certificates";
+
+	if( certificate_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_certificates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of certificates.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_certificates = certificate_table->number_of_certificates;
+
+	return( 1 );
+}
+
+/* Retrieves a specific certificate
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_certificate_table_get_certificate_by_index(
+     libexe_certificate_table_t *certificate_table,
+     int certificate_index,
+     libexe_certificate_t **certificate,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_certificate_table_get_certificate_by_index";
+
+	if( certificate_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( certificate_index < 0 )
+	 || ( certificate_index >= certificate_table->number_of_certificates ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid certificate index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( certificate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid certificate.",
+		 function );
+
+		return( -1 );
+	}
+	*certificate = &( certificate_table->certificates[ certificate_index ] );
+
+	return( 1 );
+}
+
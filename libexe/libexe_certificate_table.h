@@ -0,0 +1,101 @@
+/*
+ * Certificate table functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_CERTIFICATE_TABLE_H )
+#define _LIBEXE_CERTIFICATE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_certificate libexe_certificate_t;
+
+struct libexe_certificate
+{
+	/* The revision
+	 */
+	uint16_t revision;
+
+	/* The certificate type
+	 */
+	uint16_t certificate_type;
+
+	/* The data offset
+	 * Contains a file offset
+	 */
+	uint32_t data_offset;
+
+	/* The data size
+	 */
+	uint32_t data_size;
+};
+
+typedef struct libexe_certificate_table libexe_certificate_table_t;
+
+struct libexe_certificate_table
+{
+	/* The certificates
+	 */
+	libexe_certificate_t *certificates;
+
+	/* The number of certificates
+	 */
+	int number_of_certificates;
+};
+
+int libexe_certificate_table_initialize(
+     libexe_certificate_table_t **certificate_table,
+     libcerror_error_t **error );
+
+int libexe_certificate_table_free(
+     libexe_certificate_table_t **certificate_table,
+     libcerror_error_t **error );
+
+int libexe_certificate_table_read(
+     libexe_certificate_table_t *certificate_table,
+     libbfio_handle_t *file_io_handle,
+     uint32_t file_offset,
+     uint32_t size,
+     libcerror_error_t **error );
+
+int libexe_certificate_table_get_number_of_certificates(
+     libexe_certificate_table_t *certificate_table,
+     int *number_of_certificates,
+     libcerror_error_t **error );
+
+int libexe_certificate_table_get_certificate_by_index(
+     libexe_certificate_table_t *certificate_table,
+     int certificate_index,
+     libexe_certificate_t **certificate,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,247 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libexe_checksum.h"
+#include "libexe_libcerror.h"
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEXE_CHECKSUM_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Calculates the PE checksum of a buffer
+ * The PE checksum is a 16-bit one's complement sum of little-endian 16-bit values,
+ * the file size is not added, which is done by the caller once all data has been processed
+ *
+ * Since 65536 is congruent to 1 modulo 65535 the 16-bit values can be summed into wider
+ * accumulators and folded afterwards. The data is processed in blocks of 64 bytes,
+ * with SSE2 the even and odd 16-bit values are summed into the 32-bit lanes of 2 vectors,
+ * otherwise the 32-bit values are summed by 4 independent 64-bit accumulators.
+ * Data that does not fill a block is summed as 16-bit values
+ *
+ * The buffer must start at an even offset relative to the start of the file,
+ * an odd trailing byte is handled as if it were padded with a 0-byte
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_checksum_calculate_pe_checksum(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+#if defined( LIBEXE_CHECKSUM_HAVE_SSE2 )
+	uint32_t lane_values[ 4 ];
+
+	__m128i even_values_sums = _mm_setzero_si128();
+	__m128i lower_word_mask  = _mm_set1_epi32( 0x0000ffffL );
+	__m128i odd_values_sums  = _mm_setzero_si128();
+	__m128i values           = _mm_setzero_si128();
+	int lane_index           = 0;
+#else
+	uint64_t sum2            = 0;
+	uint64_t sum3            = 0;
+	uint64_t sum4            = 0;
+	uint32_t value_32bit_1   = 0;
+	uint32_t value_32bit_2   = 0;
+	uint32_t value_32bit_3   = 0;
+	uint32_t value_32bit_4   = 0;
+#endif
+	static char *function    = "libexe_checksum_calculate_pe_checksum";
+	uint64_t sum1            = 0;
+	size_t block_offset      = 0;
+	size_t block_size        = 0;
+	size_t buffer_offset     = 0;
+	uint16_t value_16bit     = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	sum1 = (uint64_t) initial_value;
+
+#if defined( LIBEXE_CHECKSUM_HAVE_SSE2 )
+	while( ( size - buffer_offset ) >= 64 )
+	{
+		/* Limit the block size so the 32-bit lanes cannot overflow, every lane
+		 * is increased by at most 4 times 0xffff per block of 64 bytes
+		 */
+		block_size = ( size - buffer_offset ) & ~( (size_t) 63 );
+
+		if( block_size > 0x00100000UL )
+		{
+			block_size = 0x00100000UL;
+		}
+		block_size += buffer_offset;
+
+		even_values_sums = _mm_setzero_si128();
+		odd_values_sums  = _mm_setzero_si128();
+
+		while( buffer_offset < block_size )
+		{
+			for( block_offset = 0;
+			     block_offset < 64;
+			     block_offset += 16 )
+			{
+				values = _mm_loadu_si128(
+				          (__m128i *) &( buffer[ buffer_offset + block_offset ] ) );
+
+				even_values_sums = _mm_add_epi32(
+				                    even_values_sums,
+				                    _mm_and_si128(
+				                     values,
+				                     lower_word_mask ) );
+
+				odd_values_sums = _mm_add_epi32(
+				                   odd_values_sums,
+				                   _mm_srli_epi32(
+				                    values,
+				                    16 ) );
+			}
+			buffer_offset += 64;
+		}
+		_mm_storeu_si128(
+		 (__m128i *) lane_values,
+		 even_values_sums );
+
+		for( lane_index = 0;
+		     lane_index < 4;
+		     lane_index++ )
+		{
+			sum1 += lane_values[ lane_index ];
+		}
+		_mm_storeu_si128(
+		 (__m128i *) lane_values,
+		 odd_values_sums );
+
+		for( lane_index = 0;
+		     lane_index < 4;
+		     lane_index++ )
+		{
+			sum1 += lane_values[ lane_index ];
+		}
+	}
+#else
+	while( ( size - buffer_offset ) >= 64 )
+	{
+		/* Limit the block size so the accumulators cannot overflow
+		 */
+		block_size = ( size - buffer_offset ) & ~( (size_t) 63 );
+
+		if( block_size > 0x40000000UL )
+		{
+			block_size = 0x40000000UL;
+		}
+		block_size += buffer_offset;
+
+		while( buffer_offset < block_size )
+		{
+			for( block_offset = 0;
+			     block_offset < 64;
+			     block_offset += 16 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( buffer[ buffer_offset + block_offset ] ),
+				 value_32bit_1 );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( buffer[ buffer_offset + block_offset + 4 ] ),
+				 value_32bit_2 );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( buffer[ buffer_offset + block_offset + 8 ] ),
+				 value_32bit_3 );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( buffer[ buffer_offset + block_offset + 12 ] ),
+				 value_32bit_4 );
+
+				sum1 += value_32bit_1;
+				sum2 += value_32bit_2;
+				sum3 += value_32bit_3;
+				sum4 += value_32bit_4;
+			}
+			buffer_offset += 64;
+		}
+		sum1 = ( sum1 & 0xffffUL ) + ( sum1 >> 16 );
+		sum2 = ( sum2 & 0xffffUL ) + ( sum2 >> 16 );
+		sum3 = ( sum3 & 0xffffUL ) + ( sum3 >> 16 );
+		sum4 = ( sum4 & 0xffffUL ) + ( sum4 >> 16 );
+	}
+	sum1 += sum2 + sum3 + sum4;
+#endif /* defined( LIBEXE_CHECKSUM_HAVE_SSE2 ) */
+
+	while( ( size - buffer_offset ) >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_16bit );
+
+		sum1 += value_16bit;
+
+		buffer_offset += 2;
+	}
+	if( buffer_offset < size )
+	{
+		sum1 += buffer[ buffer_offset ];
+	}
+	while( ( sum1 >> 16 ) != 0 )
+	{
+		sum1 = ( sum1 & 0xffffUL ) + ( sum1 >> 16 );
+	}
+	*checksum_value = (uint32_t) sum1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,514 @@
+/*
+ * Context triggered piecewise hashing (CTPH) functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_ctph.h"
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+
+/* The block size of a specific block hash index
+ */
+#define libexe_ctph_get_block_size( block_hash_index ) \
+	( (uint64_t) LIBEXE_CTPH_MINIMUM_BLOCK_SIZE << ( block_hash_index ) )
+
+/* The base64 characters used in the signature
+ */
+const char libexe_ctph_base64_characters[ 65 ] = \
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* Creates a CTPH context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_ctph_initialize(
+     libexe_ctph_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_ctph_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            libexe_ctph_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( libexe_ctph_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->reduce_size                = LIBEXE_CTPH_MINIMUM_BLOCK_SIZE * LIBEXE_CTPH_SIGNATURE_LENGTH;
+	( *context )->block_hash_end_index       = 1;
+	( *context )->block_hashes[ 0 ].hash      = LIBEXE_CTPH_HASH_INITIAL_VALUE;
+	( *context )->block_hashes[ 0 ].half_hash = LIBEXE_CTPH_HASH_INITIAL_VALUE;
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a CTPH context
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_ctph_free(
+     libexe_ctph_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_ctph_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Starts the block hash of the next block size
+ * The block hash of the next block size is a copy of the last block hash
+ * until it is used in a signature for the first time
+ */
+static void libexe_ctph_fork_block_hash(
+             libexe_ctph_context_t *context )
+{
+	libexe_ctph_block_hash_t *last_block_hash = NULL;
+	libexe_ctph_block_hash_t *next_block_hash = NULL;
+
+	last_block_hash = &( context->block_hashes[ context->block_hash_end_index - 1 ] );
+
+	if( context->block_hash_end_index < LIBEXE_CTPH_NUMBER_OF_BLOCK_HASHES )
+	{
+		next_block_hash = &( context->block_hashes[ context->block_hash_end_index ] );
+
+		next_block_hash->hash                     = last_block_hash->hash;
+		next_block_hash->half_hash                = last_block_hash->half_hash;
+		next_block_hash->signature[ 0 ]           = 0;
+		next_block_hash->half_signature_character = 0;
+		next_block_hash->signature_index          = 0;
+
+		context->block_hash_end_index += 1;
+	}
+	else if( context->use_last_hash == 0 )
+	{
+		context->last_hash     = last_block_hash->hash;
+		context->use_last_hash = 1;
+	}
+}
+
+/* Discards the block hash of the smallest block size if it can no longer be used
+ * in the signature
+ */
+static void libexe_ctph_reduce_block_hash(
+             libexe_ctph_context_t *context )
+{
+	if( ( context->block_hash_end_index - context->block_hash_start_index ) < 2 )
+	{
+		return;
+	}
+	if( context->reduce_size >= context->total_size )
+	{
+		return;
+	}
+	if( context->block_hashes[ context->block_hash_start_index + 1 ].signature_index < ( LIBEXE_CTPH_SIGNATURE_LENGTH / 2 ) )
+	{
+		return;
+	}
+	context->block_hash_start_index += 1;
+	context->reduce_size            *= 2;
+	context->roll_mask               = ( context->roll_mask * 2 ) + 1;
+}
+
+/* Updates the CTPH context
+ * The signatures of all block sizes are calculated simultaneously so that the data
+ * only needs to be read once
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_ctph_update(
+     libexe_ctph_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libexe_ctph_block_hash_t *block_hash = NULL;
+	static char *function                = "libexe_ctph_update";
+	size_t buffer_offset                 = 0;
+	uint32_t block_hash_index            = 0;
+	uint32_t rolling_hash                = 0;
+	uint8_t byte_value                   = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	context->total_size += (uint64_t) size;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		byte_value = buffer[ buffer_offset ];
+
+		context->rolling_hash2 -= context->rolling_hash1;
+		context->rolling_hash2 += LIBEXE_CTPH_ROLLING_WINDOW_SIZE * (uint32_t) byte_value;
+		context->rolling_hash1 += (uint32_t) byte_value;
+		context->rolling_hash1 -= (uint32_t) context->window[ context->window_index ];
+		context->rolling_hash3 <<= 5;
+		context->rolling_hash3 ^= (uint32_t) byte_value;
+
+		context->window[ context->window_index ] = byte_value;
+
+		context->window_index += 1;
+
+		if( context->window_index >= LIBEXE_CTPH_ROLLING_WINDOW_SIZE )
+		{
+			context->window_index = 0;
+		}
+		rolling_hash = context->rolling_hash1 + context->rolling_hash2 + context->rolling_hash3;
+
+		for( block_hash_index = context->block_hash_start_index;
+		     block_hash_index < context->block_hash_end_index;
+		     block_hash_index++ )
+		{
+			block_hash = &( context->block_hashes[ block_hash_index ] );
+
+			block_hash->hash      = ( block_hash->hash * LIBEXE_CTPH_HASH_PRIME ) ^ (uint32_t) byte_value;
+			block_hash->half_hash = ( block_hash->half_hash * LIBEXE_CTPH_HASH_PRIME ) ^ (uint32_t) byte_value;
+		}
+		if( context->use_last_hash != 0 )
+		{
+			context->last_hash = ( context->last_hash * LIBEXE_CTPH_HASH_PRIME ) ^ (uint32_t) byte_value;
+		}
+		/* A reset point of a block size is where the rolling hash equals -1 modulus
+		 * the block size, since the block sizes are the minimum block size times
+		 * a power of 2 the checks of the smaller block sizes can be done first
+		 */
+		if( ( rolling_hash % LIBEXE_CTPH_MINIMUM_BLOCK_SIZE ) != ( LIBEXE_CTPH_MINIMUM_BLOCK_SIZE - 1 ) )
+		{
+			continue;
+		}
+		/* Note that 0xffffffff is not -1 modulus the minimum block size
+		 * so rolling hash + 1 cannot overflow
+		 */
+		if( ( ( ( rolling_hash + 1 ) / LIBEXE_CTPH_MINIMUM_BLOCK_SIZE ) & context->roll_mask ) != 0 )
+		{
+			continue;
+		}
+		for( block_hash_index = context->block_hash_start_index;
+		     block_hash_index < context->block_hash_end_index;
+		     block_hash_index++ )
+		{
+			if( ( (uint64_t) rolling_hash % libexe_ctph_get_block_size( block_hash_index ) ) != ( libexe_ctph_get_block_size( block_hash_index ) - 1 ) )
+			{
+				break;
+			}
+			block_hash = &( context->block_hashes[ block_hash_index ] );
+
+			if( block_hash->signature_index == 0 )
+			{
+				libexe_ctph_fork_block_hash(
+				 context );
+			}
+			block_hash->signature[ block_hash->signature_index ] = libexe_ctph_base64_characters[ block_hash->hash & 0x3f ];
+			block_hash->half_signature_character                 = libexe_ctph_base64_characters[ block_hash->half_hash & 0x3f ];
+
+			/* Once the signature is full the last piece contains the remainder of the data
+			 */
+			if( block_hash->signature_index < ( LIBEXE_CTPH_SIGNATURE_LENGTH - 1 ) )
+			{
+				block_hash->signature_index += 1;
+
+				block_hash->signature[ block_hash->signature_index ] = 0;
+				block_hash->hash                                     = LIBEXE_CTPH_HASH_INITIAL_VALUE;
+
+				if( block_hash->signature_index < ( LIBEXE_CTPH_SIGNATURE_LENGTH / 2 ) )
+				{
+					block_hash->half_hash                = LIBEXE_CTPH_HASH_INITIAL_VALUE;
+					block_hash->half_signature_character = 0;
+				}
+			}
+			else
+			{
+				libexe_ctph_reduce_block_hash(
+				 context );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the CTPH context and retrieves the signature string
+ * The string is formatted as: block size:signature:signature of double the block size
+ * and is compatible with ssdeep
+ * The string size should be at least LIBEXE_SSDEEP_STRING_SIZE
+ * Returns 1 if successful, 0 if the data is too large or -1 on error
+ */
+int libexe_ctph_finalize(
+     libexe_ctph_context_t *context,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	char block_size_string[ 16 ];
+
+	libexe_ctph_block_hash_t *block_hash = NULL;
+	static char *function                = "libexe_ctph_finalize";
+	uint64_t block_size                  = 0;
+	size_t block_size_string_length      = 0;
+	size_t string_index                  = 0;
+	uint32_t block_hash_index            = 0;
+	uint32_t rolling_hash                = 0;
+	uint32_t signature_index             = 0;
+	uint32_t signature_length            = 0;
+	char last_character                  = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < LIBEXE_SSDEEP_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->total_size > ( libexe_ctph_get_block_size( LIBEXE_CTPH_NUMBER_OF_BLOCK_HASHES - 1 ) * LIBEXE_CTPH_SIGNATURE_LENGTH ) )
+	{
+		return( 0 );
+	}
+	rolling_hash = context->rolling_hash1 + context->rolling_hash2 + context->rolling_hash3;
+
+	/* Determine the smallest block size for which the signature would not exceed
+	 * the signature length and then the largest block size, not exceeding it,
+	 * that has a signature of at least half the signature length
+	 */
+	block_hash_index = context->block_hash_start_index;
+
+	while( ( libexe_ctph_get_block_size( block_hash_index ) * LIBEXE_CTPH_SIGNATURE_LENGTH ) < context->total_size )
+	{
+		block_hash_index++;
+	}
+	if( block_hash_index >= context->block_hash_end_index )
+	{
+		block_hash_index = context->block_hash_end_index - 1;
+	}
+	while( ( block_hash_index > context->block_hash_start_index )
+	    && ( context->block_hashes[ block_hash_index ].signature_index < ( LIBEXE_CTPH_SIGNATURE_LENGTH / 2 ) ) )
+	{
+		block_hash_index--;
+	}
+	block_size = libexe_ctph_get_block_size( block_hash_index );
+
+	do
+	{
+		block_size_string[ block_size_string_length++ ] = (char) ( '0' + ( block_size % 10 ) );
+
+		block_size /= 10;
+	}
+	while( block_size > 0 );
+
+	while( block_size_string_length > 0 )
+	{
+		string[ string_index++ ] = block_size_string[ --block_size_string_length ];
+	}
+	string[ string_index++ ] = ':';
+
+	/* The signature of the block size
+	 */
+	block_hash       = &( context->block_hashes[ block_hash_index ] );
+	signature_length = block_hash->signature_index;
+
+	for( signature_index = 0;
+	     signature_index < signature_length;
+	     signature_index++ )
+	{
+		string[ string_index++ ] = block_hash->signature[ signature_index ];
+	}
+	if( rolling_hash != 0 )
+	{
+		string[ string_index++ ] = libexe_ctph_base64_characters[ block_hash->hash & 0x3f ];
+	}
+	else if( block_hash->signature[ signature_length ] != 0 )
+	{
+		string[ string_index++ ] = block_hash->signature[ signature_length ];
+	}
+	string[ string_index++ ] = ':';
+
+	/* The signature of double the block size, truncated to half the signature length
+	 */
+	if( block_hash_index < ( context->block_hash_end_index - 1 ) )
+	{
+		block_hash       = &( context->block_hashes[ block_hash_index + 1 ] );
+		signature_length = block_hash->signature_index;
+
+		if( signature_length > ( ( LIBEXE_CTPH_SIGNATURE_LENGTH / 2 ) - 1 ) )
+		{
+			signature_length = ( LIBEXE_CTPH_SIGNATURE_LENGTH / 2 ) - 1;
+		}
+		for( signature_index = 0;
+		     signature_index < signature_length;
+		     signature_index++ )
+		{
+			string[ string_index++ ] = block_hash->signature[ signature_index ];
+		}
+		if( rolling_hash != 0 )
+		{
+			last_character = libexe_ctph_base64_characters[ block_hash->half_hash & 0x3f ];
+		}
+		else
+		{
+			last_character = block_hash->half_signature_character;
+		}
+		if( last_character != 0 )
+		{
+			string[ string_index++ ] = last_character;
+		}
+	}
+	else if( rolling_hash != 0 )
+	{
+		if( block_hash_index == 0 )
+		{
+			string[ string_index++ ] = libexe_ctph_base64_characters[ block_hash->hash & 0x3f ];
+		}
+		else
+		{
+			string[ string_index++ ] = libexe_ctph_base64_characters[ context->last_hash & 0x3f ];
+		}
+	}
+	string[ string_index ] = 0;
+
+	return( 1 );
+}
+
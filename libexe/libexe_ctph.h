@@ -0,0 +1,136 @@
+/*
+ * Context triggered piecewise hashing (CTPH) functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_CTPH_H )
+#define _LIBEXE_CTPH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_ctph_block_hash libexe_ctph_block_hash_t;
+
+struct libexe_ctph_block_hash
+{
+	/* The hash of the current piece
+	 */
+	uint32_t hash;
+
+	/* The hash of the current piece of the truncated signature
+	 */
+	uint32_t half_hash;
+
+	/* The signature
+	 */
+	char signature[ LIBEXE_CTPH_SIGNATURE_LENGTH ];
+
+	/* The last character of the truncated signature
+	 */
+	char half_signature_character;
+
+	/* The signature index
+	 */
+	uint32_t signature_index;
+};
+
+typedef struct libexe_ctph_context libexe_ctph_context_t;
+
+struct libexe_ctph_context
+{
+	/* The total size of the data
+	 */
+	uint64_t total_size;
+
+	/* The size of the data from which the first block hash can be discarded
+	 */
+	uint64_t reduce_size;
+
+	/* The index of the first block hash
+	 */
+	uint32_t block_hash_start_index;
+
+	/* The index after the last block hash
+	 */
+	uint32_t block_hash_end_index;
+
+	/* The mask used to skip reset point checks of the discarded block hashes
+	 */
+	uint32_t roll_mask;
+
+	/* The block hashes, one for each block size
+	 */
+	libexe_ctph_block_hash_t block_hashes[ LIBEXE_CTPH_NUMBER_OF_BLOCK_HASHES ];
+
+	/* The rolling hash window
+	 */
+	uint8_t window[ LIBEXE_CTPH_ROLLING_WINDOW_SIZE ];
+
+	/* The rolling hash window index
+	 */
+	uint32_t window_index;
+
+	/* The rolling hash values
+	 */
+	uint32_t rolling_hash1;
+	uint32_t rolling_hash2;
+	uint32_t rolling_hash3;
+
+	/* The hash of the current piece of the largest block size
+	 */
+	uint32_t last_hash;
+
+	/* Value to indicate the last hash is used
+	 */
+	uint8_t use_last_hash;
+};
+
+int libexe_ctph_initialize(
+     libexe_ctph_context_t **context,
+     libcerror_error_t **error );
+
+int libexe_ctph_free(
+     libexe_ctph_context_t **context,
+     libcerror_error_t **error );
+
+int libexe_ctph_update(
+     libexe_ctph_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libexe_ctph_finalize(
+     libexe_ctph_context_t *context,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_CTPH_H ) */
+
@@ -0,0 +1,908 @@
+/*
+ * Digest functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_ctph.h"
+#include "libexe_definitions.h"
+#include "libexe_digest.h"
+#include "libexe_libcerror.h"
+#include "libexe_libhmac.h"
+#include "libexe_tlsh.h"
+
+/* Creates a digest of a range of data
+ * Make sure the value digest is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_digest_initialize(
+     libexe_digest_t **digest,
+     off64_t range_offset,
+     size64_t range_size,
+     uint32_t digest_types,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_digest_initialize";
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size > (size64_t) ( INT64_MAX - range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_types & ~LIBEXE_DIGEST_TYPES_SUPPORTED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest types: 0x%08" PRIx32 ".",
+		 function,
+		 digest_types );
+
+		return( -1 );
+	}
+	*digest = memory_allocate_structure(
+	           libexe_digest_t );
+
+	if( *digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest,
+	     0,
+	     sizeof( libexe_digest_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest.",
+		 function );
+
+		memory_free(
+		 *digest );
+
+		*digest = NULL;
+
+		return( -1 );
+	}
+	if( ( digest_types & LIBEXE_DIGEST_TYPE_MD5 ) != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( ( *digest )->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( digest_types & LIBEXE_DIGEST_TYPE_SHA1 ) != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &( ( *digest )->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( digest_types & LIBEXE_DIGEST_TYPE_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( ( *digest )->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( digest_types & LIBEXE_DIGEST_TYPE_SSDEEP ) != 0 )
+	{
+		if( libexe_ctph_initialize(
+		     &( ( *digest )->ctph_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize CTPH context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( digest_types & LIBEXE_DIGEST_TYPE_TLSH ) != 0 )
+	{
+		if( libexe_tlsh_initialize(
+		     &( ( *digest )->tlsh_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize TLSH context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *digest )->range_offset     = range_offset;
+	( *digest )->range_end_offset = range_offset + (off64_t) range_size;
+	( *digest )->digest_types     = digest_types;
+
+	return( 1 );
+
+on_error:
+	if( *digest != NULL )
+	{
+		libexe_digest_free(
+		 digest,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a digest
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_digest_free(
+     libexe_digest_t **digest,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_digest_free";
+	int result            = 1;
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest != NULL )
+	{
+		if( ( *digest )->tlsh_context != NULL )
+		{
+			if( libexe_tlsh_free(
+			     &( ( *digest )->tlsh_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free TLSH context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest )->ctph_context != NULL )
+		{
+			if( libexe_ctph_free(
+			     &( ( *digest )->ctph_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free CTPH context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest )->sha256_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *digest )->sha256_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest )->sha1_context != NULL )
+		{
+			if( libhmac_sha1_free(
+			     &( ( *digest )->sha1_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA1 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest )->md5_context != NULL )
+		{
+			if( libhmac_md5_free(
+			     &( ( *digest )->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *digest );
+
+		*digest = NULL;
+	}
+	return( result );
+}
+
+/* Updates the digest with the part of a buffer that overlaps with the range
+ * The buffer offset contains the offset of the buffer data relative to the start of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_digest_update(
+     libexe_digest_t *digest,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     off64_t buffer_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_digest_update";
+	off64_t data_end      = 0;
+	off64_t data_start    = 0;
+	size_t data_size      = 0;
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid buffer offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	data_start = buffer_offset;
+	data_end   = buffer_offset + (off64_t) buffer_size;
+
+	if( data_start < digest->range_offset )
+	{
+		data_start = digest->range_offset;
+	}
+	if( data_end > digest->range_end_offset )
+	{
+		data_end = digest->range_end_offset;
+	}
+	if( data_start >= data_end )
+	{
+		return( 1 );
+	}
+	buffer   += (size_t) ( data_start - buffer_offset );
+	data_size = (size_t) ( data_end - data_start );
+
+	if( digest->md5_context != NULL )
+	{
+		if( libhmac_md5_update(
+		     digest->md5_context,
+		     buffer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->sha1_context != NULL )
+	{
+		if( libhmac_sha1_update(
+		     digest->sha1_context,
+		     buffer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA1 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->sha256_context != NULL )
+	{
+		if( libhmac_sha256_update(
+		     digest->sha256_context,
+		     buffer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->ctph_context != NULL )
+	{
+		if( libexe_ctph_update(
+		     digest->ctph_context,
+		     buffer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update CTPH hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->tlsh_context != NULL )
+	{
+		if( libexe_tlsh_update(
+		     digest->tlsh_context,
+		     buffer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update TLSH hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the digest hashes
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_digest_finalize(
+     libexe_digest_t *digest,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_digest_finalize";
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest->md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     digest->md5_context,
+		     digest->md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( libhmac_md5_free(
+		     &( digest->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->sha1_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     digest->sha1_context,
+		     digest->sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( libhmac_sha1_free(
+		     &( digest->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA1 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->sha256_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     digest->sha256_context,
+		     digest->sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( libhmac_sha256_free(
+		     &( digest->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->ctph_context != NULL )
+	{
+		/* The ssdeep hash string is left empty if the data is too large
+		 */
+		if( libexe_ctph_finalize(
+		     digest->ctph_context,
+		     digest->ssdeep_string,
+		     LIBEXE_SSDEEP_STRING_SIZE,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize CTPH hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( libexe_ctph_free(
+		     &( digest->ctph_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free CTPH context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest->tlsh_context != NULL )
+	{
+		/* The TLSH hash string is left empty if there is not enough data
+		 */
+		if( libexe_tlsh_finalize(
+		     digest->tlsh_context,
+		     digest->tlsh_string,
+		     LIBEXE_TLSH_STRING_SIZE,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize TLSH hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( libexe_tlsh_free(
+		     &( digest->tlsh_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free TLSH context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	digest->is_finalized = 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific digest hash
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_digest_get_hash(
+     libexe_digest_t *digest,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t *digest_hash    = NULL;
+	static char *function   = "libexe_digest_get_hash";
+	size_t digest_hash_size = 0;
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case LIBEXE_DIGEST_TYPE_MD5:
+			digest_hash      = digest->md5_hash;
+			digest_hash_size = LIBHMAC_MD5_HASH_SIZE;
+			break;
+
+		case LIBEXE_DIGEST_TYPE_SHA1:
+			digest_hash      = digest->sha1_hash;
+			digest_hash_size = LIBHMAC_SHA1_HASH_SIZE;
+			break;
+
+		case LIBEXE_DIGEST_TYPE_SHA256:
+			digest_hash      = digest->sha256_hash;
+			digest_hash_size = LIBHMAC_SHA256_HASH_SIZE;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: 0x%08" PRIx32 ".",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < digest_hash_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest->is_finalized == 0 )
+	 || ( ( digest->digest_types & digest_type ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     hash,
+	     digest_hash,
+	     digest_hash_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific fuzzy hash string
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_digest_get_fuzzy_hash(
+     libexe_digest_t *digest,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	char *fuzzy_hash_string       = NULL;
+	static char *function         = "libexe_digest_get_fuzzy_hash";
+	size_t fuzzy_hash_string_size = 0;
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case LIBEXE_DIGEST_TYPE_SSDEEP:
+			fuzzy_hash_string      = digest->ssdeep_string;
+			fuzzy_hash_string_size = LIBEXE_SSDEEP_STRING_SIZE;
+			break;
+
+		case LIBEXE_DIGEST_TYPE_TLSH:
+			fuzzy_hash_string      = digest->tlsh_string;
+			fuzzy_hash_string_size = LIBEXE_TLSH_STRING_SIZE;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: 0x%08" PRIx32 ".",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < fuzzy_hash_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest->is_finalized == 0 )
+	 || ( ( digest->digest_types & digest_type ) == 0 )
+	 || ( fuzzy_hash_string[ 0 ] == 0 ) )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     string,
+	     fuzzy_hash_string,
+	     fuzzy_hash_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,140 @@
+/*
+ * Digest functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_DIGEST_H )
+#define _LIBEXE_DIGEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_ctph.h"
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+#include "libexe_libhmac.h"
+#include "libexe_tlsh.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_digest libexe_digest_t;
+
+struct libexe_digest
+{
+	/* The range offset
+	 */
+	off64_t range_offset;
+
+	/* The range end offset
+	 */
+	off64_t range_end_offset;
+
+	/* The digest types
+	 */
+	uint32_t digest_types;
+
+	/* Value to indicate the digest hashes have been finalized
+	 */
+	uint8_t is_finalized;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The MD5 hash
+	 */
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The SHA1 hash
+	 */
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	/* The SHA256 hash
+	 */
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	/* The CTPH (ssdeep) context
+	 */
+	libexe_ctph_context_t *ctph_context;
+
+	/* The TLSH context
+	 */
+	libexe_tlsh_context_t *tlsh_context;
+
+	/* The ssdeep hash string
+	 */
+	char ssdeep_string[ LIBEXE_SSDEEP_STRING_SIZE ];
+
+	/* The TLSH hash string
+	 */
+	char tlsh_string[ LIBEXE_TLSH_STRING_SIZE ];
+};
+
+int libexe_digest_initialize(
+     libexe_digest_t **digest,
+     off64_t range_offset,
+     size64_t range_size,
+     uint32_t digest_types,
+     libcerror_error_t **error );
+
+int libexe_digest_free(
+     libexe_digest_t **digest,
+     libcerror_error_t **error );
+
+int libexe_digest_update(
+     libexe_digest_t *digest,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     off64_t buffer_offset,
+     libcerror_error_t **error );
+
+int libexe_digest_finalize(
+     libexe_digest_t *digest,
+     libcerror_error_t **error );
+
+int libexe_digest_get_hash(
+     libexe_digest_t *digest,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int libexe_digest_get_fuzzy_hash(
+     libexe_digest_t *digest,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_DIGEST_H ) */
+
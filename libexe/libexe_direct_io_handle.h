@@ -0,0 +1,170 @@
+/*
+ * Direct IO handle functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_DIRECT_IO_HANDLE_H )
+#define _LIBEXE_DIRECT_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_direct_io_handle libexe_direct_io_handle_t;
+
+struct libexe_direct_io_handle
+{
+	/* The filename
+	 */
+	char *filename;
+
+	/* The filename size
+	 */
+	size_t filename_size;
+
+	/* The file descriptor
+	 * Contains -1 if not open
+	 */
+	int descriptor;
+
+	/* The allocated buffer, which contains the aligned buffer
+	 */
+	uint8_t *buffer_allocation;
+
+	/* The buffer, which is aligned to the direct IO alignment
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The file offset of the data in the buffer
+	 */
+	off64_t buffer_data_offset;
+
+	/* The size of the data in the buffer
+	 */
+	size_t buffer_data_size;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The current access flags
+	 */
+	int access_flags;
+};
+
+int libexe_direct_io_handle_initialize(
+     libexe_direct_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libexe_direct_io_handle_free(
+     libexe_direct_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libexe_direct_io_handle_clone(
+     libexe_direct_io_handle_t **destination_io_handle,
+     libexe_direct_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libexe_direct_io_handle_set_name(
+     libexe_direct_io_handle_t *io_handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libexe_direct_io_handle_set_name_wide(
+     libexe_direct_io_handle_t *io_handle,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libexe_direct_io_handle_open(
+     libexe_direct_io_handle_t *io_handle,
+     int flags,
+     libcerror_error_t **error );
+
+int libexe_direct_io_handle_close(
+     libexe_direct_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libexe_direct_io_handle_read_buffer_data(
+         libexe_direct_io_handle_t *io_handle,
+         off64_t offset,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libexe_direct_io_handle_read(
+         libexe_direct_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libexe_direct_io_handle_write(
+         libexe_direct_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libexe_direct_io_handle_seek_offset(
+         libexe_direct_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libexe_direct_io_handle_exists(
+     libexe_direct_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_direct_io_handle_is_open(
+     libexe_direct_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_direct_io_handle_get_size(
+     libexe_direct_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libexe_direct_io_handle_get_file_io_handle(
+     libexe_direct_io_handle_t *io_handle,
+     libbfio_handle_t **direct_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_DIRECT_IO_HANDLE_H ) */
+
@@ -0,0 +1,841 @@
+/*
+ * Exception table functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libexe_definitions.h"
+#include "libexe_exception_table.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+#include "libexe_unwind_information.h"
+
+#include "exe_exception_table.h"
+
+/* Creates an exception table
+ * Make sure the value exception_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_exception_table_initialize(
+     libexe_exception_table_t **exception_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_exception_table_initialize";
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *exception_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid exception table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*exception_table = memory_allocate_structure(
+	                    libexe_exception_table_t );
+
+	if( *exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create exception table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *exception_table,
+	     0,
+	     sizeof( libexe_exception_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear exception table.",
+		 function );
+
+		memory_free(
+		 *exception_table );
+
+		*exception_table = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *exception_table != NULL )
+	{
+		memory_free(
+		 *exception_table );
+
+		*exception_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an exception table
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_exception_table_free(
+     libexe_exception_table_t **exception_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_exception_table_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *exception_table != NULL )
+	{
+		if( ( *exception_table )->unwind_information != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *exception_table )->number_of_runtime_functions;
+			     entry_index++ )
+			{
+				if( libexe_unwind_information_free(
+				     &( ( *exception_table )->unwind_information[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free unwind information: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *exception_table )->unwind_information );
+		}
+		if( ( *exception_table )->runtime_functions != NULL )
+		{
+			memory_free(
+			 ( *exception_table )->runtime_functions );
+		}
+		memory_free(
+		 *exception_table );
+
+		*exception_table = NULL;
+	}
+	return( result );
+}
+
+/* Compares two runtime functions by their begin address
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libexe_exception_table_compare_runtime_functions(
+     const void *first_runtime_function,
+     const void *second_runtime_function )
+{
+	uint32_t first_begin_address  = ( (libexe_runtime_function_t *) first_runtime_function )->begin_address;
+	uint32_t second_begin_address = ( (libexe_runtime_function_t *) second_runtime_function )->begin_address;
+
+	if( first_begin_address < second_begin_address )
+	{
+		return( -1 );
+	}
+	else if( first_begin_address > second_begin_address )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the exception table
+ * The entries are stored sorted by begin address, since the lookup functions rely on it
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_exception_table_read(
+     libexe_exception_table_t *exception_table,
+     libbfio_handle_t *file_io_handle,
+     uint32_t file_offset,
+     uint32_t size,
+     uint16_t target_architecture_type,
+     libcerror_error_t **error )
+{
+	libexe_runtime_function_t *runtime_function = NULL;
+	uint8_t *data                               = NULL;
+	uint8_t *entry_data                         = NULL;
+	static char *function                       = "libexe_exception_table_read";
+	size_t entry_size                           = 0;
+	ssize_t read_count                          = 0;
+	uint32_t begin_address                      = 0;
+	uint32_t end_address                        = 0;
+	uint32_t function_length                    = 0;
+	uint32_t instruction_size                   = 0;
+	uint32_t maximum_number_of_entries          = 0;
+	uint32_t unwind_data                        = 0;
+	uint32_t unwind_information_address         = 0;
+	int is_sorted                               = 1;
+	int number_of_runtime_functions             = 0;
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( exception_table->runtime_functions != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid exception table - runtime functions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	switch( target_architecture_type )
+	{
+		case LIBEXE_TARGET_ARCHITECTURE_TYPE_AMD64:
+		case LIBEXE_TARGET_ARCHITECTURE_TYPE_IA64:
+			entry_size = sizeof( exe_exception_table_entry_t );
+			break;
+
+		case LIBEXE_TARGET_ARCHITECTURE_TYPE_ARMNT:
+			entry_size       = sizeof( exe_exception_table_entry_arm_t );
+			instruction_size = 2;
+			break;
+
+		case LIBEXE_TARGET_ARCHITECTURE_TYPE_ARM64:
+			entry_size       = sizeof( exe_exception_table_entry_arm_t );
+			instruction_size = 4;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported target architecture type: 0x%04" PRIx16 ".",
+			 function,
+			 target_architecture_type );
+
+			return( -1 );
+	}
+#if SIZEOF_SIZE_T <= 4
+	if( size > (uint32_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	maximum_number_of_entries = size / (uint32_t) entry_size;
+
+	if( maximum_number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) maximum_number_of_entries > (size_t) ( INT_MAX / sizeof( libexe_runtime_function_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading exception table at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     (off64_t) file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek exception table offset: %" PRIx32 ".",
+		 function,
+		 file_offset );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create exception table data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              size,
+	              error );
+
+	if( read_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read exception table.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: exception table:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 (size_t) size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	exception_table->runtime_functions = (libexe_runtime_function_t *) memory_allocate(
+	                                                                    sizeof( libexe_runtime_function_t ) * maximum_number_of_entries );
+
+	if( exception_table->runtime_functions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create runtime functions.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_data = data;
+	     maximum_number_of_entries > 0;
+	     maximum_number_of_entries-- )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_exception_table_entry_t *) entry_data )->begin_address,
+		 begin_address );
+
+		if( entry_size == sizeof( exe_exception_table_entry_t ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (exe_exception_table_entry_t *) entry_data )->end_address,
+			 end_address );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (exe_exception_table_entry_t *) entry_data )->unwind_information_address,
+			 unwind_information_address );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (exe_exception_table_entry_arm_t *) entry_data )->unwind_data,
+			 unwind_data );
+
+			/* ARM Thumb code addresses have the lower bit set
+			 */
+			begin_address &= ~( (uint32_t) 1 );
+
+			/* The lower 2 bits contain the packed unwind data flag
+			 * if 0 the value contains the RVA of the unwind information,
+			 * which starts with the function length
+			 */
+			if( ( unwind_data & 0x00000003UL ) == 0 )
+			{
+				end_address                = 0;
+				unwind_information_address = unwind_data;
+			}
+			else
+			{
+				function_length = ( unwind_data >> 2 ) & 0x000007ffUL;
+
+				end_address                = begin_address + ( function_length * instruction_size );
+				unwind_information_address = 0;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: entry: %04d begin address\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 number_of_runtime_functions,
+			 begin_address );
+
+			libcnotify_printf(
+			 "%s: entry: %04d end address\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 number_of_runtime_functions,
+			 end_address );
+
+			libcnotify_printf(
+			 "%s: entry: %04d unwind information address\t: 0x%08" PRIx32 "\n",
+			 function,
+			 number_of_runtime_functions,
+			 unwind_information_address );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		entry_data += entry_size;
+
+		/* Ignore empty and invalid entries, such as the padding at the end of the table
+		 */
+		if( ( begin_address == 0 )
+		 && ( unwind_information_address == 0 ) )
+		{
+			continue;
+		}
+		if( ( end_address != 0 )
+		 && ( end_address <= begin_address ) )
+		{
+			continue;
+		}
+		runtime_function = &( exception_table->runtime_functions[ number_of_runtime_functions ] );
+
+		if( ( number_of_runtime_functions > 0 )
+		 && ( begin_address < runtime_function[ -1 ].begin_address ) )
+		{
+			is_sorted = 0;
+		}
+		runtime_function->begin_address              = begin_address;
+		runtime_function->end_address                = end_address;
+		runtime_function->unwind_information_address = unwind_information_address;
+
+		number_of_runtime_functions++;
+	}
+	/* The exception table should be sorted but this is not enforced in the format
+	 */
+	if( is_sorted == 0 )
+	{
+		qsort(
+		 exception_table->runtime_functions,
+		 (size_t) number_of_runtime_functions,
+		 sizeof( libexe_runtime_function_t ),
+		 &libexe_exception_table_compare_runtime_functions );
+	}
+	exception_table->number_of_runtime_functions = number_of_runtime_functions;
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( exception_table->runtime_functions != NULL )
+	{
+		memory_free(
+		 exception_table->runtime_functions );
+
+		exception_table->runtime_functions = NULL;
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of runtime functions
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_exception_table_get_number_of_runtime_functions(
+     libexe_exception_table_t *exception_table,
+     int *number_of_runtime_functions,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_exception_table_get_number_of_runtime_functions";
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_runtime_functions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of runtime functions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_runtime_functions = exception_table->number_of_runtime_functions;
+
+	return( 1 );
+}
+
+/* Retrieves a specific runtime function
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_exception_table_get_runtime_function_by_index(
+     libexe_exception_table_t *exception_table,
+     int runtime_function_index,
+     libexe_runtime_function_t **runtime_function,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_exception_table_get_runtime_function_by_index";
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( runtime_function_index < 0 )
+	 || ( runtime_function_index >= exception_table->number_of_runtime_functions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid runtime function index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( runtime_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid runtime function.",
+		 function );
+
+		return( -1 );
+	}
+	*runtime_function = &( exception_table->runtime_functions[ runtime_function_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the runtime function with the highest begin address that is less than
+ * or equal to the relative virtual address using a binary search
+ * If the end address of the runtime function is known it must be greater than the relative virtual address
+ * Returns 1 if successful, 0 if no such runtime function or -1 on error
+ */
+int libexe_exception_table_get_runtime_function_by_relative_virtual_address(
+     libexe_exception_table_t *exception_table,
+     uint32_t relative_virtual_address,
+     libexe_runtime_function_t **runtime_function,
+     libcerror_error_t **error )
+{
+	libexe_runtime_function_t *safe_runtime_function = NULL;
+	static char *function                            = "libexe_exception_table_get_runtime_function_by_relative_virtual_address";
+	int lower_index                                  = 0;
+	int middle_index                                 = 0;
+	int upper_index                                  = 0;
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( runtime_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid runtime function.",
+		 function );
+
+		return( -1 );
+	}
+	*runtime_function = NULL;
+
+	upper_index = exception_table->number_of_runtime_functions;
+
+	/* Find the first runtime function with a begin address greater than
+	 * the relative virtual address
+	 */
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( exception_table->runtime_functions[ middle_index ].begin_address <= relative_virtual_address )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		return( 0 );
+	}
+	safe_runtime_function = &( exception_table->runtime_functions[ lower_index - 1 ] );
+
+	if( ( safe_runtime_function->end_address != 0 )
+	 && ( relative_virtual_address >= safe_runtime_function->end_address ) )
+	{
+		return( 0 );
+	}
+	*runtime_function = safe_runtime_function;
+
+	return( 1 );
+}
+
+/* Retrieves the unwind information of a specific runtime function
+ * Returns 1 if successful, 0 if the unwind information has not been read or -1 on error
+ */
+int libexe_exception_table_get_unwind_information_by_index(
+     libexe_exception_table_t *exception_table,
+     int runtime_function_index,
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_exception_table_get_unwind_information_by_index";
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( runtime_function_index < 0 )
+	 || ( runtime_function_index >= exception_table->number_of_runtime_functions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid runtime function index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	if( exception_table->unwind_information == NULL )
+	{
+		return( 0 );
+	}
+	*unwind_information = exception_table->unwind_information[ runtime_function_index ];
+
+	if( *unwind_information == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Sets the unwind information of a specific runtime function
+ * The exception table takes over management of the unwind information
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_exception_table_set_unwind_information_by_index(
+     libexe_exception_table_t *exception_table,
+     int runtime_function_index,
+     libexe_unwind_information_t *unwind_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_exception_table_set_unwind_information_by_index";
+	size_t array_size     = 0;
+
+	if( exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( runtime_function_index < 0 )
+	 || ( runtime_function_index >= exception_table->number_of_runtime_functions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid runtime function index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	if( exception_table->unwind_information == NULL )
+	{
+		array_size = sizeof( libexe_unwind_information_t * ) * exception_table->number_of_runtime_functions;
+
+		exception_table->unwind_information = (libexe_unwind_information_t **) memory_allocate(
+		                                                                        array_size );
+
+		if( exception_table->unwind_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create unwind information array.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     exception_table->unwind_information,
+		     0,
+		     array_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear unwind information array.",
+			 function );
+
+			memory_free(
+			 exception_table->unwind_information );
+
+			exception_table->unwind_information = NULL;
+
+			return( -1 );
+		}
+	}
+	if( exception_table->unwind_information[ runtime_function_index ] != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwind information: %d value already set.",
+		 function,
+		 runtime_function_index );
+
+		return( -1 );
+	}
+	exception_table->unwind_information[ runtime_function_index ] = unwind_information;
+
+	return( 1 );
+}
+
@@ -0,0 +1,128 @@
+/*
+ * Exception table functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_EXCEPTION_TABLE_H )
+#define _LIBEXE_EXCEPTION_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_runtime_function libexe_runtime_function_t;
+
+struct libexe_runtime_function
+{
+	/* The begin address
+	 */
+	uint32_t begin_address;
+
+	/* The end address
+	 * Contains 0 if the end address is stored in the unwind information
+	 */
+	uint32_t end_address;
+
+	/* The unwind information address
+	 * Contains 0 if the unwind data is packed in the exception table entry
+	 */
+	uint32_t unwind_information_address;
+};
+
+typedef struct libexe_exception_table libexe_exception_table_t;
+
+struct libexe_exception_table
+{
+	/* The runtime functions
+	 * Sorted by begin address
+	 */
+	libexe_runtime_function_t *runtime_functions;
+
+	/* The number of runtime functions
+	 */
+	int number_of_runtime_functions;
+
+	/* The unwind information of the runtime functions
+	 * Contains an entry per runtime function, which is NULL if not yet read
+	 */
+	libexe_unwind_information_t **unwind_information;
+};
+
+int libexe_exception_table_initialize(
+     libexe_exception_table_t **exception_table,
+     libcerror_error_t **error );
+
+int libexe_exception_table_free(
+     libexe_exception_table_t **exception_table,
+     libcerror_error_t **error );
+
+int libexe_exception_table_compare_runtime_functions(
+     const void *first_runtime_function,
+     const void *second_runtime_function );
+
+int libexe_exception_table_read(
+     libexe_exception_table_t *exception_table,
+     libbfio_handle_t *file_io_handle,
+     uint32_t file_offset,
+     uint32_t size,
+     uint16_t target_architecture_type,
+     libcerror_error_t **error );
+
+int libexe_exception_table_get_number_of_runtime_functions(
+     libexe_exception_table_t *exception_table,
+     int *number_of_runtime_functions,
+     libcerror_error_t **error );
+
+int libexe_exception_table_get_runtime_function_by_index(
+     libexe_exception_table_t *exception_table,
+     int runtime_function_index,
+     libexe_runtime_function_t **runtime_function,
+     libcerror_error_t **error );
+
+int libexe_exception_table_get_runtime_function_by_relative_virtual_address(
+     libexe_exception_table_t *exception_table,
+     uint32_t relative_virtual_address,
+     libexe_runtime_function_t **runtime_function,
+     libcerror_error_t **error );
+
+int libexe_exception_table_get_unwind_information_by_index(
+     libexe_exception_table_t *exception_table,
+     int runtime_function_index,
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error );
+
+int libexe_exception_table_set_unwind_information_by_index(
+     libexe_exception_table_t *exception_table,
+     int runtime_function_index,
+     libexe_unwind_information_t *unwind_information,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -20,14 +20,26 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libexe_access_advice.h"
+#include "libexe_advice_io_handle.h"
 #include "libexe_data_directory_descriptor.h"
+#include "libexe_certificate_table.h"
+#include "libexe_checksum.h"
 #include "libexe_codepage.h"
 #include "libexe_debug.h"
 #include "libexe_debug_data.h"
 #include "libexe_definitions.h"
+#include "libexe_digest.h"
+#include "libexe_direct_io_handle.h"
+#include "libexe_exception_table.h"
 #include "libexe_export_table.h"
 #include "libexe_import_table.h"
 #include "libexe_io_handle.h"
@@ -37,8 +49,18 @@
 #include "libexe_libcerror.h"
 #include "libexe_libcnotify.h"
 #include "libexe_libcstring.h"
+#include "libexe_libhmac.h"
+#include "libexe_load_configuration.h"
+#include "libexe_merkle_tree.h"
+#include "libexe_page_hashes.h"
+#include "libexe_pattern_set.h"
+#include "libexe_range_io_handle.h"
 #include "libexe_section.h"
 #include "libexe_section_descriptor.h"
+#include "libexe_stream_io_handle.h"
+#include "libexe_string_extractor.h"
+#include "libexe_tls_directory.h"
+#include "libexe_unwind_information.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -131,6 +153,19 @@ int libexe_file_initialize(
 
 		goto on_error;
 	}
+	if( libexe_access_advice_initialize(
+	     &( internal_file->access_advice ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create access advice.",
+		 function );
+
+		goto on_error;
+	}
 	*file = (libexe_file_t *) internal_file;
 
 	return( 1 );
@@ -138,6 +173,12 @@ int libexe_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+		if( internal_file->io_handle != NULL )
+		{
+			libexe_io_handle_free(
+			 &( internal_file->io_handle ),
+			 NULL );
+		}
 		if( internal_file->sections_array != NULL )
 		{
 			libcdata_array_free(
@@ -222,6 +263,19 @@ int libexe_file_free(
 
 			result = -1;
 		}
+		if( libexe_access_advice_free(
+		     &( internal_file->access_advice ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free access advice.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -276,9 +330,13 @@ int libexe_file_open(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle      = NULL;
-	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_open";
+	libbfio_handle_t *file_io_handle            = NULL;
+	libexe_advice_io_handle_t *advice_io_handle = NULL;
+	libexe_direct_io_handle_t *direct_io_handle = NULL;
+	libexe_internal_file_t *internal_file       = NULL;
+	static char *function                       = "libexe_file_open";
+	int access_pattern                          = LIBEXE_ACCESS_PATTERN_NORMAL;
+	uint8_t use_advice_io_handle                = 0;
 
 	if( file == NULL )
 	{
@@ -327,19 +385,157 @@ int libexe_file_open(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	if( libexe_access_advice_get_access_pattern(
+	     internal_file->access_advice,
+	     &access_pattern,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access pattern.",
 		 function );
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	{
+		if( libexe_direct_io_handle_initialize(
+		     &direct_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_direct_io_handle_set_name(
+		     direct_io_handle,
+		     filename,
+		     libcstring_narrow_string_length(
+		      filename ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in direct IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_direct_io_handle_get_file_io_handle(
+		     direct_io_handle,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		/* The direct IO handle is now managed by the file IO handle
+		 */
+		direct_io_handle = NULL;
+	}
+#if defined( LIBEXE_HAVE_ACCESS_ADVICE )
+	/* If an access pattern was set before the file is opened the file is read
+	 * from a descriptor held by the library, so that the advice applies to the reads
+	 */
+	else if( access_pattern != LIBEXE_ACCESS_PATTERN_NORMAL )
+	{
+		if( libexe_advice_io_handle_initialize(
+		     &advice_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create advice IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_advice_io_handle_set_name(
+		     advice_io_handle,
+		     filename,
+		     libcstring_narrow_string_length(
+		      filename ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in advice IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_advice_io_handle_get_file_io_handle(
+		     advice_io_handle,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		/* The advice IO handle is now managed by the file IO handle
+		 */
+		advice_io_handle = NULL;
+
+		use_advice_io_handle = 1;
+	}
+#endif /* defined( LIBEXE_HAVE_ACCESS_ADVICE ) */
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     libcstring_narrow_string_length(
+		      filename ) + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
 	     file_io_handle,
@@ -356,22 +552,6 @@ int libexe_file_open(
 		goto on_error;
 	}
 #endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     libcstring_narrow_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
 	if( libexe_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -390,9 +570,42 @@ int libexe_file_open(
 	}
 	internal_file->file_io_handle_created_in_library = 1;
 
+	if( use_advice_io_handle != 0 )
+	{
+		if( libexe_file_open_access_advice(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open access advice.",
+			 function );
+
+			libexe_file_close(
+			 file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 
 on_error:
+	if( advice_io_handle != NULL )
+	{
+		libexe_advice_io_handle_free(
+		 &advice_io_handle,
+		 NULL );
+	}
+	if( direct_io_handle != NULL )
+	{
+		libexe_direct_io_handle_free(
+		 &direct_io_handle,
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -413,9 +626,13 @@ int libexe_file_open_wide(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle      = NULL;
-	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_open_wide";
+	libbfio_handle_t *file_io_handle            = NULL;
+	libexe_advice_io_handle_t *advice_io_handle = NULL;
+	libexe_direct_io_handle_t *direct_io_handle = NULL;
+	libexe_internal_file_t *internal_file       = NULL;
+	static char *function                       = "libexe_file_open_wide";
+	int access_pattern                          = LIBEXE_ACCESS_PATTERN_NORMAL;
+	uint8_t use_advice_io_handle                = 0;
 
 	if( file == NULL )
 	{
@@ -464,19 +681,157 @@ int libexe_file_open_wide(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	if( libexe_access_advice_get_access_pattern(
+	     internal_file->access_advice,
+	     &access_pattern,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access pattern.",
 		 function );
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	{
+		if( libexe_direct_io_handle_initialize(
+		     &direct_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_direct_io_handle_set_name_wide(
+		     direct_io_handle,
+		     filename,
+		     libcstring_wide_string_length(
+		      filename ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in direct IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_direct_io_handle_get_file_io_handle(
+		     direct_io_handle,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		/* The direct IO handle is now managed by the file IO handle
+		 */
+		direct_io_handle = NULL;
+	}
+#if defined( LIBEXE_HAVE_ACCESS_ADVICE )
+	/* If an access pattern was set before the file is opened the file is read
+	 * from a descriptor held by the library, so that the advice applies to the reads
+	 */
+	else if( access_pattern != LIBEXE_ACCESS_PATTERN_NORMAL )
+	{
+		if( libexe_advice_io_handle_initialize(
+		     &advice_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create advice IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_advice_io_handle_set_name_wide(
+		     advice_io_handle,
+		     filename,
+		     libcstring_wide_string_length(
+		      filename ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in advice IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_advice_io_handle_get_file_io_handle(
+		     advice_io_handle,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		/* The advice IO handle is now managed by the file IO handle
+		 */
+		advice_io_handle = NULL;
+
+		use_advice_io_handle = 1;
+	}
+#endif /* defined( LIBEXE_HAVE_ACCESS_ADVICE ) */
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name_wide(
+		     file_io_handle,
+		     filename,
+		     libcstring_wide_string_length(
+		      filename ) + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
 	     file_io_handle,
@@ -493,22 +848,6 @@ int libexe_file_open_wide(
 		goto on_error;
 	}
 #endif
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     libcstring_wide_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
 	if( libexe_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -527,12 +866,45 @@ int libexe_file_open_wide(
 	}
 	internal_file->file_io_handle_created_in_library = 1;
 
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
+	if( use_advice_io_handle != 0 )
 	{
-		libbfio_handle_free(
+		if( libexe_file_open_access_advice(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open access advice.",
+			 function );
+
+			libexe_file_close(
+			 file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( advice_io_handle != NULL )
+	{
+		libexe_advice_io_handle_free(
+		 &advice_io_handle,
+		 NULL );
+	}
+	if( direct_io_handle != NULL )
+	{
+		libexe_direct_io_handle_free(
+		 &direct_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
 		 &file_io_handle,
 		 NULL );
 	}
@@ -541,19 +913,24 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Opens a file using a Basic File IO (bfio) handle
+/* Opens a file from a buffer
+ * The buffer is not copied, the headers and data directories are read from the buffer
+ * using a memory range file IO handle. Only the section data is accessed without
+ * the file IO handle, it is copied directly from the buffer by libexe_section_read_buffer
+ * or can be referenced using libexe_section_get_data_pointer
+ * The buffer must remain valid until the file is closed
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_open_file_io_handle(
+int libexe_file_open_buffer(
      libexe_file_t *file,
-     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
      int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle      = NULL;
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_open_file_io_handle";
-	int bfio_access_flags                 = 0;
-	int file_io_handle_is_open            = 0;
+	static char *function                 = "libexe_file_open_buffer";
 
 	if( file == NULL )
 	{
@@ -568,131 +945,145 @@ int libexe_file_open_file_io_handle(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( internal_file->file_io_handle != NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) != 0 )
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
-	}
-	if( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		goto on_error;
 	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
-	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+	/* The buffer is set before opening so that section data is copied
+	 * directly from the buffer instead of being read via the file IO handle
+	 */
+	internal_file->io_handle->buffer_data = data;
+	internal_file->io_handle->buffer_size = data_size;
 
-			goto on_error;
-		}
-		internal_file->file_io_handle_opened_in_library = 1;
-	}
-	if( libexe_file_open_read(
-	     internal_file,
+	if( libexe_file_open_file_io_handle(
+	     file,
 	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from buffer.",
 		 function );
 
 		goto on_error;
 	}
-	internal_file->file_io_handle = file_io_handle;
+	internal_file->file_io_handle_created_in_library = 1;
 
 	return( 1 );
 
 on_error:
-	if( ( file_io_handle_is_open == 0 )
-	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
-	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+	internal_file->io_handle->buffer_data = NULL;
+	internal_file->io_handle->buffer_size = 0;
 
-		internal_file->file_io_handle_opened_in_library = 0;
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
-	internal_file->file_io_handle = NULL;
-
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Opens a file from a forward-only stream, such as a pipe or socket
+ * The read callback returns the number of bytes read, which is at most size, or -1 on error
+ * The data consumed from the stream is buffered so that data that is needed out of order
+ * can be read again. When the buffer has reached the maximum buffer size the oldest half
+ * of the buffered data is discarded, hence data can be read again up to half the maximum
+ * buffer size before the furthest offset consumed, reading data before that fails.
+ * A maximum buffer size of 0 represents no maximum
+ * The data directories are read in ascending offset order, the data they reference by
+ * virtual address, such as the TLS callbacks and control flow guard function table,
+ * is read afterwards and can require reading data again
+ * The optional data callback is called with the section data as it is consumed from
+ * the stream, with the same arguments as the data callback of libexe_file_stream_section_data.
+ * When a data callback is provided the stream is consumed up to the end of the section data
+ * before this function returns, hence the section data is passed in a single forward pass
+ * Returns 1 if successful or -1 on error
  */
-int libexe_file_close(
+int libexe_file_open_stream(
      libexe_file_t *file,
+     ssize_t (*read_callback)(
+              uint8_t *buffer,
+              size_t size,
+              void *callback_data ),
+     void *callback_data,
+     size64_t stream_size,
+     size_t maximum_buffer_size,
+     int (*data_callback)(
+            int section_index,
+            off64_t section_data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *data_callback_data,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_close";
-	int result                            = 0;
+	libbfio_handle_t *file_io_handle            = NULL;
+	libexe_internal_file_t *internal_file       = NULL;
+	libexe_stream_io_handle_t *stream_io_handle = NULL;
+	static char *function                       = "libexe_file_open_stream";
+	off64_t section_data_end_offset             = 0;
 
 	if( file == NULL )
 	{
@@ -707,120 +1098,270 @@ int libexe_file_close(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libexe_stream_io_handle_get_file_io_handle(
+	     read_callback,
+	     callback_data,
+	     stream_size,
+	     maximum_buffer_size,
+	     (int (*)(off64_t, const uint8_t *, size_t, void *)) libexe_file_stream_data_callback,
+	     (void *) internal_file,
+	     &file_io_handle,
+	     error ) != 1 )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libexe_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream file IO handle.",
+		 function );
 
-				result = -1;
-			}
-		}
+		goto on_error;
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( libbfio_handle_get_io_handle(
+	     file_io_handle,
+	     (intptr_t **) &stream_io_handle,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_is_stream  = 1;
+	internal_file->stream_data_callback      = data_callback;
+	internal_file->stream_data_callback_data = data_callback_data;
+
+	if( libexe_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from stream.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	/* The section data that was consumed while reading the headers and data directories
+	 * was passed to the data callback by the stream IO handle, the remainder of the
+	 * section data is consumed here
+	 */
+	if( internal_file->stream_data_callback != NULL )
+	{
+		if( libexe_file_get_section_data_end_offset(
+		     internal_file,
+		     &section_data_end_offset,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end offset of section data.",
 			 function );
 
-			result = -1;
+			goto on_error_close;
 		}
-		internal_file->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
+		if( (size64_t) section_data_end_offset > stream_size )
+		{
+			section_data_end_offset = (off64_t) stream_size;
+		}
+		if( section_data_end_offset > 0 )
+		{
+			if( libexe_stream_io_handle_fill_buffer(
+			     stream_io_handle,
+			     section_data_end_offset - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read section data from stream.",
+				 function );
+
+				goto on_error_close;
+			}
+		}
+		if( libexe_stream_io_handle_flush_data_callback(
+		     stream_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass section data to data callback.",
 			 function );
 
-			result = -1;
+			goto on_error_close;
 		}
-		internal_file->file_io_handle_created_in_library = 0;
+		internal_file->stream_data_callback      = NULL;
+		internal_file->stream_data_callback_data = NULL;
 	}
-	internal_file->file_io_handle = NULL;
+	return( 1 );
 
-	if( libexe_io_handle_clear(
-	     internal_file->io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
-		 function );
+on_error_close:
+	libexe_file_close(
+	 file,
+	 NULL );
 
-		result = -1;
-	}
-	if( libcdata_array_resize(
-	     internal_file->sections_array,
-	     0,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize sections array.",
-		 function );
+	return( -1 );
 
-		result = -1;
+on_error:
+	internal_file->file_io_handle_is_stream  = 0;
+	internal_file->stream_data_callback      = NULL;
+	internal_file->stream_data_callback_data = NULL;
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
-	return( result );
+	return( -1 );
 }
 
-/* Opens a file for reading
- * Returns 1 if successful or -1 on error
+/* Passes the data consumed from the stream to the section data callback
+ * Callback function for the stream IO handle
+ * Returns 1 if the data was processed, 0 if the data should be passed again later or -1 on error
  */
-int libexe_file_open_read(
+int libexe_file_stream_data_callback(
+     off64_t stream_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libexe_internal_file_t *internal_file )
+{
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	size64_t section_size                           = 0;
+	off64_t data_end_offset                         = 0;
+	off64_t range_end_offset                        = 0;
+	off64_t range_start_offset                      = 0;
+	off64_t section_offset                          = 0;
+	int number_of_sections                          = 0;
+	int result                                      = 0;
+	int section_index                               = 0;
+
+	if( ( internal_file == NULL )
+	 || ( data == NULL ) )
+	{
+		return( -1 );
+	}
+	if( internal_file->stream_data_callback == NULL )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	/* The data is passed again when the section table has been read
+	 */
+	if( number_of_sections <= 0 )
+	{
+		return( 0 );
+	}
+	data_end_offset = stream_offset + (off64_t) data_size;
+
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( section_offset < 0 )
+		 || ( section_size == 0 ) )
+		{
+			continue;
+		}
+		range_start_offset = section_offset;
+		range_end_offset   = section_offset + (off64_t) section_size;
+
+		if( range_start_offset < stream_offset )
+		{
+			range_start_offset = stream_offset;
+		}
+		if( range_end_offset > data_end_offset )
+		{
+			range_end_offset = data_end_offset;
+		}
+		if( range_start_offset >= range_end_offset )
+		{
+			continue;
+		}
+		result = internal_file->stream_data_callback(
+		          section_index,
+		          range_start_offset - section_offset,
+		          &( data[ range_start_offset - stream_offset ] ),
+		          (size_t) ( range_end_offset - range_start_offset ),
+		          internal_file->stream_data_callback_data );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			internal_file->stream_data_callback = NULL;
+
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the end offset of the section data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_section_data_end_offset(
      libexe_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+     off64_t *end_offset,
      libcerror_error_t **error )
 {
-	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
-	libexe_debug_data_t *debug_data                               = NULL;
-	libexe_export_table_t *export_table                           = NULL;
-	libexe_import_table_t *import_table                           = NULL;
-	static char *function                                         = "libexe_file_open_read";
-	off64_t file_offset                                           = 0;
-	uint16_t number_of_sections                                   = 0;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_section_data_end_offset";
+	size64_t section_size                           = 0;
+	off64_t section_offset                          = 0;
+	int number_of_sections                          = 0;
+	int section_index                               = 0;
 
 	if( internal_file == NULL )
 	{
@@ -833,292 +1374,8559 @@ int libexe_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	if( end_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->abort != 0 )
+	*end_offset = 0;
+
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
 	{
-		internal_file->io_handle->abort = 0;
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( ( section_offset >= 0 )
+		 && ( ( section_offset + (off64_t) section_size ) > *end_offset ) )
+		{
+			*end_offset = section_offset + (off64_t) section_size;
+		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	return( 1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_open_file_io_handle(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_open_file_io_handle";
+	int bfio_access_flags                 = 0;
+	int file_io_handle_is_open            = 0;
+
+	if( file == NULL )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libexe_io_handle_read_file_header(
-	     internal_file->io_handle,
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	/* The layout is set on every open since the file can be reused
+	 */
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_MEMORY_IMAGE ) != 0 )
+	{
+		internal_file->io_handle->is_memory_image = 1;
+	}
+	else
+	{
+		internal_file->io_handle->is_memory_image = 0;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->file_io_handle_opened_in_library = 1;
+	}
+	if( libexe_file_open_read(
+	     internal_file,
 	     file_io_handle,
-	     &number_of_sections,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->block_cache_maximum_number_of_blocks > 0 )
+	{
+		if( libexe_file_open_block_cache(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open block cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( ( file_io_handle_is_open == 0 )
+	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	/* The values read by libexe_file_open_read are freed in case opening
+	 * the block cache failed, otherwise the file cannot be opened again
+	 */
+	if( internal_file->tls_directory != NULL )
+	{
+		libexe_tls_directory_free(
+		 &( internal_file->tls_directory ),
+		 NULL );
+	}
+	if( internal_file->load_configuration != NULL )
+	{
+		libexe_load_configuration_free(
+		 &( internal_file->load_configuration ),
+		 NULL );
+	}
+	if( internal_file->exception_table != NULL )
+	{
+		libexe_exception_table_free(
+		 &( internal_file->exception_table ),
+		 NULL );
+	}
+	libcdata_array_resize(
+	 internal_file->sections_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	 NULL );
+
+	internal_file->io_handle->is_memory_image = 0;
+
+	internal_file->file_io_handle = NULL;
+
+	return( -1 );
+}
+
+/* Opens a file embedded in a Basic File IO (bfio) handle
+ * The file is read from the base offset and no data beyond the size limit is read
+ * A size limit of 0 represents the remainder of the file IO handle
+ * All offsets of the file are relative to the base offset
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_open_file_io_handle_at_offset(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     off64_t base_offset,
+     size64_t size_limit,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *range_file_io_handle = NULL;
+	libexe_internal_file_t *internal_file  = NULL;
+	static char *function                  = "libexe_file_open_file_io_handle_at_offset";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_range_io_handle_get_file_io_handle(
+	     file_io_handle,
+	     base_offset,
+	     size_limit,
+	     &range_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create range file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_file_open_file_io_handle(
+	     file,
+	     range_file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 base_offset,
+		 base_offset );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( range_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &range_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_file_close(
+     libexe_file_t *file,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_close";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libexe_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( libexe_file_close_access_advice(
+	     internal_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close access advice.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->block_cache_file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     internal_file->block_cache_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close block cache file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( internal_file->block_cache_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->block_cache_io_handle = NULL;
+	}
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle            = NULL;
+	internal_file->file_io_handle_is_stream  = 0;
+	internal_file->stream_data_callback      = NULL;
+	internal_file->stream_data_callback_data = NULL;
+
+	internal_file->read_plan_number_of_requested_ranges = 0;
+	internal_file->read_plan_number_of_reads            = 0;
+	internal_file->read_plan_requested_size             = 0;
+	internal_file->read_plan_read_size                  = 0;
+
+	if( libexe_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_resize(
+	     internal_file->sections_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sections array.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->exception_table != NULL )
+	{
+		if( libexe_exception_table_free(
+		     &( internal_file->exception_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free exception table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->certificate_table != NULL )
+	{
+		if( libexe_certificate_table_free(
+		     &( internal_file->certificate_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free certificate table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->load_configuration != NULL )
+	{
+		if( libexe_load_configuration_free(
+		     &( internal_file->load_configuration ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free load configuration.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->tls_directory != NULL )
+	{
+		if( libexe_tls_directory_free(
+		     &( internal_file->tls_directory ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free TLS directory.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->page_hashes != NULL )
+	{
+		if( libexe_page_hashes_free(
+		     &( internal_file->page_hashes ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page hashes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libexe_file_free_digests(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free digests.",
+		 function );
+
+		result = -1;
+	}
+	if( libexe_file_free_byte_histograms(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free byte histograms.",
+		 function );
+
+		result = -1;
+	}
+	if( libexe_file_free_section_merkle_trees(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free section Merkle trees.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_open_read(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *directory_file_io_handle                    = NULL;
+	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
+	libexe_debug_data_t *debug_data                               = NULL;
+	libexe_export_table_t *export_table                           = NULL;
+	libexe_import_table_t *import_table                           = NULL;
+	libexe_read_plan_io_handle_t *read_plan_io_handle             = NULL;
+	static char *function                                         = "libexe_file_open_read";
+	off64_t file_offset                                           = 0;
+	uint32_t relative_virtual_address                             = 0;
+	uint16_t number_of_sections                                   = 0;
+	int result                                                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libexe_io_handle_read_file_header(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sections > 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading section table:\n" );
+		}
+#endif
+		if( libexe_io_handle_read_section_table(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     number_of_sections,
+		     internal_file->sections_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read section table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The data directories are read using a read plan, which reads data directories
+	 * that are stored close together, e.g. in .rdata, with a single read
+	 */
+	if( libexe_read_plan_io_handle_initialize(
+	     &read_plan_io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read plan IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_file_append_data_directory_ranges(
+	     internal_file,
+	     read_plan_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data directory ranges to read plan.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_read_plan_io_handle_get_file_io_handle(
+	     read_plan_io_handle,
+	     &directory_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read plan file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     directory_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open read plan file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_EXPORT_TABLE ] );
+
+	if( data_directory_descriptor->size > 0 )
+	{
+		if( libexe_file_get_offset_by_relative_virtual_address(
+		     internal_file,
+		     data_directory_descriptor->virtual_address,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 data_directory_descriptor->virtual_address );
+
+			goto on_error;
+		}
+		if( libexe_export_table_initialize(
+		     &export_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_export_table_read(
+		     export_table,
+		     directory_file_io_handle,
+		     file_offset,
+		     data_directory_descriptor->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read export table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_export_table_free(
+		     &export_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free export table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_IMPORT_TABLE ] );
+
+	if( data_directory_descriptor->size > 0 )
+	{
+		if( libexe_file_get_offset_by_relative_virtual_address(
+		     internal_file,
+		     data_directory_descriptor->virtual_address,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 data_directory_descriptor->virtual_address );
+
+			goto on_error;
+		}
+		if( libexe_import_table_initialize(
+		     &import_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create import table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_import_table_read(
+		     import_table,
+		     directory_file_io_handle,
+		     file_offset,
+		     data_directory_descriptor->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read import table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_import_table_free(
+		     &import_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free import table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_DEBUG_DATA ] );
+
+	if( data_directory_descriptor->size > 0 )
+	{
+		if( libexe_file_get_offset_by_relative_virtual_address(
+		     internal_file,
+		     data_directory_descriptor->virtual_address,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 data_directory_descriptor->virtual_address );
+
+			goto on_error;
+		}
+		if( libexe_debug_data_initialize(
+		     &debug_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create debug data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_debug_data_read(
+		     debug_data,
+		     directory_file_io_handle,
+		     file_offset,
+		     data_directory_descriptor->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read debug data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_debug_data_free(
+		     &debug_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free debug data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_EXCEPTION_TABLE ] );
+
+	if( ( data_directory_descriptor->size > 0 )
+	 && ( ( internal_file->io_handle->target_architecture_type == LIBEXE_TARGET_ARCHITECTURE_TYPE_AMD64 )
+	  ||  ( internal_file->io_handle->target_architecture_type == LIBEXE_TARGET_ARCHITECTURE_TYPE_ARM64 )
+	  ||  ( internal_file->io_handle->target_architecture_type == LIBEXE_TARGET_ARCHITECTURE_TYPE_ARMNT )
+	  ||  ( internal_file->io_handle->target_architecture_type == LIBEXE_TARGET_ARCHITECTURE_TYPE_IA64 ) ) )
+	{
+		result = libexe_file_get_offset_by_relative_virtual_address(
+		          internal_file,
+		          data_directory_descriptor->virtual_address,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 data_directory_descriptor->virtual_address );
+
+			goto on_error;
+		}
+		/* The exception table is considered not available if it is not stored
+		 * in the data of a section or cannot be read, e.g. if it is truncated
+		 */
+		else if( result != 0 )
+		{
+			if( libexe_exception_table_initialize(
+			     &( internal_file->exception_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create exception table.",
+				 function );
+
+				goto on_error;
+			}
+			if( libexe_exception_table_read(
+			     internal_file->exception_table,
+			     directory_file_io_handle,
+			     file_offset,
+			     data_directory_descriptor->size,
+			     internal_file->io_handle->target_architecture_type,
+			     error ) != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				if( libexe_exception_table_free(
+				     &( internal_file->exception_table ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free exception table.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_THREAD_LOCAL_STORAGE_TABLE ] );
+
+	if( data_directory_descriptor->size > 0 )
+	{
+		result = libexe_file_get_offset_by_relative_virtual_address(
+		          internal_file,
+		          data_directory_descriptor->virtual_address,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 data_directory_descriptor->virtual_address );
+
+			goto on_error;
+		}
+		/* The TLS directory is considered not available if it is not stored
+		 * in the data of a section, e.g. in a packed executable
+		 */
+		else if( result != 0 )
+		{
+			if( libexe_tls_directory_initialize(
+			     &( internal_file->tls_directory ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create TLS directory.",
+				 function );
+
+				goto on_error;
+			}
+			if( libexe_tls_directory_read(
+			     internal_file->tls_directory,
+			     directory_file_io_handle,
+			     file_offset,
+			     internal_file->io_handle->coff_optional_header_signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read TLS directory.",
+				 function );
+
+				goto on_error;
+			}
+			/* The callbacks array is stored as a virtual address and can be stored
+			 * in data that is not backed by the file, e.g. when it is filled in by
+			 * an unpacker, in which case the callbacks cannot be read
+			 */
+			if( internal_file->tls_directory->callbacks_address != 0 )
+			{
+				result = libexe_file_get_relative_virtual_address_by_virtual_address(
+				          internal_file,
+				          internal_file->tls_directory->callbacks_address,
+				          &relative_virtual_address,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libexe_file_get_offset_by_relative_virtual_address(
+					          internal_file,
+					          relative_virtual_address,
+					          &file_offset,
+					          error );
+				}
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve offset for virtual address: 0x%08" PRIx64 ".",
+					 function,
+					 internal_file->tls_directory->callbacks_address );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					if( libexe_tls_directory_read_callbacks(
+					     internal_file->tls_directory,
+					     directory_file_io_handle,
+					     file_offset,
+					     internal_file->io_handle->coff_optional_header_signature,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read TLS callbacks.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+		}
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_LOAD_CONFIGURATION_TABLE ] );
+
+	if( data_directory_descriptor->size > 0 )
+	{
+		result = libexe_file_get_offset_by_relative_virtual_address(
+		          internal_file,
+		          data_directory_descriptor->virtual_address,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 data_directory_descriptor->virtual_address );
+
+			goto on_error;
+		}
+		/* The load configuration is considered not available if it is not stored
+		 * in the data of a section, e.g. in a packed executable
+		 */
+		else if( result != 0 )
+		{
+			if( libexe_load_configuration_initialize(
+			     &( internal_file->load_configuration ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create load configuration.",
+				 function );
+
+				goto on_error;
+			}
+			if( libexe_load_configuration_read(
+			     internal_file->load_configuration,
+			     directory_file_io_handle,
+			     (uint32_t) file_offset,
+			     data_directory_descriptor->size,
+			     internal_file->io_handle->coff_optional_header_signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read load configuration.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( ( internal_file->load_configuration->guard_flags & LIBEXE_GUARD_FLAG_CF_FUNCTION_TABLE_PRESENT ) != 0 )
+			 && ( internal_file->load_configuration->guard_cf_function_table != 0 )
+			 && ( internal_file->load_configuration->guard_cf_function_count != 0 ) )
+			{
+				/* The control flow guard function table is stored as a virtual address
+				 */
+				result = libexe_file_get_relative_virtual_address_by_virtual_address(
+				          internal_file,
+				          internal_file->load_configuration->guard_cf_function_table,
+				          &relative_virtual_address,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libexe_file_get_offset_by_relative_virtual_address(
+					          internal_file,
+					          relative_virtual_address,
+					          &file_offset,
+					          error );
+				}
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve offset for virtual address: 0x%08" PRIx64 ".",
+					 function,
+					 internal_file->load_configuration->guard_cf_function_table );
+
+					goto on_error;
+				}
+				/* The guard CF function table is left empty if it is not stored
+				 * in the data of a section or cannot be read, e.g. if it is truncated
+				 */
+				else if( result != 0 )
+				{
+					if( libexe_load_configuration_read_guard_cf_function_table(
+					     internal_file->load_configuration,
+					     directory_file_io_handle,
+					     file_offset,
+					     error ) != 1 )
+					{
+#if defined( HAVE_DEBUG_OUTPUT )
+						if( libcnotify_verbose != 0 )
+						{
+							if( ( error != NULL )
+							 && ( *error != NULL ) )
+							{
+								libcnotify_print_error_backtrace(
+								 *error );
+							}
+						}
+#endif
+						libcerror_error_free(
+						 error );
+					}
+				}
+			}
+		}
+	}
+	if( libexe_read_plan_io_handle_get_statistics(
+	     read_plan_io_handle,
+	     &( internal_file->read_plan_number_of_requested_ranges ),
+	     &( internal_file->read_plan_number_of_reads ),
+	     &( internal_file->read_plan_requested_size ),
+	     &( internal_file->read_plan_read_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read plan statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     directory_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close read plan file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The read plan IO handle is freed by the read plan file IO handle
+	 */
+	read_plan_io_handle = NULL;
+
+	if( libbfio_handle_free(
+	     &directory_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read plan file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &directory_file_io_handle,
+		 NULL );
+	}
+	else if( read_plan_io_handle != NULL )
+	{
+		libexe_read_plan_io_handle_free(
+		 &read_plan_io_handle,
+		 NULL );
+	}
+	if( internal_file->tls_directory != NULL )
+	{
+		libexe_tls_directory_free(
+		 &( internal_file->tls_directory ),
+		 NULL );
+	}
+	if( internal_file->load_configuration != NULL )
+	{
+		libexe_load_configuration_free(
+		 &( internal_file->load_configuration ),
+		 NULL );
+	}
+	if( internal_file->exception_table != NULL )
+	{
+		libexe_exception_table_free(
+		 &( internal_file->exception_table ),
+		 NULL );
+	}
+	if( debug_data != NULL )
+	{
+		libexe_debug_data_free(
+		 &debug_data,
+		 NULL );
+	}
+	if( import_table != NULL )
+	{
+		libexe_import_table_free(
+		 &import_table,
+		 NULL );
+	}
+	if( export_table != NULL )
+	{
+		libexe_export_table_free(
+		 &export_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the ranges of the data directories that are read when opening the file to a read plan
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_append_data_directory_ranges(
+     libexe_internal_file_t *internal_file,
+     libexe_read_plan_io_handle_t *read_plan_io_handle,
+     libcerror_error_t **error )
+{
+	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
+	static char *function                                         = "libexe_file_append_data_directory_ranges";
+	off64_t file_offset                                           = 0;
+	int data_directory                                            = 0;
+	int result                                                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_directory = 0;
+	     data_directory < LIBEXE_NUMBER_OF_DATA_DIRECTORIES;
+	     data_directory++ )
+	{
+		data_directory_descriptor = &( internal_file->io_handle->data_directories[ data_directory ] );
+
+		if( data_directory_descriptor->size == 0 )
+		{
+			continue;
+		}
+		switch( data_directory )
+		{
+			case LIBEXE_DATA_DIRECTORY_EXPORT_TABLE:
+			case LIBEXE_DATA_DIRECTORY_IMPORT_TABLE:
+			case LIBEXE_DATA_DIRECTORY_DEBUG_DATA:
+			case LIBEXE_DATA_DIRECTORY_THREAD_LOCAL_STORAGE_TABLE:
+			case LIBEXE_DATA_DIRECTORY_LOAD_CONFIGURATION_TABLE:
+				break;
+
+			case LIBEXE_DATA_DIRECTORY_EXCEPTION_TABLE:
+				if( ( internal_file->io_handle->target_architecture_type != LIBEXE_TARGET_ARCHITECTURE_TYPE_AMD64 )
+				 && ( internal_file->io_handle->target_architecture_type != LIBEXE_TARGET_ARCHITECTURE_TYPE_ARM64 )
+				 && ( internal_file->io_handle->target_architecture_type != LIBEXE_TARGET_ARCHITECTURE_TYPE_ARMNT )
+				 && ( internal_file->io_handle->target_architecture_type != LIBEXE_TARGET_ARCHITECTURE_TYPE_IA64 ) )
+				{
+					continue;
+				}
+				break;
+
+			default:
+				continue;
+		}
+		result = libexe_file_get_offset_by_relative_virtual_address(
+		          internal_file,
+		          data_directory_descriptor->virtual_address,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 data_directory_descriptor->virtual_address );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libexe_read_plan_io_handle_append_range(
+		     read_plan_io_handle,
+		     file_offset,
+		     (size64_t) data_directory_descriptor->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data directory: %d range.",
+			 function,
+			 data_directory );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the block cache used to read the section data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_open_block_cache(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libexe_block_cache_io_handle_t *block_cache_io_handle = NULL;
+	static char *function                                 = "libexe_file_open_block_cache";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->block_cache_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - block cache file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_block_cache_io_handle_initialize(
+	     &block_cache_io_handle,
+	     file_io_handle,
+	     internal_file->block_cache_block_size,
+	     internal_file->block_cache_maximum_number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_block_cache_io_handle_get_file_io_handle(
+	     block_cache_io_handle,
+	     &( internal_file->block_cache_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The block cache IO handle is now managed by the block cache file IO handle
+	 */
+	internal_file->block_cache_io_handle = block_cache_io_handle;
+	block_cache_io_handle                = NULL;
+
+	if( libbfio_handle_open(
+	     internal_file->block_cache_file_io_handle,
+	     LIBBFIO_ACCESS_FLAG_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open block cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->block_cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( internal_file->block_cache_file_io_handle ),
+		 NULL );
+	}
+	if( block_cache_io_handle != NULL )
+	{
+		libexe_block_cache_io_handle_free(
+		 &block_cache_io_handle,
+		 NULL );
+	}
+	internal_file->block_cache_io_handle = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves the read plan statistics of the data directories that were read when opening the file
+ * The number of requested ranges and the requested size refer to the data directories
+ * and the number of reads and the read size to the reads that were issued, where
+ * data directories stored close together are read with a single read
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_read_plan_statistics(
+     libexe_file_t *file,
+     int *number_of_requested_ranges,
+     int *number_of_reads,
+     size64_t *requested_size,
+     size64_t *read_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_read_plan_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_requested_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requested ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( requested_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid requested size.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_requested_ranges = internal_file->read_plan_number_of_requested_ranges;
+	*number_of_reads            = internal_file->read_plan_number_of_reads;
+	*requested_size             = internal_file->read_plan_requested_size;
+	*read_size                  = internal_file->read_plan_read_size;
+
+	return( 1 );
+}
+
+/* Sets the block cache used to read the section data
+ * The block cache must be set before the file is opened and applies to the sections
+ * retrieved afterwards. The section data is read in blocks of the block size that
+ * are kept in memory, so that repeated small reads of the same data hit memory
+ * A maximum number of blocks of 0 disables the block cache, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_set_block_cache(
+     libexe_file_t *file,
+     size_t block_size,
+     int maximum_number_of_blocks,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_set_block_cache";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_blocks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of blocks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_blocks > 0 )
+	{
+		if( ( block_size == 0 )
+		 || ( block_size > (size_t) LIBEXE_BLOCK_CACHE_MAXIMUM_BLOCK_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( (size64_t) block_size * maximum_number_of_blocks ) > (size64_t) LIBEXE_BLOCK_CACHE_MAXIMUM_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid block cache size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file->block_cache_block_size               = block_size;
+	internal_file->block_cache_maximum_number_of_blocks = maximum_number_of_blocks;
+
+	return( 1 );
+}
+
+/* Retrieves the block cache statistics
+ * The number of hits is the number of blocks that were read from the block cache and
+ * the number of misses the number of blocks that were read from the file IO handle
+ * Both are 0 if the block cache is disabled or the file is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_block_cache_statistics(
+     libexe_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_block_cache_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->block_cache_io_handle == NULL )
+	{
+		*number_of_hits   = 0;
+		*number_of_misses = 0;
+
+		return( 1 );
+	}
+	if( libexe_block_cache_io_handle_get_statistics(
+	     internal_file->block_cache_io_handle,
+	     number_of_hits,
+	     number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the access pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_access_pattern(
+     libexe_file_t *file,
+     int *access_pattern,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_access_pattern";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( libexe_access_advice_get_access_pattern(
+	     internal_file->access_advice,
+	     access_pattern,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the access pattern
+ * The access pattern determines the size of the reads of a pass over the file, such as
+ * when computing digests, and for a file opened by name the advice that is passed
+ * to the operating system. Sequential access requests the data ahead of the reads
+ * and one-shot access in addition releases the data that was read from the system cache
+ * The advice is only passed if the access pattern is set before the file is opened
+ * by name, otherwise the file is read using a libbfio file and only the size
+ * of the reads is affected. The same applies to a file opened from a file IO handle,
+ * a buffer or a stream, or a file opened for direct IO
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_set_access_pattern(
+     libexe_file_t *file,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_set_access_pattern";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( libexe_access_advice_set_access_pattern(
+	     internal_file->access_advice,
+	     access_pattern,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the access pattern of the data of a specific section
+ * For a file opened by name with an access pattern set before the file was opened
+ * the access pattern of the section data is passed to the operating system.
+ * Sequential and one-shot access request the section data
+ * in advance and for one-shot access the section data is released from the system
+ * cache when the file is closed. The operating system can apply the read-ahead
+ * of the access pattern to the whole file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_set_section_access_pattern(
+     libexe_file_t *file,
+     int section_index,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_set_section_access_pattern";
+	size64_t section_data_size                      = 0;
+	off64_t section_data_offset                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( ( access_pattern != LIBEXE_ACCESS_PATTERN_NORMAL )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_SEQUENTIAL )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_RANDOM )
+	 && ( access_pattern != LIBEXE_ACCESS_PATTERN_ONE_SHOT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern: %d.",
+		 function,
+		 access_pattern );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing section descriptor: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( libexe_section_descriptor_get_data_range(
+	     section_descriptor,
+	     &section_data_offset,
+	     &section_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d data range.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( section_data_size == 0 )
+	{
+		section_descriptor->access_pattern = access_pattern;
+
+		return( 1 );
+	}
+	if( libexe_access_advice_advise_access_pattern(
+	     internal_file->access_advice,
+	     section_data_offset,
+	     section_data_size,
+	     access_pattern,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise section: %d access pattern.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( ( access_pattern == LIBEXE_ACCESS_PATTERN_SEQUENTIAL )
+	 || ( access_pattern == LIBEXE_ACCESS_PATTERN_ONE_SHOT ) )
+	{
+		if( libexe_access_advice_advise_range(
+		     internal_file->access_advice,
+		     section_data_offset,
+		     section_data_size,
+		     LIBEXE_ACCESS_ADVICE_WILL_NEED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to request section: %d data in advance.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+	}
+	section_descriptor->access_pattern = access_pattern;
+
+	return( 1 );
+}
+
+/* Passes the descriptor of a file IO handle created in the library to the access advice
+ * The file IO handle must be an advice IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_open_access_advice(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libexe_advice_io_handle_t *advice_io_handle = NULL;
+	static char *function                       = "libexe_file_open_access_advice";
+	int descriptor                              = -1;
+	int result                                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_io_handle(
+	     file_io_handle,
+	     (intptr_t **) &advice_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve advice IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_advice_io_handle_get_descriptor(
+	          advice_io_handle,
+	          &descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libexe_access_advice_set_descriptor(
+		     internal_file->access_advice,
+		     descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor in access advice.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Closes the access advice
+ * The data of the sections with a one-shot access pattern is released from the system cache
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_file_close_access_advice(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_close_access_advice";
+	size64_t section_data_size                      = 0;
+	off64_t section_data_offset                     = 0;
+	int number_of_sections                          = 0;
+	int result                                      = 0;
+	int section_index                               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		result = -1;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			result = -1;
+
+			break;
+		}
+		if( ( section_descriptor == NULL )
+		 || ( section_descriptor->access_pattern != LIBEXE_ACCESS_PATTERN_ONE_SHOT ) )
+		{
+			continue;
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_data_offset,
+		     &section_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			result = -1;
+
+			break;
+		}
+		if( section_data_size == 0 )
+		{
+			continue;
+		}
+		if( libexe_access_advice_advise_range(
+		     internal_file->access_advice,
+		     section_data_offset,
+		     section_data_size,
+		     LIBEXE_ACCESS_ADVICE_DONT_NEED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release section: %d data.",
+			 function,
+			 section_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libexe_access_advice_close(
+	     internal_file->access_advice,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close access advice.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_ascii_codepage(
+     libexe_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_set_ascii_codepage(
+     libexe_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEXE_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Retrieves offset of a relative virtual address
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libexe_file_get_offset_by_relative_virtual_address(
+     libexe_internal_file_t *internal_file,
+     uint32_t virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_offset_by_relative_virtual_address";
+	size64_t section_size                           = 0;
+	int number_of_sections                          = 0;
+	int section_index                               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* In a memory image the relative virtual address is the offset
+	 */
+	if( internal_file->io_handle->is_memory_image != 0 )
+	{
+		*offset = (off64_t) virtual_address;
+
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     offset,
+		     &section_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( ( virtual_address >= section_descriptor->virtual_address )
+		 && ( ( virtual_address - section_descriptor->virtual_address ) < section_size ) )
+		{
+			*offset += virtual_address - section_descriptor->virtual_address;
+
+			return( 1 );
+		}
+	}
+	*offset = 0;
+
+	return( 0 );
+}
+
+/* Retrieves the relative virtual address of a virtual address
+ * Returns 1 if successful, 0 if the virtual address is outside the image or -1 on error
+ */
+int libexe_file_get_relative_virtual_address_by_virtual_address(
+     libexe_internal_file_t *internal_file,
+     uint64_t virtual_address,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_get_relative_virtual_address_by_virtual_address";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual address.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( virtual_address < internal_file->io_handle->image_base )
+	 || ( ( virtual_address - internal_file->io_handle->image_base ) > (uint64_t) UINT32_MAX ) )
+	{
+		*relative_virtual_address = 0;
+
+		return( 0 );
+	}
+	*relative_virtual_address = (uint32_t) ( virtual_address - internal_file->io_handle->image_base );
+
+	return( 1 );
+}
+
+/* Retrieves the range of the overlay
+ * The overlay is the data after the end of the section data, it is not available in a memory image
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_overlay_range(
+     libexe_internal_file_t *internal_file,
+     off64_t *overlay_offset,
+     size64_t *overlay_size,
+     libcerror_error_t **error )
+{
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_overlay_range";
+	size64_t file_size                              = 0;
+	size64_t section_size                           = 0;
+	off64_t section_end_offset                      = 0;
+	off64_t section_offset                          = 0;
+	int number_of_sections                          = 0;
+	int section_index                               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->is_memory_image != 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sections == 0 )
+	{
+		return( 0 );
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( ( section_offset + (off64_t) section_size ) > section_end_offset )
+		{
+			section_end_offset = section_offset + (off64_t) section_size;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) section_end_offset >= file_size )
+	{
+		return( 0 );
+	}
+	*overlay_offset = section_end_offset;
+	*overlay_size   = file_size - (size64_t) section_end_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sections
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_sections(
+     libexe_file_t *file,
+     int *number_of_sections,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_sections";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific section
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_section(
+     libexe_file_t *file,
+     int section_index,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *section_file_io_handle        = NULL;
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_section";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( *section != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid section value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	/* The section data is read using the block cache if enabled
+	 */
+	if( internal_file->block_cache_file_io_handle != NULL )
+	{
+		section_file_io_handle = internal_file->block_cache_file_io_handle;
+	}
+	else
+	{
+		section_file_io_handle = internal_file->file_io_handle;
+	}
+	if( libexe_section_initialize(
+	     section,
+	     internal_file->io_handle,
+	     section_file_io_handle,
+	     section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific section by an ASCII formatted name
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libexe_file_get_section_by_name(
+     libexe_file_t *file,
+     const char *name,
+     size_t name_length,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *section_file_io_handle        = NULL;
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_section_by_name";
+	int number_of_sections                          = 0;
+	int section_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( *section != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid section value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( section_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing section descriptor: %d.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		if( ( name_length + 1 ) == section_descriptor->name_size )
+		{
+			if( libcstring_narrow_string_compare(
+			     section_descriptor->name,
+			     name,
+			     name_length ) == 0 )
+			{
+				/* The section data is read using the block cache if enabled
+				 */
+				if( internal_file->block_cache_file_io_handle != NULL )
+				{
+					section_file_io_handle = internal_file->block_cache_file_io_handle;
+				}
+				else
+				{
+					section_file_io_handle = internal_file->file_io_handle;
+				}
+				if( libexe_section_initialize(
+				     section,
+				     internal_file->io_handle,
+				     section_file_io_handle,
+				     section_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create section.",
+					 function );
+
+					return( -1 );
+				}
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the end address of a runtime function
+ * If the end address is not stored in the exception table it is determined from
+ * the function length in the unwind information, as used by ARM and ARM64
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_runtime_function_end_address(
+     libexe_internal_file_t *internal_file,
+     libexe_runtime_function_t *runtime_function,
+     uint32_t *end_address,
+     libcerror_error_t **error )
+{
+	uint8_t unwind_information_header[ 4 ];
+
+	static char *function     = "libexe_file_get_runtime_function_end_address";
+	off64_t file_offset       = 0;
+	ssize_t read_count        = 0;
+	uint32_t function_length  = 0;
+	uint32_t instruction_size = 4;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( runtime_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid runtime function.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end address.",
+		 function );
+
+		return( -1 );
+	}
+	if( runtime_function->end_address != 0 )
+	{
+		*end_address = runtime_function->end_address;
+
+		return( 1 );
+	}
+	if( libexe_file_get_offset_by_relative_virtual_address(
+	     internal_file,
+	     runtime_function->unwind_information_address,
+	     &file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+		 function,
+		 runtime_function->unwind_information_address );
+
+		return( -1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     internal_file->file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek unwind information offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              internal_file->file_io_handle,
+	              unwind_information_header,
+	              4,
+	              error );
+
+	if( read_count != (ssize_t) 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read unwind information header.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 unwind_information_header,
+	 function_length );
+
+	/* The lower 18 bits contain the function length in number of instructions
+	 */
+	function_length &= 0x0003ffffUL;
+
+	if( internal_file->io_handle->target_architecture_type == LIBEXE_TARGET_ARCHITECTURE_TYPE_ARMNT )
+	{
+		instruction_size = 2;
+	}
+	runtime_function->end_address = runtime_function->begin_address + ( function_length * instruction_size );
+
+	*end_address = runtime_function->end_address;
+
+	return( 1 );
+}
+
+/* Retrieves the number of functions
+ * The functions are defined by the exception table (.pdata)
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_functions(
+     libexe_file_t *file,
+     int *number_of_functions,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_functions";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_functions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of functions.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->exception_table == NULL )
+	{
+		*number_of_functions = 0;
+
+		return( 1 );
+	}
+	if( libexe_exception_table_get_number_of_runtime_functions(
+	     internal_file->exception_table,
+	     number_of_functions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of runtime functions.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific function
+ * The functions are sorted by begin address
+ * The unwind information address is 0 if the unwind data is packed in the exception table
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_function(
+     libexe_file_t *file,
+     int function_index,
+     uint32_t *begin_address,
+     uint32_t *end_address,
+     uint32_t *unwind_information_address,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file       = NULL;
+	libexe_runtime_function_t *runtime_function = NULL;
+	static char *function                       = "libexe_file_get_function";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( begin_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid begin address.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_information_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information address.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_exception_table_get_runtime_function_by_index(
+	     internal_file->exception_table,
+	     function_index,
+	     &runtime_function,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve runtime function: %d.",
+		 function,
+		 function_index );
+
+		return( -1 );
+	}
+	if( libexe_file_get_runtime_function_end_address(
+	     internal_file,
+	     runtime_function,
+	     end_address,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve runtime function: %d end address.",
+		 function,
+		 function_index );
+
+		return( -1 );
+	}
+	*begin_address              = runtime_function->begin_address;
+	*unwind_information_address = runtime_function->unwind_information_address;
+
+	return( 1 );
+}
+
+/* Retrieves the function that contains a specific relative virtual address
+ * The unwind information address is 0 if the unwind data is packed in the exception table
+ * Returns 1 if successful, 0 if no such function or -1 on error
+ */
+int libexe_file_get_function_by_rva(
+     libexe_file_t *file,
+     uint32_t relative_virtual_address,
+     uint32_t *begin_address,
+     uint32_t *end_address,
+     uint32_t *unwind_information_address,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file       = NULL;
+	libexe_runtime_function_t *runtime_function = NULL;
+	static char *function                       = "libexe_file_get_function_by_rva";
+	uint32_t safe_end_address                   = 0;
+	int result                                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( begin_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid begin address.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end address.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_information_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information address.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->exception_table == NULL )
+	{
+		return( 0 );
+	}
+	result = libexe_exception_table_get_runtime_function_by_relative_virtual_address(
+	          internal_file->exception_table,
+	          relative_virtual_address,
+	          &runtime_function,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve runtime function for relative virtual address: 0x%08" PRIx32 ".",
+		 function,
+		 relative_virtual_address );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libexe_file_get_runtime_function_end_address(
+	     internal_file,
+	     runtime_function,
+	     &safe_end_address,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve runtime function end address.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_address >= safe_end_address )
+	{
+		return( 0 );
+	}
+	*begin_address              = runtime_function->begin_address;
+	*end_address                = safe_end_address;
+	*unwind_information_address = runtime_function->unwind_information_address;
+
+	return( 1 );
+}
+
+/* Retrieves the unwind information of a specific function
+ * The unwind information is read on demand and cached, unless it was already read
+ * by libexe_file_read_unwind_information
+ * This function supports the x64 (AMD64) unwind information format
+ * Returns 1 if successful, 0 if the function has no unwind information or -1 on error
+ */
+int libexe_file_get_function_unwind_information(
+     libexe_file_t *file,
+     int function_index,
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file                  = NULL;
+	libexe_runtime_function_t *runtime_function            = NULL;
+	libexe_unwind_information_t *cached_unwind_information = NULL;
+	static char *function                                  = "libexe_file_get_function_unwind_information";
+	off64_t file_offset                                    = 0;
+	int result                                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->exception_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing exception table.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unwind_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwind information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->target_architecture_type != LIBEXE_TARGET_ARCHITECTURE_TYPE_AMD64 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported target architecture type: 0x%04" PRIx16 ".",
+		 function,
+		 internal_file->io_handle->target_architecture_type );
+
+		return( -1 );
+	}
+	if( libexe_exception_table_get_runtime_function_by_index(
+	     internal_file->exception_table,
+	     function_index,
+	     &runtime_function,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve runtime function: %d.",
+		 function,
+		 function_index );
+
+		return( -1 );
+	}
+	if( runtime_function->unwind_information_address == 0 )
+	{
+		return( 0 );
+	}
+	result = libexe_exception_table_get_unwind_information_by_index(
+	          internal_file->exception_table,
+	          function_index,
+	          &cached_unwind_information,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached unwind information: %d.",
+		 function,
+		 function_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libexe_file_get_offset_by_relative_virtual_address(
+		     internal_file,
+		     runtime_function->unwind_information_address,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 runtime_function->unwind_information_address );
+
+			goto on_error;
+		}
+		if( libexe_unwind_information_initialize(
+		     &cached_unwind_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create unwind information.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_unwind_information_read_file_io_handle(
+		     cached_unwind_information,
+		     internal_file->file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unwind information: %d.",
+			 function,
+			 function_index );
+
+			goto on_error;
+		}
+		if( libexe_exception_table_set_unwind_information_by_index(
+		     internal_file->exception_table,
+		     function_index,
+		     cached_unwind_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cached unwind information: %d.",
+			 function,
+			 function_index );
+
+			goto on_error;
+		}
+	}
+	if( libexe_unwind_information_clone(
+	     unwind_information,
+	     cached_unwind_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( ( result == 0 )
+	 && ( cached_unwind_information != NULL ) )
+	{
+		libexe_unwind_information_free(
+		 &cached_unwind_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the unwind information of all functions
+ * The unwind information is read in file offset order in a single sequential pass,
+ * instead of seeking to the unwind information of every function separately
+ * Unwind information that was already read is not read again
+ * This function supports the x64 (AMD64) unwind information format
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_read_unwind_information(
+     libexe_file_t *file,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file                    = NULL;
+	libexe_runtime_function_t *runtime_function              = NULL;
+	libexe_unwind_information_location_t *locations          = NULL;
+	libexe_unwind_information_t *cached_unwind_information   = NULL;
+	libexe_unwind_information_t *previous_unwind_information = NULL;
+	libexe_unwind_information_t *unwind_information          = NULL;
+	uint8_t *buffer                                          = NULL;
+	static char *function                                    = "libexe_file_read_unwind_information";
+	off64_t buffer_offset                                    = 0;
+	off64_t file_offset                                      = 0;
+	size_t buffer_data_offset                                = 0;
+	size_t buffer_data_size                                  = 0;
+	ssize_t read_count                                       = 0;
+	int location_index                                       = 0;
+	int number_of_locations                                  = 0;
+	int number_of_runtime_functions                          = 0;
+	int result                                               = 0;
+	int runtime_function_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->exception_table == NULL )
+	{
+		return( 1 );
+	}
+	if( internal_file->io_handle->target_architecture_type != LIBEXE_TARGET_ARCHITECTURE_TYPE_AMD64 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported target architecture type: 0x%04" PRIx16 ".",
+		 function,
+		 internal_file->io_handle->target_architecture_type );
+
+		return( -1 );
+	}
+	if( libexe_exception_table_get_number_of_runtime_functions(
+	     internal_file->exception_table,
+	     &number_of_runtime_functions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of runtime functions.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_runtime_functions == 0 )
+	{
+		return( 1 );
+	}
+	locations = (libexe_unwind_information_location_t *) memory_allocate(
+	                                                      sizeof( libexe_unwind_information_location_t ) * number_of_runtime_functions );
+
+	if( locations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unwind information locations.",
+		 function );
+
+		goto on_error;
+	}
+	for( runtime_function_index = 0;
+	     runtime_function_index < number_of_runtime_functions;
+	     runtime_function_index++ )
+	{
+		if( libexe_exception_table_get_runtime_function_by_index(
+		     internal_file->exception_table,
+		     runtime_function_index,
+		     &runtime_function,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve runtime function: %d.",
+			 function,
+			 runtime_function_index );
+
+			goto on_error;
+		}
+		if( runtime_function->unwind_information_address == 0 )
+		{
+			continue;
+		}
+		result = libexe_exception_table_get_unwind_information_by_index(
+		          internal_file->exception_table,
+		          runtime_function_index,
+		          &cached_unwind_information,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached unwind information: %d.",
+			 function,
+			 runtime_function_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( libexe_file_get_offset_by_relative_virtual_address(
+		     internal_file,
+		     runtime_function->unwind_information_address,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+			 function,
+			 runtime_function->unwind_information_address );
+
+			goto on_error;
+		}
+		locations[ number_of_locations ].file_offset            = file_offset;
+		locations[ number_of_locations ].runtime_function_index = runtime_function_index;
+
+		number_of_locations++;
+	}
+	if( number_of_locations == 0 )
+	{
+		memory_free(
+		 locations );
+
+		return( 1 );
+	}
+	qsort(
+	 locations,
+	 (size_t) number_of_locations,
+	 sizeof( libexe_unwind_information_location_t ),
+	 &libexe_unwind_information_compare_locations );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBEXE_UNWIND_INFORMATION_READ_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( location_index = 0;
+	     location_index < number_of_locations;
+	     location_index++ )
+	{
+		file_offset = locations[ location_index ].file_offset;
+
+		/* Functions can share the same unwind information
+		 */
+		if( ( previous_unwind_information != NULL )
+		 && ( file_offset == locations[ location_index - 1 ].file_offset ) )
+		{
+			if( libexe_unwind_information_clone(
+			     &unwind_information,
+			     previous_unwind_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create unwind information.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Refill the buffer if the unwind information is not fully contained in it
+			 * and the end of the file has not been reached
+			 */
+			if( ( buffer_data_size == 0 )
+			 || ( file_offset < buffer_offset )
+			 || ( (size64_t) ( file_offset - buffer_offset ) >= (size64_t) buffer_data_size )
+			 || ( ( ( (size_t) ( file_offset - buffer_offset ) + LIBEXE_MAXIMUM_UNWIND_INFORMATION_SIZE ) > buffer_data_size )
+			  && ( buffer_data_size == LIBEXE_UNWIND_INFORMATION_READ_BUFFER_SIZE ) ) )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: reading unwind information data at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+					 function,
+					 file_offset,
+					 file_offset );
+				}
+#endif
+				if( libbfio_handle_seek_offset(
+				     internal_file->file_io_handle,
+				     file_offset,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek unwind information offset: %" PRIi64 ".",
+					 function,
+					 file_offset );
+
+					goto on_error;
+				}
+				read_count = libbfio_handle_read_buffer(
+				              internal_file->file_io_handle,
+				              buffer,
+				              LIBEXE_UNWIND_INFORMATION_READ_BUFFER_SIZE,
+				              error );
+
+				if( read_count <= 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read unwind information data.",
+					 function );
+
+					goto on_error;
+				}
+				buffer_offset    = file_offset;
+				buffer_data_size = (size_t) read_count;
+			}
+			buffer_data_offset = (size_t) ( file_offset - buffer_offset );
+
+			if( libexe_unwind_information_initialize(
+			     &unwind_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create unwind information.",
+				 function );
+
+				goto on_error;
+			}
+			if( libexe_unwind_information_read_data(
+			     unwind_information,
+			     &( buffer[ buffer_data_offset ] ),
+			     buffer_data_size - buffer_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read unwind information: %d.",
+				 function,
+				 locations[ location_index ].runtime_function_index );
+
+				goto on_error;
+			}
+		}
+		if( libexe_exception_table_set_unwind_information_by_index(
+		     internal_file->exception_table,
+		     locations[ location_index ].runtime_function_index,
+		     unwind_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cached unwind information: %d.",
+			 function,
+			 locations[ location_index ].runtime_function_index );
+
+			goto on_error;
+		}
+		previous_unwind_information = unwind_information;
+		unwind_information          = NULL;
+	}
+	memory_free(
+	 buffer );
+
+	memory_free(
+	 locations );
+
+	return( 1 );
+
+on_error:
+	if( unwind_information != NULL )
+	{
+		libexe_unwind_information_free(
+		 &unwind_information,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( locations != NULL )
+	{
+		memory_free(
+		 locations );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of thread local storage (TLS) callbacks
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_tls_callbacks(
+     libexe_file_t *file,
+     int *number_of_tls_callbacks,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_tls_callbacks";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_tls_callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of TLS callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->tls_directory == NULL )
+	{
+		*number_of_tls_callbacks = 0;
+
+		return( 1 );
+	}
+	if( libexe_tls_directory_get_number_of_callbacks(
+	     internal_file->tls_directory,
+	     number_of_tls_callbacks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of TLS callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the relative virtual address of a specific thread local storage (TLS) callback
+ * Returns 1 if successful, 0 if the callback is outside the image or -1 on error
+ */
+int libexe_file_get_tls_callback(
+     libexe_file_t *file,
+     int tls_callback_index,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_tls_callback";
+	uint64_t virtual_address              = 0;
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_tls_directory_get_callback_by_index(
+	     internal_file->tls_directory,
+	     tls_callback_index,
+	     &virtual_address,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve TLS callback: %d.",
+		 function,
+		 tls_callback_index );
+
+		return( -1 );
+	}
+	result = libexe_file_get_relative_virtual_address_by_virtual_address(
+	          internal_file,
+	          virtual_address,
+	          relative_virtual_address,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve relative virtual address of TLS callback: %d.",
+		 function,
+		 tls_callback_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the certificate table if not already read
+ * The certificate table is read on demand since it is stored at the end of the file
+ * and is not needed to open the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_read_certificate_table(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
+	static char *function                                         = "libexe_file_read_certificate_table";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->certificate_table != NULL )
+	{
+		return( 1 );
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_CERTIFICATE_TABLE ] );
+
+	/* The certificate table is not mapped into memory and its "virtual address"
+	 * contains a file offset, hence it is not available in a memory image
+	 */
+	if( ( data_directory_descriptor->size == 0 )
+	 || ( internal_file->io_handle->is_memory_image != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libexe_certificate_table_initialize(
+	     &( internal_file->certificate_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create certificate table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_certificate_table_read(
+	     internal_file->certificate_table,
+	     internal_file->file_io_handle,
+	     data_directory_descriptor->virtual_address,
+	     data_directory_descriptor->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read certificate table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->certificate_table != NULL )
+	{
+		libexe_certificate_table_free(
+		 &( internal_file->certificate_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of certificates
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_certificates(
+     libexe_file_t *file,
+     int *number_of_certificates,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_certificates";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_certificates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of certificates.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_file_read_certificate_table(
+	          internal_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*number_of_certificates = 0;
+
+		return( 1 );
+	}
+	if( libexe_certificate_table_get_number_of_certificates(
+	     internal_file->certificate_table,
+	     number_of_certificates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of certificates.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific certificate
+ * The data offset and size describe the range of the certificate data, e.g. a PKCS #7 signed data blob,
+ * in the file, so that the data can be accessed without being copied
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_certificate(
+     libexe_file_t *file,
+     int certificate_index,
+     uint16_t *revision,
+     uint16_t *certificate_type,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	libexe_certificate_t *certificate     = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_certificate";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( libexe_file_read_certificate_table(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	if( revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid revision.",
+		 function );
+
+		return( -1 );
+	}
+	if( certificate_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid certificate type.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_certificate_table_get_certificate_by_index(
+	     internal_file->certificate_table,
+	     certificate_index,
+	     &certificate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve certificate: %d.",
+		 function,
+		 certificate_index );
+
+		return( -1 );
+	}
+	*revision         = certificate->revision;
+	*certificate_type = certificate->certificate_type;
+	*data_offset      = (off64_t) certificate->data_offset;
+	*data_size        = (size64_t) certificate->data_size;
+
+	return( 1 );
+}
+
+/* Reads certificate data at a specific offset into a buffer
+ * The data is read from the file directly into the buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libexe_file_read_certificate_data_at_offset(
+         libexe_file_t *file,
+         int certificate_index,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libexe_certificate_t *certificate     = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_read_certificate_data_at_offset";
+	ssize_t read_count                    = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( libexe_file_read_certificate_table(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing certificate table.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_certificate_table_get_certificate_by_index(
+	     internal_file->certificate_table,
+	     certificate_index,
+	     &certificate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve certificate: %d.",
+		 function,
+		 certificate_index );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= (size64_t) certificate->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( (size64_t) certificate->data_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( certificate->data_size - (uint32_t) offset );
+	}
+	if( libbfio_handle_seek_offset(
+	     internal_file->file_io_handle,
+	     (off64_t) certificate->data_offset + offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek certificate: %d data offset: %" PRIi64 ".",
+		 function,
+		 certificate_index,
+		 offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              internal_file->file_io_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read certificate: %d data.",
+		 function,
+		 certificate_index );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves the security cookie
+ * The security cookie is stored as a virtual address
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_security_cookie(
+     libexe_file_t *file,
+     uint64_t *security_cookie,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_security_cookie";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( security_cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->load_configuration == NULL )
+	 || ( internal_file->load_configuration->security_cookie == 0 ) )
+	{
+		return( 0 );
+	}
+	*security_cookie = internal_file->load_configuration->security_cookie;
+
+	return( 1 );
+}
+
+/* Retrieves the control flow guard flags
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_guard_flags(
+     libexe_file_t *file,
+     uint32_t *guard_flags,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_guard_flags";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( guard_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid guard flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->load_configuration == NULL )
+	{
+		return( 0 );
+	}
+	*guard_flags = internal_file->load_configuration->guard_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of control flow guard functions
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_guard_cf_functions(
+     libexe_file_t *file,
+     int *number_of_guard_cf_functions,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_guard_cf_functions";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_guard_cf_functions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of guard CF functions.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->load_configuration == NULL )
+	{
+		*number_of_guard_cf_functions = 0;
+
+		return( 1 );
+	}
+	if( libexe_load_configuration_get_number_of_guard_cf_functions(
+	     internal_file->load_configuration,
+	     number_of_guard_cf_functions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of guard CF functions.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific control flow guard function
+ * The functions are sorted by relative virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_guard_cf_function(
+     libexe_file_t *file,
+     int guard_cf_function_index,
+     uint32_t *relative_virtual_address,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_guard_cf_function";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_load_configuration_get_guard_cf_function_by_index(
+	     internal_file->load_configuration,
+	     guard_cf_function_index,
+	     relative_virtual_address,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve guard CF function: %d.",
+		 function,
+		 guard_cf_function_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a relative virtual address is a valid control flow guard call target
+ * Returns 1 if the relative virtual address is a guard CF function, 0 if not or -1 on error
+ */
+int libexe_file_has_guard_cf_function(
+     libexe_file_t *file,
+     uint32_t relative_virtual_address,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_has_guard_cf_function";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->load_configuration == NULL )
+	{
+		return( 0 );
+	}
+	result = libexe_load_configuration_has_guard_cf_function(
+	          internal_file->load_configuration,
+	          relative_virtual_address,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if relative virtual address: 0x%08" PRIx32 " is a guard CF function.",
+		 function,
+		 relative_virtual_address );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a range of the file and updates the Authenticode digests
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_read_authenticode_digest_range(
+     libexe_internal_file_t *internal_file,
+     off64_t range_start,
+     off64_t range_end,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libhmac_sha1_context_t *sha1_context,
+     libhmac_sha256_context_t *sha256_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_read_authenticode_digest_range";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_start >= range_end )
+	{
+		return( 1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     internal_file->file_io_handle,
+	     range_start,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 range_start );
+
+		return( -1 );
+	}
+	while( range_start < range_end )
+	{
+		read_size = buffer_size;
+
+		if( (off64_t) read_size > ( range_end - range_start ) )
+		{
+			read_size = (size_t) ( range_end - range_start );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              internal_file->file_io_handle,
+		              buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 range_start );
+
+			return( -1 );
+		}
+		if( libexe_access_advice_read_completed(
+		     internal_file->access_advice,
+		     range_start,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pass read advice at offset: %" PRIi64 ".",
+			 function,
+			 range_start );
+
+			return( -1 );
+		}
+		if( libhmac_sha1_update(
+		     sha1_context,
+		     buffer,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA1 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( libhmac_sha256_update(
+		     sha256_context,
+		     buffer,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+		range_start += (off64_t) read_size;
+	}
+	return( 1 );
+}
+
+/* Computes the Authenticode image digests
+ * The file is read sequentially in a single pass, the checksum, the certificate table
+ * data directory entry and the certificate table are excluded from the digests
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_compute_authenticode_digests(
+     libexe_file_t *file,
+     uint8_t *sha1_hash,
+     size_t sha1_hash_size,
+     uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error )
+{
+	off64_t excluded_range_end[ 3 ];
+	off64_t excluded_range_start[ 3 ];
+
+	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
+	libexe_internal_file_t *internal_file                         = NULL;
+	libhmac_sha1_context_t *sha1_context                          = NULL;
+	libhmac_sha256_context_t *sha256_context                      = NULL;
+	uint8_t *buffer                                               = NULL;
+	static char *function                                         = "libexe_file_compute_authenticode_digests";
+	size64_t file_size                                            = 0;
+	size_t read_buffer_size                                       = 0;
+	off64_t file_offset                                           = 0;
+	int number_of_excluded_ranges                                 = 0;
+	int range_index                                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->executable_type != LIBEXE_EXECUTABLE_TYPE_PE_COFF )
+	 || ( internal_file->io_handle->checksum_offset == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported executable type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->is_memory_image != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory image.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha1_hash_size < LIBHMAC_SHA1_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid SHA1 hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha256_hash_size < LIBHMAC_SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid SHA256 hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The excluded ranges are stored in ascending order, the checksum precedes
+	 * the data directories and the certificate table is stored after the headers
+	 */
+	excluded_range_start[ number_of_excluded_ranges ] = internal_file->io_handle->checksum_offset;
+	excluded_range_end[ number_of_excluded_ranges ]   = internal_file->io_handle->checksum_offset + 4;
+
+	number_of_excluded_ranges++;
+
+	if( internal_file->io_handle->certificate_table_entry_offset != 0 )
+	{
+		excluded_range_start[ number_of_excluded_ranges ] = internal_file->io_handle->certificate_table_entry_offset;
+		excluded_range_end[ number_of_excluded_ranges ]   = internal_file->io_handle->certificate_table_entry_offset + 8;
+
+		number_of_excluded_ranges++;
+	}
+	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_CERTIFICATE_TABLE ] );
+
+	if( ( data_directory_descriptor->size > 0 )
+	 && ( (off64_t) data_directory_descriptor->virtual_address >= excluded_range_end[ number_of_excluded_ranges - 1 ] ) )
+	{
+		excluded_range_start[ number_of_excluded_ranges ] = (off64_t) data_directory_descriptor->virtual_address;
+		excluded_range_end[ number_of_excluded_ranges ]   = (off64_t) data_directory_descriptor->virtual_address + data_directory_descriptor->size;
+
+		number_of_excluded_ranges++;
+	}
+	if( libexe_access_advice_get_read_buffer_size(
+	     internal_file->access_advice,
+	     &read_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read buffer size.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * read_buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha1_initialize(
+	     &sha1_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA1 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_initialize(
+	     &sha256_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_excluded_ranges;
+	     range_index++ )
+	{
+		if( (size64_t) excluded_range_start[ range_index ] >= file_size )
+		{
+			break;
+		}
+		if( libexe_file_read_authenticode_digest_range(
+		     internal_file,
+		     file_offset,
+		     excluded_range_start[ range_index ],
+		     buffer,
+		     read_buffer_size,
+		     sha1_context,
+		     sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read digest range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		file_offset = excluded_range_end[ range_index ];
+	}
+	if( (size64_t) file_offset < file_size )
+	{
+		if( libexe_file_read_authenticode_digest_range(
+		     internal_file,
+		     file_offset,
+		     (off64_t) file_size,
+		     buffer,
+		     read_buffer_size,
+		     sha1_context,
+		     sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read trailing digest range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libhmac_sha1_finalize(
+	     sha1_context,
+	     sha1_hash,
+	     sha1_hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize SHA1 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_finalize(
+	     sha256_context,
+	     sha256_hash,
+	     sha256_hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_free(
+	     &sha256_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha1_free(
+	     &sha1_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA1 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Retrieves the checksum stored in the COFF optional header
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_checksum(
+     libexe_file_t *file,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_checksum";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->checksum_offset == 0 )
+	{
+		return( 0 );
+	}
+	*checksum = internal_file->io_handle->checksum;
+
+	return( 1 );
+}
+
+/* Computes the checksum as stored in the COFF optional header
+ * The file is read sequentially in a single pass, the checksum itself is excluded
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_compute_checksum(
+     libexe_file_t *file,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	uint8_t *buffer                       = NULL;
+	static char *function                 = "libexe_file_compute_checksum";
+	size64_t file_size                    = 0;
+	size_t read_buffer_size               = 0;
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
+	off64_t checksum_offset               = 0;
+	off64_t file_offset                   = 0;
+	uint32_t checksum_value               = 0;
+	int byte_index                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->executable_type != LIBEXE_EXECUTABLE_TYPE_PE_COFF )
+	 || ( internal_file->io_handle->checksum_offset == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported executable type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->is_memory_image != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory image.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	checksum_offset = internal_file->io_handle->checksum_offset;
+
+	if( libexe_access_advice_get_read_buffer_size(
+	     internal_file->access_advice,
+	     &read_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read buffer size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The checksum is calculated over 16-bit values, hence every buffer other
+	 * than the last one must contain a multiple of 64 bytes to ensure the next
+	 * buffer starts at an even file offset
+	 */
+	if( ( read_buffer_size == 0 )
+	 || ( ( read_buffer_size % 64 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read buffer size value not a multiple of 64.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * read_buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     internal_file->file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size64_t) file_offset < file_size )
+	{
+		read_size = read_buffer_size;
+
+		if( (size64_t) read_size > ( file_size - file_offset ) )
+		{
+			read_size = (size_t) ( file_size - file_offset );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              internal_file->file_io_handle,
+		              buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libexe_access_advice_read_completed(
+		     internal_file->access_advice,
+		     file_offset,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pass read advice at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			goto on_error;
+		}
+		/* The checksum is excluded by handling it as 0-byte values
+		 */
+		for( byte_index = 0;
+		     byte_index < 4;
+		     byte_index++ )
+		{
+			if( ( ( checksum_offset + byte_index ) >= file_offset )
+			 && ( ( checksum_offset + byte_index ) < ( file_offset + (off64_t) read_size ) ) )
+			{
+				buffer[ checksum_offset + byte_index - file_offset ] = 0;
+			}
+		}
+		if( libexe_checksum_calculate_pe_checksum(
+		     &checksum_value,
+		     buffer,
+		     read_size,
+		     checksum_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += (off64_t) read_size;
+	}
+	memory_free(
+	 buffer );
+
+	*checksum = checksum_value + (uint32_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Computes the Authenticode page hashes
+ * The pages are hashed by the number of threads, where 1 or less hashes the pages
+ * in the calling thread. Previously computed page hashes are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_compute_page_hashes(
+     libexe_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_page_hashes_t *page_hashes               = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	uint64_t *section_ranges                        = NULL;
+	static char *function                           = "libexe_file_compute_page_hashes";
+	size64_t file_size                              = 0;
+	size64_t section_size                           = 0;
+	off64_t section_offset                          = 0;
+	int number_of_sections                          = 0;
+	int section_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->executable_type != LIBEXE_EXECUTABLE_TYPE_PE_COFF )
+	 || ( internal_file->io_handle->checksum_offset == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported executable type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->is_memory_image != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory image.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sections > 0 )
+	{
+		section_ranges = (uint64_t *) memory_allocate(
+		                               sizeof( uint64_t ) * number_of_sections );
+
+		if( section_ranges == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create section ranges.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		section_ranges[ section_index ] = ( (uint64_t) ( section_offset & 0xffffffffUL ) << 32 )
+		                                | ( section_size & 0xffffffffUL );
+	}
+	if( libexe_page_hashes_initialize(
+	     &page_hashes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_page_hashes_set_layout(
+	     page_hashes,
+	     internal_file->io_handle->headers_size,
+	     section_ranges,
+	     number_of_sections,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set page hashes layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( section_ranges != NULL )
+	{
+		memory_free(
+		 section_ranges );
+
+		section_ranges = NULL;
+	}
+	if( libexe_page_hashes_set_excluded_range(
+	     page_hashes,
+	     internal_file->io_handle->checksum_offset,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checksum excluded range.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->certificate_table_entry_offset != 0 )
+	{
+		if( libexe_page_hashes_set_excluded_range(
+		     page_hashes,
+		     internal_file->io_handle->certificate_table_entry_offset,
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set certificate table entry excluded range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libexe_page_hashes_compute(
+	     page_hashes,
+	     internal_file->file_io_handle,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compute page hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->page_hashes != NULL )
+	{
+		if( libexe_page_hashes_free(
+		     &( internal_file->page_hashes ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free previous page hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->page_hashes = page_hashes;
+
+	return( 1 );
+
+on_error:
+	if( page_hashes != NULL )
+	{
+		libexe_page_hashes_free(
+		 &page_hashes,
+		 NULL );
+	}
+	if( section_ranges != NULL )
+	{
+		memory_free(
+		 section_ranges );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of Authenticode page hashes
+ * Contains 0 if the page hashes have not been computed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_page_hashes(
+     libexe_file_t *file,
+     int *number_of_page_hashes,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_page_hashes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_hashes == NULL )
+	{
+		*number_of_page_hashes = 0;
+
+		return( 1 );
+	}
+	if( libexe_page_hashes_get_number_of_pages(
+	     internal_file->page_hashes,
+	     number_of_page_hashes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific Authenticode page hash
+ * The SHA1 hash size should be at least 20 bytes and the SHA256 hash size at least 32 bytes,
+ * either hash can be NULL if not needed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_page_hash(
+     libexe_file_t *file,
+     int page_hash_index,
+     uint32_t *file_offset,
+     uint8_t *sha1_hash,
+     size_t sha1_hash_size,
+     uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_page_hash";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_page_hashes_get_page_by_index(
+	     internal_file->page_hashes,
+	     page_hash_index,
+	     file_offset,
+	     sha1_hash,
+	     sha1_hash_size,
+	     sha256_hash,
+	     sha256_hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page hash: %d.",
+		 function,
+		 page_hash_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the digests
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_free_digests(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_free_digests";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_digest != NULL )
+	{
+		if( libexe_digest_free(
+		     &( internal_file->file_digest ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file digest.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->section_digests_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_file->section_digests_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_digest_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free section digests array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->overlay_digest != NULL )
+	{
+		if( libexe_digest_free(
+		     &( internal_file->overlay_digest ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free overlay digest.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Computes the digests of the file, the sections and the overlay
+ * The file is read sequentially in a single pass and every buffer is used to update
+ * the file digest, the digests of the sections it overlaps with and the overlay digest
+ * The overlay is the data after the end of the section data, it is not available in a memory image
+ * Previously computed digests are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_compute_digests(
+     libexe_file_t *file,
+     uint32_t digest_types,
+     libcerror_error_t **error )
+{
+	libexe_digest_t *section_digest                 = NULL;
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	uint8_t *buffer                                 = NULL;
+	static char *function                           = "libexe_file_compute_digests";
+	size64_t file_size                              = 0;
+	size64_t overlay_size                           = 0;
+	size64_t section_size                           = 0;
+	size_t read_buffer_size                         = 0;
+	size_t read_size                                = 0;
+	ssize_t read_count                              = 0;
+	off64_t file_offset                             = 0;
+	off64_t overlay_offset                          = 0;
+	off64_t section_offset                          = 0;
+	int entry_index                                 = 0;
+	int number_of_sections                          = 0;
+	int result                                      = 0;
+	int section_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_types == 0 )
+	 || ( ( digest_types & ~LIBEXE_DIGEST_TYPES_SUPPORTED ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest types: 0x%08" PRIx32 ".",
+		 function,
+		 digest_types );
+
+		return( -1 );
+	}
+	if( libexe_file_free_digests(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_digest_initialize(
+	     &( internal_file->file_digest ),
+	     0,
+	     file_size,
+	     digest_types,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file digest.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->section_digests_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section digests array.",
+		 function );
+
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_digest_initialize(
+		     &section_digest,
+		     section_offset,
+		     section_size,
+		     digest_types,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create section: %d digest.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_file->section_digests_array,
+		     &entry_index,
+		     (intptr_t *) section_digest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append section: %d digest to array.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		section_digest = NULL;
+	}
+	result = libexe_file_get_overlay_range(
+	          internal_file,
+	          &overlay_offset,
+	          &overlay_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve overlay range.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libexe_digest_initialize(
+		     &( internal_file->overlay_digest ),
+		     overlay_offset,
+		     overlay_size,
+		     digest_types,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create overlay digest.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libexe_access_advice_get_read_buffer_size(
+	     internal_file->access_advice,
+	     &read_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read buffer size.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * read_buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     internal_file->file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size64_t) file_offset < file_size )
+	{
+		read_size = read_buffer_size;
+
+		if( (size64_t) read_size > ( file_size - file_offset ) )
+		{
+			read_size = (size_t) ( file_size - file_offset );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              internal_file->file_io_handle,
+		              buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libexe_access_advice_read_completed(
+		     internal_file->access_advice,
+		     file_offset,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pass read advice at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libexe_digest_update(
+		     internal_file->file_digest,
+		     buffer,
+		     read_size,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update file digest.",
+			 function );
+
+			goto on_error;
+		}
+		for( section_index = 0;
+		     section_index < number_of_sections;
+		     section_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_file->section_digests_array,
+			     section_index,
+			     (intptr_t **) &section_digest,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve section: %d digest.",
+				 function,
+				 section_index );
+
+				section_digest = NULL;
+
+				goto on_error;
+			}
+			if( libexe_digest_update(
+			     section_digest,
+			     buffer,
+			     read_size,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update section: %d digest.",
+				 function,
+				 section_index );
+
+				section_digest = NULL;
+
+				goto on_error;
+			}
+		}
+		section_digest = NULL;
+
+		if( internal_file->overlay_digest != NULL )
+		{
+			if( libexe_digest_update(
+			     internal_file->overlay_digest,
+			     buffer,
+			     read_size,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update overlay digest.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		file_offset += (off64_t) read_size;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libexe_digest_finalize(
+	     internal_file->file_digest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize file digest.",
+		 function );
+
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->section_digests_array,
+		     section_index,
+		     (intptr_t **) &section_digest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section: %d digest.",
+			 function,
+			 section_index );
+
+			section_digest = NULL;
+
+			goto on_error;
+		}
+		if( libexe_digest_finalize(
+		     section_digest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize section: %d digest.",
+			 function,
+			 section_index );
+
+			section_digest = NULL;
+
+			goto on_error;
+		}
+	}
+	section_digest = NULL;
+
+	if( internal_file->overlay_digest != NULL )
+	{
+		if( libexe_digest_finalize(
+		     internal_file->overlay_digest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize overlay digest.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( section_digest != NULL )
+	{
+		libexe_digest_free(
+		 &section_digest,
+		 NULL );
+	}
+	libexe_file_free_digests(
+	 internal_file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves a specific digest hash of the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_digest_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_digest_hash";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_digest == NULL )
+	{
+		return( 0 );
+	}
+	result = libexe_digest_get_hash(
+	          internal_file->file_digest,
+	          digest_type,
+	          hash,
+	          hash_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file digest hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific digest hash of a specific section
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_section_digest_hash(
+     libexe_file_t *file,
+     int section_index,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libexe_digest_t *section_digest       = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_section_digest_hash";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->section_digests_array == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->section_digests_array,
+	     section_index,
+	     (intptr_t **) &section_digest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d digest.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	result = libexe_digest_get_hash(
+	          section_digest,
+	          digest_type,
+	          hash,
+	          hash_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d digest hash.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific digest hash of the overlay
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_overlay_digest_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_overlay_digest_hash";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->overlay_digest == NULL )
+	{
+		return( 0 );
+	}
+	result = libexe_digest_get_hash(
+	          internal_file->overlay_digest,
+	          digest_type,
+	          hash,
+	          hash_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve overlay digest hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific fuzzy hash string of the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_fuzzy_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_fuzzy_hash";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_digest == NULL )
+	{
+		return( 0 );
+	}
+	result = libexe_digest_get_fuzzy_hash(
+	          internal_file->file_digest,
+	          digest_type,
+	          string,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file fuzzy hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific fuzzy hash string of a specific section
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_section_fuzzy_hash(
+     libexe_file_t *file,
+     int section_index,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libexe_digest_t *section_digest       = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_section_fuzzy_hash";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->section_digests_array == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->section_digests_array,
+	     section_index,
+	     (intptr_t **) &section_digest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d digest.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	result = libexe_digest_get_fuzzy_hash(
+	          section_digest,
+	          digest_type,
+	          string,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d fuzzy hash.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific fuzzy hash string of the overlay
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_overlay_fuzzy_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_overlay_fuzzy_hash";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->overlay_digest == NULL )
+	{
+		return( 0 );
+	}
+	result = libexe_digest_get_fuzzy_hash(
+	          internal_file->overlay_digest,
+	          digest_type,
+	          string,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve overlay fuzzy hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Frees the byte histograms
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_free_byte_histograms(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_free_byte_histograms";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->headers_histogram != NULL )
+	{
+		if( libexe_histogram_free(
+		     &( internal_file->headers_histogram ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free headers byte histogram.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->section_histograms_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_file->section_histograms_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_histogram_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free section byte histograms array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->overlay_histogram != NULL )
+	{
+		if( libexe_histogram_free(
+		     &( internal_file->overlay_histogram ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free overlay byte histogram.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Reads a range of the file into a byte histogram
+ * If the maximum sample size is not 0 and the range is larger, only evenly spaced chunks
+ * of LIBEXE_HISTOGRAM_SAMPLE_CHUNK_SIZE bytes, up to the maximum sample size, are read
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_read_byte_histogram(
+     libexe_internal_file_t *internal_file,
+     libexe_histogram_t *histogram,
+     off64_t range_offset,
+     size64_t range_size,
+     size64_t maximum_sample_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libexe_file_read_byte_histogram";
+	size64_t chunk_size       = 0;
+	size64_t chunk_stride     = 0;
+	size64_t number_of_chunks = 0;
+	size64_t remaining_size   = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	off64_t chunk_offset      = 0;
+	off64_t read_offset       = 0;
+	uint64_t chunk_index      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size < LIBEXE_HISTOGRAM_SAMPLE_CHUNK_SIZE )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == 0 )
+	{
+		return( 1 );
+	}
+	if( ( maximum_sample_size == 0 )
+	 || ( range_size <= maximum_sample_size ) )
+	{
+		number_of_chunks = 1;
+		chunk_size       = range_size;
+		chunk_stride     = range_size;
+	}
+	else
+	{
+		number_of_chunks = maximum_sample_size / LIBEXE_HISTOGRAM_SAMPLE_CHUNK_SIZE;
+
+		if( number_of_chunks == 0 )
+		{
+			number_of_chunks = 1;
+		}
+		chunk_size   = LIBEXE_HISTOGRAM_SAMPLE_CHUNK_SIZE;
+		chunk_stride = range_size / number_of_chunks;
+	}
+	if( chunk_size > range_size )
+	{
+		chunk_size = range_size;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset   = range_offset + (off64_t) ( chunk_index * chunk_stride );
+		remaining_size = chunk_size;
+
+		if( libbfio_handle_seek_offset(
+		     internal_file->file_io_handle,
+		     chunk_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file offset: %" PRIi64 ".",
+			 function,
+			 chunk_offset );
+
+			return( -1 );
+		}
+		read_offset = chunk_offset;
+
+		while( remaining_size > 0 )
+		{
+			read_size = buffer_size;
+
+			if( (size64_t) read_size > remaining_size )
+			{
+				read_size = (size_t) remaining_size;
+			}
+			read_count = libbfio_handle_read_buffer(
+			              internal_file->file_io_handle,
+			              buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 ".",
+				 function,
+				 read_offset );
+
+				return( -1 );
+			}
+			if( libexe_histogram_update(
+			     histogram,
+			     buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update byte histogram.",
+				 function );
+
+				return( -1 );
+			}
+			read_offset    += (off64_t) read_size;
+			remaining_size -= read_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Computes the byte histograms of the headers, the sections and the overlay
+ * If the maximum sample size is not 0, ranges larger than the maximum sample size are
+ * sampled by reading evenly spaced chunks of the range instead of the entire range
+ * The overlay is the data after the end of the section data, it is not available in a memory image
+ * Previously computed byte histograms are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_compute_byte_histograms(
+     libexe_file_t *file,
+     size64_t maximum_sample_size,
+     libcerror_error_t **error )
+{
+	libexe_histogram_t *section_histogram           = NULL;
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	uint8_t *buffer                                 = NULL;
+	static char *function                           = "libexe_file_compute_byte_histograms";
+	size64_t file_size                              = 0;
+	size64_t overlay_size                           = 0;
+	size64_t range_size                             = 0;
+	size64_t section_size                           = 0;
+	off64_t overlay_offset                          = 0;
+	off64_t section_offset                          = 0;
+	int entry_index                                 = 0;
+	int number_of_sections                          = 0;
+	int result                                      = 0;
+	int section_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_file_free_byte_histograms(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous byte histograms.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBEXE_HISTOGRAM_READ_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->headers_size > 0 )
+	{
+		range_size = (size64_t) internal_file->io_handle->headers_size;
+
+		if( range_size > file_size )
+		{
+			range_size = file_size;
+		}
+		if( libexe_histogram_initialize(
+		     &( internal_file->headers_histogram ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create headers byte histogram.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_file_read_byte_histogram(
+		     internal_file,
+		     internal_file->headers_histogram,
+		     0,
+		     range_size,
+		     maximum_sample_size,
+		     buffer,
+		     LIBEXE_HISTOGRAM_READ_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read headers byte histogram.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->section_histograms_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section byte histograms array.",
+		 function );
+
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		/* Only the part of the section data that is stored in the file is counted
+		 */
+		range_size = 0;
+
+		if( (size64_t) section_offset < file_size )
+		{
+			range_size = file_size - (size64_t) section_offset;
+
+			if( range_size > section_size )
+			{
+				range_size = section_size;
+			}
+		}
+		if( libexe_histogram_initialize(
+		     &section_histogram,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create section: %d byte histogram.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_file_read_byte_histogram(
+		     internal_file,
+		     section_histogram,
+		     section_offset,
+		     range_size,
+		     maximum_sample_size,
+		     buffer,
+		     LIBEXE_HISTOGRAM_READ_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read section: %d byte histogram.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_file->section_histograms_array,
+		     &entry_index,
+		     (intptr_t *) section_histogram,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append section: %d byte histogram to array.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		section_histogram = NULL;
+	}
+	result = libexe_file_get_overlay_range(
+	          internal_file,
+	          &overlay_offset,
+	          &overlay_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve overlay range.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libexe_histogram_initialize(
+		     &( internal_file->overlay_histogram ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create overlay byte histogram.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_file_read_byte_histogram(
+		     internal_file,
+		     internal_file->overlay_histogram,
+		     overlay_offset,
+		     overlay_size,
+		     maximum_sample_size,
+		     buffer,
+		     LIBEXE_HISTOGRAM_READ_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read overlay byte histogram.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( section_histogram != NULL )
+	{
+		libexe_histogram_free(
+		 &section_histogram,
+		 NULL );
+	}
+	libexe_file_free_byte_histograms(
+	 internal_file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the byte histogram and entropy of a range
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_byte_histogram_values(
+     libexe_histogram_t *histogram,
+     uint64_t *counts,
+     size_t number_of_counts,
+     double *entropy,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_get_byte_histogram_values";
+
+	if( libexe_histogram_get_counts(
+	     histogram,
+	     counts,
+	     number_of_counts,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte histogram counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_histogram_get_entropy(
+	     histogram,
+	     entropy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entropy.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the byte histogram and entropy of the headers
+ * The histogram must be able to contain 256 values, one for each byte value
+ * The entropy is the Shannon entropy in bits per byte
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_headers_byte_histogram(
+     libexe_file_t *file,
+     uint64_t *histogram,
+     size_t histogram_size,
+     double *entropy,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_headers_byte_histogram";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->headers_histogram == NULL )
+	{
+		return( 0 );
+	}
+	if( libexe_file_get_byte_histogram_values(
+	     internal_file->headers_histogram,
+	     histogram,
+	     histogram_size,
+	     entropy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve headers byte histogram values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the byte histogram and entropy of a specific section
+ * The histogram must be able to contain 256 values, one for each byte value
+ * The entropy is the Shannon entropy in bits per byte
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_section_byte_histogram(
+     libexe_file_t *file,
+     int section_index,
+     uint64_t *histogram,
+     size_t histogram_size,
+     double *entropy,
+     libcerror_error_t **error )
+{
+	libexe_histogram_t *section_histogram = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_section_byte_histogram";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->section_histograms_array == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->section_histograms_array,
+	     section_index,
+	     (intptr_t **) &section_histogram,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d byte histogram.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( libexe_file_get_byte_histogram_values(
+	     section_histogram,
+	     histogram,
+	     histogram_size,
+	     entropy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d byte histogram values.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the byte histogram and entropy of the overlay
+ * The histogram must be able to contain 256 values, one for each byte value
+ * The entropy is the Shannon entropy in bits per byte
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_overlay_byte_histogram(
+     libexe_file_t *file,
+     uint64_t *histogram,
+     size_t histogram_size,
+     double *entropy,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_overlay_byte_histogram";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->overlay_histogram == NULL )
+	{
+		return( 0 );
+	}
+	if( libexe_file_get_byte_histogram_values(
+	     internal_file->overlay_histogram,
+	     histogram,
+	     histogram_size,
+	     entropy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve overlay byte histogram values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the section Merkle trees
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_free_section_merkle_trees(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_free_section_merkle_trees";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->section_merkle_trees_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_file->section_merkle_trees_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_merkle_tree_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free section Merkle trees array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Computes the content defined chunking Merkle trees of the sections
+ * The section data is split into chunks at positions determined by its content,
+ * so that inserted or removed data only affects the chunks that contain it
+ * Only the part of the section data that is stored in the file is used
+ * Previously computed Merkle trees are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_compute_section_merkle_trees(
+     libexe_file_t *file,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_merkle_tree_t *merkle_tree               = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	uint8_t *buffer                                 = NULL;
+	static char *function                           = "libexe_file_compute_section_merkle_trees";
+	size64_t file_size                              = 0;
+	size64_t range_size                             = 0;
+	size64_t section_size                           = 0;
+	size_t read_size                                = 0;
+	ssize_t read_count                              = 0;
+	off64_t section_offset                          = 0;
+	int entry_index                                 = 0;
+	int number_of_sections                          = 0;
+	int section_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_file_free_section_merkle_trees(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous section Merkle trees.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->section_merkle_trees_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section Merkle trees array.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBEXE_DIGEST_READ_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		range_size = 0;
+
+		if( (size64_t) section_offset < file_size )
+		{
+			range_size = file_size - (size64_t) section_offset;
+
+			if( range_size > section_size )
+			{
+				range_size = section_size;
+			}
+		}
+		if( libexe_merkle_tree_initialize(
+		     &merkle_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create section: %d Merkle tree.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( range_size > 0 )
+		{
+			if( libbfio_handle_seek_offset(
+			     internal_file->file_io_handle,
+			     section_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek file offset: %" PRIi64 ".",
+				 function,
+				 section_offset );
+
+				goto on_error;
+			}
+		}
+		while( range_size > 0 )
+		{
+			read_size = LIBEXE_DIGEST_READ_BUFFER_SIZE;
+
+			if( (size64_t) read_size > range_size )
+			{
+				read_size = (size_t) range_size;
+			}
+			read_count = libbfio_handle_read_buffer(
+			              internal_file->file_io_handle,
+			              buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read section: %d data.",
+				 function,
+				 section_index );
+
+				goto on_error;
+			}
+			if( libexe_merkle_tree_update(
+			     merkle_tree,
+			     buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update section: %d Merkle tree.",
+				 function,
+				 section_index );
+
+				goto on_error;
+			}
+			range_size -= read_size;
+		}
+		if( libexe_merkle_tree_finalize(
+		     merkle_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to finalize section: %d Merkle tree.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_file->section_merkle_trees_array,
+		     &entry_index,
+		     (intptr_t *) merkle_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append section: %d Merkle tree to array.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		merkle_tree = NULL;
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( merkle_tree != NULL )
+	{
+		libexe_merkle_tree_free(
+		 &merkle_tree,
+		 NULL );
+	}
+	libexe_file_free_section_merkle_trees(
+	 internal_file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the Merkle tree of a specific section
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_section_merkle_tree(
+     libexe_internal_file_t *internal_file,
+     int section_index,
+     libexe_merkle_tree_t **merkle_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_get_section_merkle_tree";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->section_merkle_trees_array == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->section_merkle_trees_array,
+	     section_index,
+	     (intptr_t **) merkle_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d Merkle tree.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the Merkle tree root hash of a specific section
+ * The hash must be able to contain 32 bytes
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_section_merkle_tree_root_hash(
+     libexe_file_t *file,
+     int section_index,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libexe_merkle_tree_t *merkle_tree = NULL;
+	static char *function             = "libexe_file_get_section_merkle_tree_root_hash";
+	int result                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_file_get_section_merkle_tree(
+	          (libexe_internal_file_t *) file,
+	          section_index,
+	          &merkle_tree,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libexe_merkle_tree_get_root_hash(
+	          merkle_tree,
+	          hash,
+	          hash_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d Merkle tree root hash.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the serialized Merkle tree data of a specific section
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_section_merkle_tree_data_size(
+     libexe_file_t *file,
+     int section_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libexe_merkle_tree_t *merkle_tree = NULL;
+	static char *function             = "libexe_file_get_section_merkle_tree_data_size";
+	int result                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_file_get_section_merkle_tree(
+	          (libexe_internal_file_t *) file,
+	          section_index,
+	          &merkle_tree,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( libexe_merkle_tree_get_data_size(
+	     merkle_tree,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d Merkle tree data size.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the serialized Merkle tree data of a specific section
+ * The data can be compared with libexe_merkle_tree_data_get_next_differing_chunk
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_file_get_section_merkle_tree_data(
+     libexe_file_t *file,
+     int section_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libexe_merkle_tree_t *merkle_tree = NULL;
+	static char *function             = "libexe_file_get_section_merkle_tree_data";
+	int result                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_file_get_section_merkle_tree(
+	          (libexe_internal_file_t *) file,
+	          section_index,
+	          &merkle_tree,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( libexe_merkle_tree_get_data(
+	     merkle_tree,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d Merkle tree data.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Extracts the printable strings of a range of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_extract_strings_from_range(
+     libexe_internal_file_t *internal_file,
+     off64_t range_offset,
+     size64_t range_size,
+     uint32_t relative_virtual_address,
+     uint8_t string_types,
+     size_t minimum_length,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_string_extractor_t *string_extractor = NULL;
+	uint8_t *buffer                             = NULL;
+	static char *function                       = "libexe_file_extract_strings_from_range";
+	size_t read_size                            = 0;
+	ssize_t read_count                          = 0;
+	int result                                  = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_string_extractor_initialize(
+	     &string_extractor,
+	     string_types,
+	     minimum_length,
+	     range_offset,
+	     relative_virtual_address,
+	     string_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string extractor.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_sections > 0 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading section table:\n" );
-		}
-#endif
-		if( libexe_io_handle_read_section_table(
-		     internal_file->io_handle,
-		     file_io_handle,
-		     number_of_sections,
-		     internal_file->sections_array,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read section table.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_EXPORT_TABLE ] );
-
-	if( data_directory_descriptor->size > 0 )
+	if( range_size > 0 )
 	{
-		if( libexe_file_get_offset_by_relative_virtual_address(
-		     internal_file,
-		     data_directory_descriptor->virtual_address,
-		     &file_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
-			 function,
-			 data_directory_descriptor->virtual_address );
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * LIBEXE_STRING_EXTRACTOR_READ_BUFFER_SIZE );
 
-			goto on_error;
-		}
-		if( libexe_export_table_initialize(
-		     &export_table,
-		     error ) != 1 )
+		if( buffer == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create export table.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
 			 function );
 
 			goto on_error;
 		}
-		if( libexe_export_table_read(
-		     export_table,
-		     file_io_handle,
-		     file_offset,
-		     data_directory_descriptor->size,
-		     error ) != 1 )
+		if( libbfio_handle_seek_offset(
+		     internal_file->file_io_handle,
+		     range_offset,
+		     SEEK_SET,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read export table.",
-			 function );
-
-			goto on_error;
-		}
-		if( libexe_export_table_free(
-		     &export_table,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free export table.",
-			 function );
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file offset: %" PRIi64 ".",
+			 function,
+			 range_offset );
 
 			goto on_error;
 		}
 	}
-	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_IMPORT_TABLE ] );
-
-	if( data_directory_descriptor->size > 0 )
+	while( ( result == 1 )
+	    && ( range_size > 0 ) )
 	{
-		if( libexe_file_get_offset_by_relative_virtual_address(
-		     internal_file,
-		     data_directory_descriptor->virtual_address,
-		     &file_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
-			 function,
-			 data_directory_descriptor->virtual_address );
+		read_size = LIBEXE_STRING_EXTRACTOR_READ_BUFFER_SIZE;
 
-			goto on_error;
-		}
-		if( libexe_import_table_initialize(
-		     &import_table,
-		     error ) != 1 )
+		if( (size64_t) read_size > range_size )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create import table.",
-			 function );
-
-			goto on_error;
+			read_size = (size_t) range_size;
 		}
-		if( libexe_import_table_read(
-		     import_table,
-		     file_io_handle,
-		     file_offset,
-		     data_directory_descriptor->size,
-		     error ) != 1 )
+		read_count = libbfio_handle_read_buffer(
+		              internal_file->file_io_handle,
+		              buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read import table.",
+			 "%s: unable to read data.",
 			 function );
 
 			goto on_error;
 		}
-		if( libexe_import_table_free(
-		     &import_table,
-		     error ) != 1 )
+		result = libexe_string_extractor_update(
+		          string_extractor,
+		          buffer,
+		          read_size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free import table.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update string extractor.",
 			 function );
 
 			goto on_error;
 		}
+		range_size -= read_size;
 	}
-	data_directory_descriptor = &( internal_file->io_handle->data_directories[ LIBEXE_DATA_DIRECTORY_DEBUG_DATA ] );
-
-	if( data_directory_descriptor->size > 0 )
+	if( result == 1 )
 	{
-		if( libexe_file_get_offset_by_relative_virtual_address(
-		     internal_file,
-		     data_directory_descriptor->virtual_address,
-		     &file_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
-			 function,
-			 data_directory_descriptor->virtual_address );
-
-			goto on_error;
-		}
-		if( libexe_debug_data_initialize(
-		     &debug_data,
-		     error ) != 1 )
+		if( libexe_string_extractor_finalize(
+		     string_extractor,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create debug data.",
-			 function );
-
-			goto on_error;
-		}
-		if( libexe_debug_data_read(
-		     debug_data,
-		     file_io_handle,
-		     file_offset,
-		     data_directory_descriptor->size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read debug data.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to finalize string extractor.",
 			 function );
 
 			goto on_error;
 		}
-		if( libexe_debug_data_free(
-		     &debug_data,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free debug data.",
-			 function );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( libexe_string_extractor_free(
+	     &string_extractor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free string extractor.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
 	return( 1 );
 
 on_error:
-	if( debug_data != NULL )
-	{
-		libexe_debug_data_free(
-		 &debug_data,
-		 NULL );
-	}
-	if( import_table != NULL )
+	if( buffer != NULL )
 	{
-		libexe_import_table_free(
-		 &import_table,
-		 NULL );
+		memory_free(
+		 buffer );
 	}
-	if( export_table != NULL )
+	if( string_extractor != NULL )
 	{
-		libexe_export_table_free(
-		 &export_table,
+		libexe_string_extractor_free(
+		 &string_extractor,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the file ASCII codepage
+/* Extracts the printable strings of a specific section
+ * The string types is a combination of LIBEXE_STRING_TYPE_ASCII and LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN
+ * The string callback is called for every string of at least the minimum length with
+ * the string, its length in characters, its file offset and relative virtual address
+ * UTF-16 little-endian strings are passed to the string callback as ASCII strings
+ * The string callback returns 1 to continue, 0 to stop or -1 on error
+ * Only the part of the section data that is stored in the file is used
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_get_ascii_codepage(
+int libexe_file_extract_section_strings(
      libexe_file_t *file,
-     int *ascii_codepage,
+     int section_index,
+     uint8_t string_types,
+     size_t minimum_length,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_get_ascii_codepage";
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_extract_section_strings";
+	size64_t file_size                              = 0;
+	size64_t range_size                             = 0;
+	size64_t section_size                           = 0;
+	off64_t section_offset                          = 0;
 
 	if( file == NULL )
 	{
@@ -1133,43 +9941,119 @@ int libexe_file_get_ascii_codepage(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( libexe_section_descriptor_get_data_range(
+	     section_descriptor,
+	     &section_offset,
+	     &section_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d data range.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	if( (size64_t) section_offset < file_size )
+	{
+		range_size = file_size - (size64_t) section_offset;
+
+		if( range_size > section_size )
+		{
+			range_size = section_size;
+		}
+	}
+	if( libexe_file_extract_strings_from_range(
+	     internal_file,
+	     section_offset,
+	     range_size,
+	     section_descriptor->virtual_address,
+	     string_types,
+	     minimum_length,
+	     string_callback,
+	     callback_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to extract section: %d strings.",
+		 function,
+		 section_index );
 
 		return( -1 );
 	}
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
-
 	return( 1 );
 }
 
-/* Sets the file ASCII codepage
- * Returns 1 if successful or -1 on error
+/* Extracts the printable strings of the overlay
+ * The overlay is not mapped into memory, the relative virtual address passed to the string callback is 0
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libexe_file_set_ascii_codepage(
+int libexe_file_extract_overlay_strings(
      libexe_file_t *file,
-     int ascii_codepage,
+     uint8_t string_types,
+     size_t minimum_length,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_set_ascii_codepage";
+	static char *function                 = "libexe_file_extract_overlay_strings";
+	size64_t overlay_size                 = 0;
+	off64_t overlay_offset                = 0;
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1184,61 +10068,66 @@ int libexe_file_set_ascii_codepage(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	result = libexe_file_get_overlay_range(
+	          internal_file,
+	          &overlay_offset,
+	          &overlay_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve overlay range.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBEXE_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1258 ) )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libexe_file_extract_strings_from_range(
+	     internal_file,
+	     overlay_offset,
+	     overlay_size,
+	     0,
+	     string_types,
+	     minimum_length,
+	     string_callback,
+	     callback_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to extract overlay strings.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
-
 	return( 1 );
 }
 
-/* Retrieves offset of a relative virtual address
- * Returns 1 if successful, 0 if no such section or -1 on error
+/* Retrieves the index and relative virtual address of the section that contains a specific offset
+ * Returns 1 if successful, 0 if the offset is not part of a section or -1 on error
  */
-int libexe_file_get_offset_by_relative_virtual_address(
+int libexe_file_get_section_index_by_offset(
      libexe_internal_file_t *internal_file,
-     uint32_t virtual_address,
-     off64_t *offset,
+     off64_t offset,
+     int *section_index,
+     uint32_t *relative_virtual_address,
      libcerror_error_t **error )
 {
 	libexe_section_descriptor_t *section_descriptor = NULL;
-	static char *function                           = "libexe_file_get_offset_by_relative_virtual_address";
+	static char *function                           = "libexe_file_get_section_index_by_offset";
 	size64_t section_size                           = 0;
+	off64_t section_offset                          = 0;
 	int number_of_sections                          = 0;
-	int section_index                               = 0;
+	int safe_section_index                          = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1251,13 +10140,24 @@ int libexe_file_get_offset_by_relative_virtual_address(
 
 		return( -1 );
 	}
-	if( offset == NULL )
+	if( section_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid section index.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual address.",
 		 function );
 
 		return( -1 );
@@ -1276,13 +10176,13 @@ int libexe_file_get_offset_by_relative_virtual_address(
 
 		return( -1 );
 	}
-	for( section_index = 0;
-	     section_index < number_of_sections;
-	     section_index++ )
+	for( safe_section_index = 0;
+	     safe_section_index < number_of_sections;
+	     safe_section_index++ )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     internal_file->sections_array,
-		     section_index,
+		     safe_section_index,
 		     (intptr_t **) &section_descriptor,
 		     error ) != 1 )
 		{
@@ -1292,13 +10192,13 @@ int libexe_file_get_offset_by_relative_virtual_address(
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve section descriptor: %d.",
 			 function,
-			 section_index );
+			 safe_section_index );
 
 			return( -1 );
 		}
 		if( libexe_section_descriptor_get_data_range(
 		     section_descriptor,
-		     offset,
+		     &section_offset,
 		     &section_size,
 		     error ) != 1 )
 		{
@@ -1308,57 +10208,385 @@ int libexe_file_get_offset_by_relative_virtual_address(
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve section descriptor: %d data range.",
 			 function,
-			 section_index );
+			 safe_section_index );
 
 			return( -1 );
 		}
-		if( ( virtual_address >= section_descriptor->virtual_address )
-		 && ( ( virtual_address - section_descriptor->virtual_address ) < section_size ) )
+		if( ( offset >= section_offset )
+		 && ( (size64_t) ( offset - section_offset ) < section_size ) )
 		{
-			*offset += virtual_address - section_descriptor->virtual_address;
+			*section_index            = safe_section_index;
+			*relative_virtual_address = section_descriptor->virtual_address + (uint32_t) ( offset - section_offset );
 
 			return( 1 );
 		}
 	}
-	*offset = 0;
-
 	return( 0 );
 }
 
-/* Retrieves the number of sections
+/* Scans a range of the file for the patterns of a compiled pattern set
+ * If the section index is -1 the section of every match is looked up
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_get_number_of_sections(
+int libexe_file_scan_range(
+     libexe_internal_file_t *internal_file,
+     libexe_internal_pattern_set_t *internal_pattern_set,
+     off64_t range_offset,
+     size64_t range_size,
+     int section_index,
+     uint32_t relative_virtual_address,
+     int (*match_callback)(
+            int pattern_index,
+            off64_t file_offset,
+            int section_index,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_pattern_match_state_t match_state;
+
+	uint8_t *buffer                   = NULL;
+	static char *function             = "libexe_file_scan_range";
+	size_t buffer_data_size           = 0;
+	size_t carry_size                 = 0;
+	size_t match_offset               = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	off64_t buffer_offset             = 0;
+	off64_t match_file_offset         = 0;
+	uint32_t match_virtual_address    = 0;
+	int match_section_index           = 0;
+	int pattern_index                 = 0;
+	int result                        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pattern_set->is_compiled == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pattern set - not compiled.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == 0 )
+	{
+		return( 1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBEXE_PATTERN_SET_READ_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     internal_file->file_io_handle,
+	     range_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file offset: %" PRIi64 ".",
+		 function,
+		 range_offset );
+
+		goto on_error;
+	}
+	buffer_offset = range_offset;
+
+	while( range_size > 0 )
+	{
+		read_size = LIBEXE_PATTERN_SET_READ_BUFFER_SIZE - carry_size;
+
+		if( (size64_t) read_size > range_size )
+		{
+			read_size = (size_t) range_size;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              internal_file->file_io_handle,
+		              &( buffer[ carry_size ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_data_size = carry_size + read_size;
+		range_size      -= read_size;
+
+		/* Matches that end in the carried over data were returned for the previous buffer
+		 */
+		libexe_pattern_set_initialize_match_state(
+		 &match_state,
+		 carry_size );
+
+		do
+		{
+			result = libexe_pattern_set_get_next_match(
+			          internal_pattern_set,
+			          buffer,
+			          buffer_data_size,
+			          &match_state,
+			          &pattern_index,
+			          &match_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next match.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			match_file_offset = buffer_offset + (off64_t) match_offset;
+
+			if( section_index == -1 )
+			{
+				match_section_index   = -1;
+				match_virtual_address = 0;
+
+				if( libexe_file_get_section_index_by_offset(
+				     internal_file,
+				     match_file_offset,
+				     &match_section_index,
+				     &match_virtual_address,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve section of offset: %" PRIi64 ".",
+					 function,
+					 match_file_offset );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				match_section_index   = section_index;
+				match_virtual_address = relative_virtual_address + (uint32_t) ( match_file_offset - range_offset );
+			}
+			result = match_callback(
+			          pattern_index,
+			          match_file_offset,
+			          match_section_index,
+			          match_virtual_address,
+			          callback_data );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: match callback failed for match at offset: %" PRIi64 ".",
+				 function,
+				 match_file_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				range_size = 0;
+
+				break;
+			}
+		}
+		while( result == 1 );
+
+		/* Carry over the data that can contain the start of a match that does not fit in the buffer
+		 */
+		if( range_size > 0 )
+		{
+			carry_size = internal_pattern_set->maximum_pattern_size - 1;
+
+			if( carry_size > buffer_data_size )
+			{
+				carry_size = buffer_data_size;
+			}
+			if( memory_copy(
+			     buffer,
+			     &( buffer[ buffer_data_size - carry_size ] ),
+			     carry_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy carry over data.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset += (off64_t) ( buffer_data_size - carry_size );
+		}
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Scans the entire file for the patterns of a compiled pattern set
+ * The match callback is called for every match with the index of the pattern, the file offset
+ * and the index and relative virtual address of the section that contains the match
+ * For data outside the sections the section index is -1 and the relative virtual address is 0
+ * The match callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_scan(
      libexe_file_t *file,
-     int *number_of_sections,
+     libexe_pattern_set_t *pattern_set,
+     int (*match_callback)(
+            int pattern_index,
+            off64_t file_offset,
+            int section_index,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_get_number_of_sections";
+	static char *function                 = "libexe_file_scan";
+	size64_t file_size                    = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
 
-	if( file == NULL )
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libexe_internal_file_t *) file;
-
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->sections_array,
-	     number_of_sections,
+	if( libexe_file_scan_range(
+	     internal_file,
+	     (libexe_internal_pattern_set_t *) pattern_set,
+	     0,
+	     file_size,
+	     -1,
+	     0,
+	     match_callback,
+	     callback_data,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sections.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan file.",
 		 function );
 
 		return( -1 );
@@ -1366,18 +10594,30 @@ int libexe_file_get_number_of_sections(
 	return( 1 );
 }
 
-/* Retrieves a specific section
+/* Scans a specific section for the patterns of a compiled pattern set
+ * Only the part of the section data that is stored in the file is scanned
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_get_section(
+int libexe_file_scan_section(
      libexe_file_t *file,
      int section_index,
-     libexe_section_t **section,
+     libexe_pattern_set_t *pattern_set,
+     int (*match_callback)(
+            int pattern_index,
+            off64_t file_offset,
+            int section_index,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libexe_internal_file_t *internal_file           = NULL;
 	libexe_section_descriptor_t *section_descriptor = NULL;
-	static char *function                           = "libexe_file_get_section";
+	static char *function                           = "libexe_file_scan_section";
+	size64_t file_size                              = 0;
+	size64_t range_size                             = 0;
+	size64_t section_size                           = 0;
+	off64_t section_offset                          = 0;
 
 	if( file == NULL )
 	{
@@ -1392,78 +10632,136 @@ int libexe_file_get_section(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( section == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid section.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *section != NULL )
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid section value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->sections_array,
-	     section_index,
-	     (intptr_t **) &section_descriptor,
+	if( libexe_section_descriptor_get_data_range(
+	     section_descriptor,
+	     &section_offset,
+	     &section_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve section descriptor: %d.",
+		 "%s: unable to retrieve section descriptor: %d data range.",
 		 function,
 		 section_index );
 
 		return( -1 );
 	}
-	if( libexe_section_initialize(
-	     section,
-	     internal_file->io_handle,
+	if( libbfio_handle_get_size(
 	     internal_file->file_io_handle,
-	     section_descriptor,
+	     &file_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create section.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
 		 function );
 
 		return( -1 );
 	}
+	if( (size64_t) section_offset < file_size )
+	{
+		range_size = file_size - (size64_t) section_offset;
+
+		if( range_size > section_size )
+		{
+			range_size = section_size;
+		}
+	}
+	if( libexe_file_scan_range(
+	     internal_file,
+	     (libexe_internal_pattern_set_t *) pattern_set,
+	     section_offset,
+	     range_size,
+	     section_index,
+	     section_descriptor->virtual_address,
+	     match_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan section: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves a specific section by an ASCII formatted name
- * Returns 1 if successful, 0 if no such section or -1 on error
+/* Reads the data of the sections in ascending file offset order
+ * The data callback is called for every part of the section data that is read with
+ * the section index, the offset of the data relative to the start of the section,
+ * the data and its size. The data is only valid during the data callback
+ * The data callback returns 1 to continue, 0 to stop or -1 on error
+ * Only the part of the section data that is stored in the file is read
+ * On a file opened from a stream only the section data that is still buffered can be read,
+ * use the data callback of libexe_file_open_stream to read the section data in a single pass
+ * Returns 1 if successful or -1 on error
  */
-int libexe_file_get_section_by_name(
+int libexe_file_stream_section_data(
      libexe_file_t *file,
-     const char *name,
-     size_t name_length,
-     libexe_section_t **section,
+     int (*data_callback)(
+            int section_index,
+            off64_t section_data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libexe_internal_file_t *internal_file           = NULL;
 	libexe_section_descriptor_t *section_descriptor = NULL;
-	static char *function                           = "libexe_file_get_section_by_name";
+	uint8_t *buffer                                 = NULL;
+	off64_t *section_offsets                        = NULL;
+	size64_t *section_sizes                         = NULL;
+	int *section_indexes                            = NULL;
+	static char *function                           = "libexe_file_stream_section_data";
+	size64_t file_size                              = 0;
+	size64_t remaining_size                         = 0;
+	size64_t section_size                           = 0;
+	size_t read_size                                = 0;
+	ssize_t read_count                              = 0;
+	off64_t section_data_offset                     = 0;
+	off64_t section_offset                          = 0;
+	int entry_index                                 = 0;
 	int number_of_sections                          = 0;
+	int result                                      = 1;
 	int section_index                               = 0;
+	int sort_index                                  = 0;
 
 	if( file == NULL )
 	{
@@ -1478,64 +10776,105 @@ int libexe_file_get_section_by_name(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( name == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( name_length > (size_t) SSIZE_MAX )
+	if( data_callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid name length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data callback.",
 		 function );
 
 		return( -1 );
 	}
-	if( section == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid section.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *section != NULL )
+	if( number_of_sections <= 0 )
+	{
+		return( 1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid section value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->sections_array,
-	     &number_of_sections,
-	     error ) != 1 )
+	section_indexes = (int *) memory_allocate(
+	                           sizeof( int ) * number_of_sections );
+
+	if( section_indexes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sections.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create section indexes.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	section_offsets = (off64_t *) memory_allocate(
+	                               sizeof( off64_t ) * number_of_sections );
+
+	if( section_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create section offsets.",
+		 function );
+
+		goto on_error;
+	}
+	section_sizes = (size64_t *) memory_allocate(
+	                              sizeof( size64_t ) * number_of_sections );
+
+	if( section_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create section sizes.",
+		 function );
+
+		goto on_error;
 	}
+	/* Sort the sections by file offset using insertion sort
+	 * the number of sections is small and the section table is mostly sorted
+	 */
 	for( section_index = 0;
 	     section_index < number_of_sections;
 	     section_index++ )
@@ -1554,47 +10893,178 @@ int libexe_file_get_section_by_name(
 			 function,
 			 section_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( section_descriptor == NULL )
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &section_offset,
+		     &section_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing section descriptor: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
 			 function,
 			 section_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( name_length + 1 ) == section_descriptor->name_size )
+		if( ( section_offset < 0 )
+		 || ( (size64_t) section_offset >= file_size ) )
 		{
-			if( libcstring_narrow_string_compare(
-			     section_descriptor->name,
-			     name,
-			     name_length ) == 0 )
+			section_size = 0;
+		}
+		else if( section_size > ( file_size - (size64_t) section_offset ) )
+		{
+			section_size = file_size - (size64_t) section_offset;
+		}
+		for( sort_index = entry_index;
+		     sort_index > 0;
+		     sort_index-- )
+		{
+			if( section_offsets[ sort_index - 1 ] <= section_offset )
 			{
-				if( libexe_section_initialize(
-				     section,
-				     internal_file->io_handle,
-				     internal_file->file_io_handle,
-				     section_descriptor,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create section.",
-					 function );
+				break;
+			}
+			section_indexes[ sort_index ] = section_indexes[ sort_index - 1 ];
+			section_offsets[ sort_index ] = section_offsets[ sort_index - 1 ];
+			section_sizes[ sort_index ]   = section_sizes[ sort_index - 1 ];
+		}
+		section_indexes[ sort_index ] = section_index;
+		section_offsets[ sort_index ] = section_offset;
+		section_sizes[ sort_index ]   = section_size;
 
-					return( -1 );
-				}
-				return( 1 );
+		entry_index++;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBEXE_SECTION_DATA_READ_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     ( result == 1 )
+	  && ( entry_index < number_of_sections );
+	     entry_index++ )
+	{
+		remaining_size = section_sizes[ entry_index ];
+
+		if( remaining_size == 0 )
+		{
+			continue;
+		}
+		if( libbfio_handle_seek_offset(
+		     internal_file->file_io_handle,
+		     section_offsets[ entry_index ],
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file offset: %" PRIi64 ".",
+			 function,
+			 section_offsets[ entry_index ] );
+
+			goto on_error;
+		}
+		section_data_offset = 0;
+
+		while( ( result == 1 )
+		    && ( remaining_size > 0 ) )
+		{
+			read_size = LIBEXE_SECTION_DATA_READ_BUFFER_SIZE;
+
+			if( (size64_t) read_size > remaining_size )
+			{
+				read_size = (size_t) remaining_size;
+			}
+			read_count = libbfio_handle_read_buffer(
+			              internal_file->file_io_handle,
+			              buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read section: %d data.",
+				 function,
+				 section_indexes[ entry_index ] );
+
+				goto on_error;
+			}
+			result = data_callback(
+			          section_indexes[ entry_index ],
+			          section_data_offset,
+			          buffer,
+			          read_size,
+			          callback_data );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: data callback failed.",
+				 function );
+
+				goto on_error;
 			}
+			section_data_offset += (off64_t) read_size;
+			remaining_size      -= read_size;
 		}
 	}
-	return( 0 );
+	memory_free(
+	 buffer );
+
+	memory_free(
+	 section_sizes );
+
+	memory_free(
+	 section_offsets );
+
+	memory_free(
+	 section_indexes );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( section_sizes != NULL )
+	{
+		memory_free(
+		 section_sizes );
+	}
+	if( section_offsets != NULL )
+	{
+		memory_free(
+		 section_offsets );
+	}
+	if( section_indexes != NULL )
+	{
+		memory_free(
+		 section_indexes );
+	}
+	return( -1 );
 }
 
@@ -25,11 +25,25 @@
 #include <common.h>
 #include <types.h>
 
+#include "libexe_access_advice.h"
+#include "libexe_block_cache_io_handle.h"
+#include "libexe_certificate_table.h"
+#include "libexe_digest.h"
+#include "libexe_exception_table.h"
 #include "libexe_extern.h"
+#include "libexe_histogram.h"
 #include "libexe_io_handle.h"
 #include "libexe_libbfio.h"
 #include "libexe_libcdata.h"
 #include "libexe_libcerror.h"
+#include "libexe_libhmac.h"
+#include "libexe_load_configuration.h"
+#include "libexe_merkle_tree.h"
+#include "libexe_page_hashes.h"
+#include "libexe_pattern_set.h"
+#include "libexe_read_plan_io_handle.h"
+#include "libexe_string_extractor.h"
+#include "libexe_tls_directory.h"
 #include "libexe_types.h"
 
 #if defined( __cplusplus )
@@ -56,9 +70,110 @@ struct libexe_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* Value to indicate if the file IO handle is a forward-only stream
+	 */
+	uint8_t file_io_handle_is_stream;
+
+	/* The section data callback of a file opened from a stream
+	 */
+	int (*stream_data_callback)(
+	       int section_index,
+	       off64_t section_data_offset,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_data );
+
+	/* The section data callback data of a file opened from a stream
+	 */
+	void *stream_data_callback_data;
+
 	/* The sections array
 	 */
 	libcdata_array_t *sections_array;
+
+	/* The exception table
+	 */
+	libexe_exception_table_t *exception_table;
+
+	/* The certificate table
+	 */
+	libexe_certificate_table_t *certificate_table;
+
+	/* The load configuration
+	 */
+	libexe_load_configuration_t *load_configuration;
+
+	/* The thread local storage (TLS) directory
+	 */
+	libexe_tls_directory_t *tls_directory;
+
+	/* The Authenticode page hashes
+	 */
+	libexe_page_hashes_t *page_hashes;
+
+	/* The digest of the file
+	 */
+	libexe_digest_t *file_digest;
+
+	/* The digests of the sections
+	 */
+	libcdata_array_t *section_digests_array;
+
+	/* The digest of the overlay
+	 */
+	libexe_digest_t *overlay_digest;
+
+	/* The byte histogram of the headers
+	 */
+	libexe_histogram_t *headers_histogram;
+
+	/* The byte histograms of the sections
+	 */
+	libcdata_array_t *section_histograms_array;
+
+	/* The byte histogram of the overlay
+	 */
+	libexe_histogram_t *overlay_histogram;
+
+	/* The content defined chunking Merkle trees of the sections
+	 */
+	libcdata_array_t *section_merkle_trees_array;
+
+	/* The number of ranges requested by the read plan of the data directories
+	 */
+	int read_plan_number_of_requested_ranges;
+
+	/* The number of reads issued by the read plan of the data directories
+	 */
+	int read_plan_number_of_reads;
+
+	/* The size of the data requested by the read plan of the data directories
+	 */
+	size64_t read_plan_requested_size;
+
+	/* The size of the data read by the read plan of the data directories
+	 */
+	size64_t read_plan_read_size;
+
+	/* The block size of the block cache
+	 */
+	size_t block_cache_block_size;
+
+	/* The maximum number of blocks of the block cache, 0 if the block cache is disabled
+	 */
+	int block_cache_maximum_number_of_blocks;
+
+	/* The block cache IO handle, which is managed by the block cache file IO handle
+	 */
+	libexe_block_cache_io_handle_t *block_cache_io_handle;
+
+	/* The block cache file IO handle used to read the section data
+	 */
+	libbfio_handle_t *block_cache_file_io_handle;
+
+	/* The access advice
+	 */
+	libexe_access_advice_t *access_advice;
 };
 
 LIBEXE_EXTERN \
@@ -94,6 +209,45 @@ int libexe_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBEXE_EXTERN \
+int libexe_file_open_buffer(
+     libexe_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_open_stream(
+     libexe_file_t *file,
+     ssize_t (*read_callback)(
+              uint8_t *buffer,
+              size_t size,
+              void *callback_data ),
+     void *callback_data,
+     size64_t stream_size,
+     size_t maximum_buffer_size,
+     int (*data_callback)(
+            int section_index,
+            off64_t section_data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *data_callback_data,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libexe_file_stream_data_callback(
+     off64_t stream_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libexe_internal_file_t *internal_file );
+
+int libexe_file_get_section_data_end_offset(
+     libexe_internal_file_t *internal_file,
+     off64_t *end_offset,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_file_open_file_io_handle(
      libexe_file_t *file,
@@ -101,6 +255,15 @@ int libexe_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_file_open_file_io_handle_at_offset(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     off64_t base_offset,
+     size64_t size_limit,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_file_close(
      libexe_file_t *file,
@@ -111,6 +274,71 @@ int libexe_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libexe_file_append_data_directory_ranges(
+     libexe_internal_file_t *internal_file,
+     libexe_read_plan_io_handle_t *read_plan_io_handle,
+     libcerror_error_t **error );
+
+int libexe_file_open_block_cache(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libexe_file_read_certificate_table(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_read_plan_statistics(
+     libexe_file_t *file,
+     int *number_of_requested_ranges,
+     int *number_of_reads,
+     size64_t *requested_size,
+     size64_t *read_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_set_block_cache(
+     libexe_file_t *file,
+     size_t block_size,
+     int maximum_number_of_blocks,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_block_cache_statistics(
+     libexe_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_access_pattern(
+     libexe_file_t *file,
+     int *access_pattern,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_set_access_pattern(
+     libexe_file_t *file,
+     int access_pattern,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_set_section_access_pattern(
+     libexe_file_t *file,
+     int section_index,
+     int access_pattern,
+     libcerror_error_t **error );
+
+int libexe_file_open_access_advice(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libexe_file_close_access_advice(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_file_get_ascii_codepage(
      libexe_file_t *file,
@@ -129,6 +357,18 @@ int libexe_file_get_offset_by_relative_virtual_address(
      off64_t *offset,
      libcerror_error_t **error );
 
+int libexe_file_get_relative_virtual_address_by_virtual_address(
+     libexe_internal_file_t *internal_file,
+     uint64_t virtual_address,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error );
+
+int libexe_file_get_overlay_range(
+     libexe_internal_file_t *internal_file,
+     off64_t *overlay_offset,
+     size64_t *overlay_size,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_file_get_number_of_sections(
      libexe_file_t *file,
@@ -150,6 +390,432 @@ int libexe_file_get_section_by_name(
      libexe_section_t **section,
      libcerror_error_t **error );
 
+int libexe_file_get_runtime_function_end_address(
+     libexe_internal_file_t *internal_file,
+     libexe_runtime_function_t *runtime_function,
+     uint32_t *end_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_functions(
+     libexe_file_t *file,
+     int *number_of_functions,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_function(
+     libexe_file_t *file,
+     int function_index,
+     uint32_t *begin_address,
+     uint32_t *end_address,
+     uint32_t *unwind_information_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_function_by_rva(
+     libexe_file_t *file,
+     uint32_t relative_virtual_address,
+     uint32_t *begin_address,
+     uint32_t *end_address,
+     uint32_t *unwind_information_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_function_unwind_information(
+     libexe_file_t *file,
+     int function_index,
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_read_unwind_information(
+     libexe_file_t *file,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_tls_callbacks(
+     libexe_file_t *file,
+     int *number_of_tls_callbacks,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_tls_callback(
+     libexe_file_t *file,
+     int tls_callback_index,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_certificates(
+     libexe_file_t *file,
+     int *number_of_certificates,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_certificate(
+     libexe_file_t *file,
+     int certificate_index,
+     uint16_t *revision,
+     uint16_t *certificate_type,
+     off64_t *data_offset,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+ssize_t libexe_file_read_certificate_data_at_offset(
+         libexe_file_t *file,
+         int certificate_index,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_security_cookie(
+     libexe_file_t *file,
+     uint64_t *security_cookie,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_guard_flags(
+     libexe_file_t *file,
+     uint32_t *guard_flags,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_guard_cf_functions(
+     libexe_file_t *file,
+     int *number_of_guard_cf_functions,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_guard_cf_function(
+     libexe_file_t *file,
+     int guard_cf_function_index,
+     uint32_t *relative_virtual_address,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_has_guard_cf_function(
+     libexe_file_t *file,
+     uint32_t relative_virtual_address,
+     libcerror_error_t **error );
+
+int libexe_file_read_authenticode_digest_range(
+     libexe_internal_file_t *internal_file,
+     off64_t range_start,
+     off64_t range_end,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libhmac_sha1_context_t *sha1_context,
+     libhmac_sha256_context_t *sha256_context,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_compute_authenticode_digests(
+     libexe_file_t *file,
+     uint8_t *sha1_hash,
+     size_t sha1_hash_size,
+     uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_checksum(
+     libexe_file_t *file,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_compute_checksum(
+     libexe_file_t *file,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_compute_page_hashes(
+     libexe_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_page_hashes(
+     libexe_file_t *file,
+     int *number_of_page_hashes,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_page_hash(
+     libexe_file_t *file,
+     int page_hash_index,
+     uint32_t *file_offset,
+     uint8_t *sha1_hash,
+     size_t sha1_hash_size,
+     uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error );
+
+int libexe_file_free_digests(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_compute_digests(
+     libexe_file_t *file,
+     uint32_t digest_types,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_digest_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_section_digest_hash(
+     libexe_file_t *file,
+     int section_index,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_overlay_digest_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_fuzzy_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_section_fuzzy_hash(
+     libexe_file_t *file,
+     int section_index,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_overlay_fuzzy_hash(
+     libexe_file_t *file,
+     uint32_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libexe_file_free_byte_histograms(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libexe_file_read_byte_histogram(
+     libexe_internal_file_t *internal_file,
+     libexe_histogram_t *histogram,
+     off64_t range_offset,
+     size64_t range_size,
+     size64_t maximum_sample_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libexe_file_get_byte_histogram_values(
+     libexe_histogram_t *histogram,
+     uint64_t *counts,
+     size_t number_of_counts,
+     double *entropy,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_compute_byte_histograms(
+     libexe_file_t *file,
+     size64_t maximum_sample_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_headers_byte_histogram(
+     libexe_file_t *file,
+     uint64_t *histogram,
+     size_t histogram_size,
+     double *entropy,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_section_byte_histogram(
+     libexe_file_t *file,
+     int section_index,
+     uint64_t *histogram,
+     size_t histogram_size,
+     double *entropy,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_overlay_byte_histogram(
+     libexe_file_t *file,
+     uint64_t *histogram,
+     size_t histogram_size,
+     double *entropy,
+     libcerror_error_t **error );
+
+int libexe_file_free_section_merkle_trees(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_compute_section_merkle_trees(
+     libexe_file_t *file,
+     libcerror_error_t **error );
+
+int libexe_file_get_section_merkle_tree(
+     libexe_internal_file_t *internal_file,
+     int section_index,
+     libexe_merkle_tree_t **merkle_tree,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_section_merkle_tree_root_hash(
+     libexe_file_t *file,
+     int section_index,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_section_merkle_tree_data_size(
+     libexe_file_t *file,
+     int section_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_section_merkle_tree_data(
+     libexe_file_t *file,
+     int section_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libexe_file_extract_strings_from_range(
+     libexe_internal_file_t *internal_file,
+     off64_t range_offset,
+     size64_t range_size,
+     uint32_t relative_virtual_address,
+     uint8_t string_types,
+     size_t minimum_length,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_extract_section_strings(
+     libexe_file_t *file,
+     int section_index,
+     uint8_t string_types,
+     size_t minimum_length,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_extract_overlay_strings(
+     libexe_file_t *file,
+     uint8_t string_types,
+     size_t minimum_length,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libexe_file_get_section_index_by_offset(
+     libexe_internal_file_t *internal_file,
+     off64_t offset,
+     int *section_index,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error );
+
+int libexe_file_scan_range(
+     libexe_internal_file_t *internal_file,
+     libexe_internal_pattern_set_t *internal_pattern_set,
+     off64_t range_offset,
+     size64_t range_size,
+     int section_index,
+     uint32_t relative_virtual_address,
+     int (*match_callback)(
+            int pattern_index,
+            off64_t file_offset,
+            int section_index,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_scan(
+     libexe_file_t *file,
+     libexe_pattern_set_t *pattern_set,
+     int (*match_callback)(
+            int pattern_index,
+            off64_t file_offset,
+            int section_index,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_scan_section(
+     libexe_file_t *file,
+     int section_index,
+     libexe_pattern_set_t *pattern_set,
+     int (*match_callback)(
+            int pattern_index,
+            off64_t file_offset,
+            int section_index,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_stream_section_data(
+     libexe_file_t *file,
+     int (*data_callback)(
+            int section_index,
+            off64_t section_data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
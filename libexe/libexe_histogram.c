@@ -0,0 +1,471 @@
+/*
+ * Byte histogram functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_histogram.h"
+#include "libexe_libcerror.h"
+
+/* Creates a byte histogram
+ * Make sure the value histogram is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_histogram_initialize(
+     libexe_histogram_t **histogram,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_histogram_initialize";
+
+	if( histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( *histogram != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid histogram value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*histogram = memory_allocate_structure(
+	              libexe_histogram_t );
+
+	if( *histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create histogram.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *histogram,
+	     0,
+	     sizeof( libexe_histogram_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear histogram.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *histogram != NULL )
+	{
+		memory_free(
+		 *histogram );
+
+		*histogram = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a byte histogram
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_histogram_free(
+     libexe_histogram_t **histogram,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_histogram_free";
+
+	if( histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( *histogram != NULL )
+	{
+		memory_free(
+		 *histogram );
+
+		*histogram = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the byte histogram with the bytes in the buffer
+ * The bytes are counted in 4 interleaved tables so that successive increments of
+ * the same byte value do not depend on each other, the tables are summed into the
+ * histogram after every block
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_histogram_update(
+     libexe_histogram_t *histogram,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	uint32_t counts_table1[ 256 ];
+	uint32_t counts_table2[ 256 ];
+	uint32_t counts_table3[ 256 ];
+	uint32_t counts_table4[ 256 ];
+
+	static char *function = "libexe_histogram_update";
+	size_t block_end      = 0;
+	size_t block_size     = 0;
+	size_t buffer_offset  = 0;
+	uint16_t byte_value   = 0;
+
+	if( histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		/* Limit the block size so that the 32-bit counters cannot overflow
+		 */
+		block_size = buffer_size - buffer_offset;
+
+		if( block_size > LIBEXE_HISTOGRAM_MAXIMUM_BLOCK_SIZE )
+		{
+			block_size = LIBEXE_HISTOGRAM_MAXIMUM_BLOCK_SIZE;
+		}
+		if( memory_set(
+		     counts_table1,
+		     0,
+		     sizeof( uint32_t ) * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear counts table 1.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     counts_table2,
+		     0,
+		     sizeof( uint32_t ) * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear counts table 2.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     counts_table3,
+		     0,
+		     sizeof( uint32_t ) * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear counts table 3.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     counts_table4,
+		     0,
+		     sizeof( uint32_t ) * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear counts table 4.",
+			 function );
+
+			return( -1 );
+		}
+		block_end = buffer_offset + block_size;
+
+		while( ( block_end - buffer_offset ) >= 16 )
+		{
+			counts_table1[ buffer[ buffer_offset ] ]      += 1;
+			counts_table2[ buffer[ buffer_offset + 1 ] ]  += 1;
+			counts_table3[ buffer[ buffer_offset + 2 ] ]  += 1;
+			counts_table4[ buffer[ buffer_offset + 3 ] ]  += 1;
+			counts_table1[ buffer[ buffer_offset + 4 ] ]  += 1;
+			counts_table2[ buffer[ buffer_offset + 5 ] ]  += 1;
+			counts_table3[ buffer[ buffer_offset + 6 ] ]  += 1;
+			counts_table4[ buffer[ buffer_offset + 7 ] ]  += 1;
+			counts_table1[ buffer[ buffer_offset + 8 ] ]  += 1;
+			counts_table2[ buffer[ buffer_offset + 9 ] ]  += 1;
+			counts_table3[ buffer[ buffer_offset + 10 ] ] += 1;
+			counts_table4[ buffer[ buffer_offset + 11 ] ] += 1;
+			counts_table1[ buffer[ buffer_offset + 12 ] ] += 1;
+			counts_table2[ buffer[ buffer_offset + 13 ] ] += 1;
+			counts_table3[ buffer[ buffer_offset + 14 ] ] += 1;
+			counts_table4[ buffer[ buffer_offset + 15 ] ] += 1;
+
+			buffer_offset += 16;
+		}
+		while( buffer_offset < block_end )
+		{
+			counts_table1[ buffer[ buffer_offset ] ] += 1;
+
+			buffer_offset += 1;
+		}
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			histogram->counts[ byte_value ] += (uint64_t) counts_table1[ byte_value ]
+			                                 + (uint64_t) counts_table2[ byte_value ]
+			                                 + (uint64_t) counts_table3[ byte_value ]
+			                                 + (uint64_t) counts_table4[ byte_value ];
+		}
+	}
+	histogram->number_of_bytes += (uint64_t) buffer_size;
+
+	return( 1 );
+}
+
+/* Retrieves the byte histogram counts
+ * The counts must be able to contain 256 values, one for each byte value
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_histogram_get_counts(
+     libexe_histogram_t *histogram,
+     uint64_t *counts,
+     size_t number_of_counts,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_histogram_get_counts";
+
+	if( histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_counts < 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of counts value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     counts,
+	     histogram->counts,
+	     sizeof( uint64_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy counts.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the base 2 logarithm of a non-zero value
+ * The value is scaled into the range [1, 2) and the natural logarithm of the remainder
+ * is approximated with the series ln(m) = 2 * atanh((m - 1) / (m + 1)), this avoids
+ * a dependency on the math library
+ */
+static double libexe_histogram_log2(
+               uint64_t value )
+{
+	double mantissa   = 0.0;
+	double series_sum = 0.0;
+	double term       = 0.0;
+	double z          = 0.0;
+	double z_squared  = 0.0;
+	int exponent      = 0;
+	int term_index    = 0;
+
+	mantissa = (double) value;
+
+	while( mantissa >= 65536.0 )
+	{
+		mantissa /= 65536.0;
+		exponent += 16;
+	}
+	while( mantissa >= 2.0 )
+	{
+		mantissa /= 2.0;
+		exponent += 1;
+	}
+	z         = ( mantissa - 1.0 ) / ( mantissa + 1.0 );
+	z_squared = z * z;
+	term      = z;
+
+	for( term_index = 1;
+	     term_index < 40;
+	     term_index += 2 )
+	{
+		series_sum += term / (double) term_index;
+		term       *= z_squared;
+	}
+	/* 1 / ln(2) = 1.4426950408889634
+	 */
+	return( (double) exponent + ( 2.0 * series_sum * 1.4426950408889634 ) );
+}
+
+/* Calculates the Shannon entropy of the byte histogram
+ * The entropy is in bits per byte, between 0.0 and 8.0
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_histogram_get_entropy(
+     libexe_histogram_t *histogram,
+     double *entropy,
+     libcerror_error_t **error )
+{
+	static char *function         = "libexe_histogram_get_entropy";
+	double number_of_bytes_log2   = 0.0;
+	double sum_of_weighted_counts = 0.0;
+	double value_entropy          = 0.0;
+	uint16_t byte_value           = 0;
+
+	if( histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( entropy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy.",
+		 function );
+
+		return( -1 );
+	}
+	if( histogram->number_of_bytes != 0 )
+	{
+		/* H = log2(N) - ( sum( c * log2(c) ) / N )
+		 */
+		number_of_bytes_log2 = libexe_histogram_log2(
+		                        histogram->number_of_bytes );
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			if( histogram->counts[ byte_value ] != 0 )
+			{
+				sum_of_weighted_counts += (double) histogram->counts[ byte_value ]
+				                        * libexe_histogram_log2(
+				                           histogram->counts[ byte_value ] );
+			}
+		}
+		value_entropy = number_of_bytes_log2 - ( sum_of_weighted_counts / (double) histogram->number_of_bytes );
+
+		if( value_entropy < 0.0 )
+		{
+			value_entropy = 0.0;
+		}
+	}
+	*entropy = value_entropy;
+
+	return( 1 );
+}
+
@@ -0,0 +1,77 @@
+/*
+ * Byte histogram functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_HISTOGRAM_H )
+#define _LIBEXE_HISTOGRAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_histogram libexe_histogram_t;
+
+struct libexe_histogram
+{
+	/* The number of occurrences of each byte value
+	 */
+	uint64_t counts[ 256 ];
+
+	/* The number of bytes
+	 */
+	uint64_t number_of_bytes;
+};
+
+int libexe_histogram_initialize(
+     libexe_histogram_t **histogram,
+     libcerror_error_t **error );
+
+int libexe_histogram_free(
+     libexe_histogram_t **histogram,
+     libcerror_error_t **error );
+
+int libexe_histogram_update(
+     libexe_histogram_t *histogram,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libexe_histogram_get_counts(
+     libexe_histogram_t *histogram,
+     uint64_t *counts,
+     size_t number_of_counts,
+     libcerror_error_t **error );
+
+int libexe_histogram_get_entropy(
+     libexe_histogram_t *histogram,
+     double *entropy,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_HISTOGRAM_H ) */
+
@@ -274,15 +274,8 @@ int libexe_io_handle_read_mz_header(
 {
 	exe_mz_header_t mz_header;
 
-	static char *function                 = "libexe_io_handle_read_mz_header";
-	ssize_t read_count                    = 0;
-	uint16_t number_of_relocation_entries = 0;
-	uint16_t relocation_table_offset      = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit                  = 0;
-	uint16_t value_16bit                  = 0;
-#endif
+	static char *function = "libexe_io_handle_read_mz_header";
+	ssize_t read_count    = 0;
 
 	if( io_handle == NULL )
 	{
@@ -295,17 +288,6 @@ int libexe_io_handle_read_mz_header(
 
 		return( -1 );
 	}
-	if( extended_header_offset == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid extended header offset.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -346,6 +328,92 @@ int libexe_io_handle_read_mz_header(
 
 		return( -1 );
 	}
+	if( libexe_io_handle_read_mz_header_data(
+	     io_handle,
+	     (uint8_t *) &mz_header,
+	     sizeof( exe_mz_header_t ),
+	     extended_header_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read MZ header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the MZ header data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_io_handle_read_mz_header_data(
+     libexe_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *extended_header_offset,
+     libcerror_error_t **error )
+{
+	exe_mz_header_t *mz_header            = NULL;
+	static char *function                 = "libexe_io_handle_read_mz_header_data";
+	uint16_t number_of_relocation_entries = 0;
+	uint16_t relocation_table_offset      = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                  = 0;
+	uint16_t value_16bit                  = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( exe_mz_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extended_header_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended header offset.",
+		 function );
+
+		return( -1 );
+	}
+	mz_header = (exe_mz_header_t *) data;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -353,13 +421,13 @@ int libexe_io_handle_read_mz_header(
 		 "%s: MZ header:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &mz_header,
+		 data,
 		 sizeof( exe_mz_header_t ),
 		 0 );
 	}
 #endif
 	if( memory_compare(
-	     mz_header.signature,
+	     mz_header->signature,
 	     exe_mz_signature,
 	     2 ) != 0 )
 	{
@@ -373,11 +441,11 @@ int libexe_io_handle_read_mz_header(
 		return( -1 );
 	}
 	byte_stream_copy_to_uint16_little_endian(
-	 mz_header.number_of_relocation_entries,
+	 mz_header->number_of_relocation_entries,
 	 number_of_relocation_entries );
 
 	byte_stream_copy_to_uint16_little_endian(
-	 mz_header.relocation_table_offset,
+	 mz_header->relocation_table_offset,
 	 relocation_table_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -386,11 +454,11 @@ int libexe_io_handle_read_mz_header(
 		libcnotify_printf(
 		 "%s: signature\t\t\t\t: %c%c\n",
 		 function,
-		 mz_header.signature[ 0 ],
-		 mz_header.signature[ 1 ] );
+		 mz_header->signature[ 0 ],
+		 mz_header->signature[ 1 ] );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.last_page_size,
+		 mz_header->last_page_size,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: last page size\t\t\t\t: %" PRIu16 "\n",
@@ -398,7 +466,7 @@ int libexe_io_handle_read_mz_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.number_of_pages,
+		 mz_header->number_of_pages,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: number of pages\t\t\t: %" PRIu16 "\n",
@@ -411,7 +479,7 @@ int libexe_io_handle_read_mz_header(
 		 number_of_relocation_entries );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.number_of_header_paragraphs,
+		 mz_header->number_of_header_paragraphs,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: number of header paragraphs\t\t: %" PRIu16 "\n",
@@ -419,7 +487,7 @@ int libexe_io_handle_read_mz_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.minimum_allocated_paragraphs,
+		 mz_header->minimum_allocated_paragraphs,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: minimum allocated paragraphs\t\t: %" PRIu16 "\n",
@@ -427,7 +495,7 @@ int libexe_io_handle_read_mz_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.maximum_allocated_paragraphs,
+		 mz_header->maximum_allocated_paragraphs,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: maximum allocated paragraphs\t\t: %" PRIu16 "\n",
@@ -435,7 +503,7 @@ int libexe_io_handle_read_mz_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.initial_stack_segment,
+		 mz_header->initial_stack_segment,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: initial stack segment\t\t\t: 0x%04" PRIx16 "\n",
@@ -443,7 +511,7 @@ int libexe_io_handle_read_mz_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.initial_stack_pointer,
+		 mz_header->initial_stack_pointer,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: initial stack pointer\t\t\t: 0x%04" PRIx16 "\n",
@@ -451,7 +519,7 @@ int libexe_io_handle_read_mz_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.checksum,
+		 mz_header->checksum,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: checksum\t\t\t\t: 0x%04" PRIx16 "\n",
@@ -459,7 +527,7 @@ int libexe_io_handle_read_mz_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 mz_header.entry_point,
+		 mz_header->entry_point,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: entry point\t\t\t\t: 0x%08" PRIx32 "\n",
@@ -472,7 +540,7 @@ int libexe_io_handle_read_mz_header(
 		 relocation_table_offset );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 mz_header.overlay_number,
+		 mz_header->overlay_number,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: overlay number\t\t\t\t: %" PRIu16 "\n",
@@ -487,7 +555,7 @@ int libexe_io_handle_read_mz_header(
 	{
 /* TODO read data */
 		byte_stream_copy_to_uint32_little_endian(
-		 mz_header.extended_header_offset,
+		 mz_header->extended_header_offset,
 		 *extended_header_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -497,7 +565,7 @@ int libexe_io_handle_read_mz_header(
 			 "%s: unknown1:\n",
 			 function );
 			libcnotify_print_data(
-			 mz_header.unknown1,
+			 mz_header->unknown1,
 			 32,
 			 0 );
 
@@ -510,7 +578,7 @@ int libexe_io_handle_read_mz_header(
 			 "%s: unknown2:\n",
 			 function );
 			libcnotify_print_data(
-			 mz_header.unknown2,
+			 mz_header->unknown2,
 			 112,
 			 0 );
 		}
@@ -1077,9 +1145,86 @@ int libexe_io_handle_read_coff_header(
 {
 	exe_coff_header_t coff_header;
 
-	static char *function                 = "libexe_io_handle_read_coff_header";
-	ssize_t read_count                    = 0;
-	uint16_t optional_header_size         = 0;
+	static char *function         = "libexe_io_handle_read_coff_header";
+	ssize_t read_count            = 0;
+	uint16_t optional_header_size = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              (uint8_t *) &coff_header,
+	              sizeof( exe_coff_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) sizeof( exe_coff_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read COFF header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_io_handle_read_coff_header_data(
+	     io_handle,
+	     (uint8_t *) &coff_header,
+	     sizeof( exe_coff_header_t ),
+	     number_of_sections,
+	     &optional_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read COFF header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_io_handle_read_coff_optional_header(
+	     io_handle,
+	     file_io_handle,
+	     optional_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read COFF optional header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the COFF header data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_io_handle_read_coff_header_data(
+     libexe_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *number_of_sections,
+     uint16_t *optional_header_size,
+     libcerror_error_t **error )
+{
+	exe_coff_header_t *coff_header        = NULL;
+	static char *function                 = "libexe_io_handle_read_coff_header_data";
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	libcstring_system_character_t posix_time_string[ 32 ];
@@ -1101,6 +1246,29 @@ int libexe_io_handle_read_coff_header(
 
 		return( -1 );
 	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( exe_coff_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( number_of_sections == NULL )
 	{
 		libcerror_error_set(
@@ -1112,23 +1280,19 @@ int libexe_io_handle_read_coff_header(
 
 		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              (uint8_t *) &coff_header,
-	              sizeof( exe_coff_header_t ),
-	              error );
-
-	if( read_count != (ssize_t) sizeof( exe_coff_header_t ) )
+	if( optional_header_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read COFF header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid optional header size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	coff_header = (exe_coff_header_t *) data;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1136,33 +1300,34 @@ int libexe_io_handle_read_coff_header(
 		 "%s: COFF header:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &coff_header,
+		 data,
 		 sizeof( exe_coff_header_t ),
 		 0 );
 	}
 #endif
 	byte_stream_copy_to_uint16_little_endian(
-	 coff_header.number_of_sections,
+	 coff_header->target_architecture_type,
+	 io_handle->target_architecture_type );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->number_of_sections,
 	 *number_of_sections );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 coff_header.creation_time,
+	 coff_header->creation_time,
 	 io_handle->creation_time );
 
 	byte_stream_copy_to_uint16_little_endian(
-	 coff_header.optional_header_size,
-	 optional_header_size );
+	 coff_header->optional_header_size,
+	 *optional_header_size );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		byte_stream_copy_to_uint16_little_endian(
-		 coff_header.target_architecture_type,
-		 value_16bit );
 		libcnotify_printf(
 		 "%s: target architecture type\t\t: 0x%04" PRIx16 "\n",
 		 function,
-		 value_16bit );
+		 io_handle->target_architecture_type );
 
 		libcnotify_printf(
 		 "%s: number of sections\t\t\t: %" PRIu16 "\n",
@@ -1184,7 +1349,7 @@ int libexe_io_handle_read_coff_header(
 		}
 		if( libfdatetime_posix_time_copy_from_byte_stream(
 		     posix_time,
-		     coff_header.creation_time,
+		     coff_header->creation_time,
 		     4,
 		     LIBFDATETIME_ENDIAN_LITTLE,
 		     LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
@@ -1244,7 +1409,7 @@ int libexe_io_handle_read_coff_header(
 			goto on_error;
 		}
 		byte_stream_copy_to_uint32_little_endian(
-		 coff_header.symbol_table_offset,
+		 coff_header->symbol_table_offset,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: symbol table offset\t\t\t: 0x%08" PRIx32 "\n",
@@ -1252,7 +1417,7 @@ int libexe_io_handle_read_coff_header(
 		 value_32bit );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 coff_header.number_of_symbols,
+		 coff_header->number_of_symbols,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: number of symbols\t\t\t: %" PRIu32 "\n",
@@ -1262,10 +1427,10 @@ int libexe_io_handle_read_coff_header(
 		libcnotify_printf(
 		 "%s: optional header size\t\t\t: %" PRIu16 "\n",
 		 function,
-		 optional_header_size );
+		 *optional_header_size );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 coff_header.characteristic_flags,
+		 coff_header->characteristic_flags,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: characteristic flags\t\t\t: 0x%04" PRIx16 "\n",
@@ -1277,33 +1442,18 @@ int libexe_io_handle_read_coff_header(
 		 "\n" );
 	}
 #endif
-	if( libexe_io_handle_read_coff_optional_header(
-	     io_handle,
-	     file_io_handle,
-	     optional_header_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read COFF optional header.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
-on_error:
 #if defined( HAVE_DEBUG_OUTPUT )
+on_error:
 	if( posix_time != NULL )
 	{
 		libfdatetime_posix_time_free(
 		 &posix_time,
 		 NULL );
 	}
-#endif
 	return( -1 );
+#endif
 }
 
 /* Reads the COFF optional header
@@ -1315,19 +1465,10 @@ int libexe_io_handle_read_coff_optional_header(
      uint16_t optional_header_size,
      libcerror_error_t **error )
 {
-	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
-	uint8_t *coff_optional_header                                 = NULL;
-	uint8_t *coff_optional_header_data                            = NULL;
-	static char *function                                         = "libexe_io_handle_read_coff_optional_header";
-	ssize_t read_count                                            = 0;
-	uint32_t number_of_data_directories_entries                   = 0;
-	uint16_t signature                                            = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit                                          = 0;
-	uint32_t value_32bit                                          = 0;
-	uint16_t value_16bit                                          = 0;
-#endif
+	uint8_t *coff_optional_header       = NULL;
+	static char *function               = "libexe_io_handle_read_coff_optional_header";
+	off64_t coff_optional_header_offset = 0;
+	ssize_t read_count                  = 0;
 
 	if( io_handle == NULL )
 	{
@@ -1340,6 +1481,31 @@ int libexe_io_handle_read_coff_optional_header(
 
 		return( -1 );
 	}
+	if( (size_t) optional_header_size < sizeof( exe_coff_optional_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid optional header size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_offset(
+	     file_io_handle,
+	     &coff_optional_header_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve COFF optional header offset.",
+		 function );
+
+		goto on_error;
+	}
 	coff_optional_header = (uint8_t *) memory_allocate(
 	                                    sizeof( uint8_t ) * optional_header_size );
 
@@ -1371,7 +1537,95 @@ int libexe_io_handle_read_coff_optional_header(
 
 		goto on_error;
 	}
-	coff_optional_header_data = coff_optional_header;
+	if( libexe_io_handle_read_coff_optional_header_data(
+	     io_handle,
+	     coff_optional_header,
+	     (size_t) optional_header_size,
+	     coff_optional_header_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read COFF optional header.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 coff_optional_header );
+
+	return( 1 );
+
+on_error:
+	if( coff_optional_header != NULL )
+	{
+		memory_free(
+		 coff_optional_header );
+	}
+	return( -1 );
+}
+
+/* Reads the COFF optional header data
+ * The file offset is the offset of the COFF optional header in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_io_handle_read_coff_optional_header_data(
+     libexe_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
+	const uint8_t *coff_optional_header_data                      = NULL;
+	static char *function                                         = "libexe_io_handle_read_coff_optional_header_data";
+	size_t coff_optional_header_data_size                         = 0;
+	uint32_t number_of_data_directories_entries                   = 0;
+	uint16_t signature                                            = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit                                          = 0;
+	uint32_t value_32bit                                          = 0;
+	uint16_t value_16bit                                          = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( exe_coff_optional_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	coff_optional_header_data = data;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1380,8 +1634,8 @@ int libexe_io_handle_read_coff_optional_header(
 		 "%s: COFF optional header:\n",
 		 function );
 		libcnotify_print_data(
-		 coff_optional_header_data,
-		 (size_t) optional_header_size,
+		 data,
+		 data_size,
 		 0 );
 	}
 #endif
@@ -1447,16 +1701,6 @@ int libexe_io_handle_read_coff_optional_header(
 		 function,
 		 value_32bit );
 
-		if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (exe_coff_optional_header_t *) coff_optional_header_data )->data_base_offset,
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: data base offset\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-		}
 		libcnotify_printf(
 		 "\n" );
 	}
@@ -1471,12 +1715,44 @@ int libexe_io_handle_read_coff_optional_header(
 		 "%s: unsupported signature.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	coff_optional_header_data += sizeof( exe_coff_optional_header_t );
+	io_handle->coff_optional_header_signature = signature;
+
+	coff_optional_header_data      += sizeof( exe_coff_optional_header_t );
+	coff_optional_header_data_size  = data_size - sizeof( exe_coff_optional_header_t );
+
+	if( ( ( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	  &&  ( coff_optional_header_data_size < sizeof( exe_coff_optional_header_pe32_t ) ) )
+	 || ( ( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	  &&  ( coff_optional_header_data_size < sizeof( exe_coff_optional_header_pe32_plus_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid optional header size value too small.",
+		 function );
 
+		return( -1 );
+	}
 	if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
 	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->image_base_offset,
+		 io_handle->image_base );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->checksum,
+		 io_handle->checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->headers_size,
+		 io_handle->headers_size );
+
+		io_handle->checksum_offset = file_offset
+		                           + (off64_t) ( ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->checksum - data );
+
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->number_of_data_directories_entries,
 		 number_of_data_directories_entries );
@@ -1485,13 +1761,18 @@ int libexe_io_handle_read_coff_optional_header(
 		if( libcnotify_verbose != 0 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
-			 ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->image_base_offset,
+			 ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->data_base_offset,
 			 value_32bit );
 			libcnotify_printf(
-			 "%s: image base offset\t\t\t: 0x%08" PRIx32 "\n",
+			 "%s: data base offset\t\t\t: 0x%08" PRIx32 "\n",
 			 function,
 			 value_32bit );
 
+			libcnotify_printf(
+			 "%s: image base offset\t\t\t: 0x%08" PRIx64 "\n",
+			 function,
+			 io_handle->image_base );
+
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (exe_coff_optional_header_pe32_t *) coff_optional_header_data )->section_alignment_size,
 			 value_32bit );
@@ -1654,10 +1935,26 @@ int libexe_io_handle_read_coff_optional_header(
 			 number_of_data_directories_entries );
 		}
 #endif
-		coff_optional_header_data += sizeof( exe_coff_optional_header_pe32_t );
+		coff_optional_header_data      += sizeof( exe_coff_optional_header_pe32_t );
+		coff_optional_header_data_size -= sizeof( exe_coff_optional_header_pe32_t );
 	}
-	else if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	else if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
 	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) coff_optional_header_data )->image_base_offset,
+		 io_handle->image_base );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) coff_optional_header_data )->checksum,
+		 io_handle->checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) coff_optional_header_data )->headers_size,
+		 io_handle->headers_size );
+
+		io_handle->checksum_offset = file_offset
+		                           + (off64_t) ( ( (exe_coff_optional_header_pe32_plus_t *) coff_optional_header_data )->checksum - data );
+
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (exe_coff_optional_header_pe32_plus_t *) coff_optional_header_data )->number_of_data_directories_entries,
 		 number_of_data_directories_entries );
@@ -1665,13 +1962,10 @@ int libexe_io_handle_read_coff_optional_header(
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (exe_coff_optional_header_pe32_plus_t *) coff_optional_header_data )->image_base_offset,
-			 value_64bit );
 			libcnotify_printf(
 			 "%s: image base offset\t\t\t: 0x%08" PRIx64 "\n",
 			 function,
-			 value_64bit );
+			 io_handle->image_base );
 
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (exe_coff_optional_header_pe32_plus_t *) coff_optional_header_data )->section_alignment_size,
@@ -1835,7 +2129,8 @@ int libexe_io_handle_read_coff_optional_header(
 			 number_of_data_directories_entries );
 		}
 #endif
-		coff_optional_header_data += sizeof( exe_coff_optional_header_pe32_plus_t );
+		coff_optional_header_data      += sizeof( exe_coff_optional_header_pe32_plus_t );
+		coff_optional_header_data_size -= sizeof( exe_coff_optional_header_pe32_plus_t );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1854,7 +2149,18 @@ int libexe_io_handle_read_coff_optional_header(
 		 function,
 		 number_of_data_directories_entries );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( ( number_of_data_directories_entries * 8 ) > coff_optional_header_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of data directory entries value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
 	if( number_of_data_directories_entries > 0 )
 	{
@@ -1980,18 +2286,21 @@ int libexe_io_handle_read_coff_optional_header(
 		 ( (exe_coff_optional_header_data_directories_t *) coff_optional_header_data )->certificate_table_size,
 		 data_directory_descriptor->size );
 
+		io_handle->certificate_table_entry_offset = file_offset
+		                                          + (off64_t) ( ( (exe_coff_optional_header_data_directories_t *) coff_optional_header_data )->certificate_table_rva - data );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
 			 "%s: certificate table RVA\t\t: 0x%08" PRIx32 "\n",
 			 function,
-			 value_32bit );
+			 data_directory_descriptor->virtual_address );
 
 			libcnotify_printf(
 			 "%s: certificate table size\t\t: %" PRIu32 "\n",
 			 function,
-			 value_32bit );
+			 data_directory_descriptor->size );
 		}
 #endif
 		number_of_data_directories_entries--;
@@ -2014,12 +2323,12 @@ int libexe_io_handle_read_coff_optional_header(
 			libcnotify_printf(
 			 "%s: base relocation table RVA\t\t: 0x%08" PRIx32 "\n",
 			 function,
-			 value_32bit );
+			 data_directory_descriptor->virtual_address );
 
 			libcnotify_printf(
 			 "%s: base relocation table size\t\t: %" PRIu32 "\n",
 			 function,
-			 value_32bit );
+			 data_directory_descriptor->size );
 		}
 #endif
 		number_of_data_directories_entries--;
@@ -2153,6 +2462,30 @@ int libexe_io_handle_read_coff_optional_header(
 			 function,
 			 data_directory_descriptor->size );
 		}
+#endif
+		number_of_data_directories_entries--;
+	}
+	if( number_of_data_directories_entries > 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (exe_coff_optional_header_data_directories_t *) coff_optional_header_data )->bound_import_table_rva,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: bound import table RVA\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (exe_coff_optional_header_data_directories_t *) coff_optional_header_data )->bound_import_table_size,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: bound import table size\t\t: %" PRIu32 "\n",
+			 function,
+			 value_32bit );
+		}
 #endif
 		number_of_data_directories_entries--;
 	}
@@ -2259,18 +2592,7 @@ int libexe_io_handle_read_coff_optional_header(
 #endif
 		number_of_data_directories_entries--;
 	}
-	memory_free(
-	 coff_optional_header );
-
 	return( 1 );
-
-on_error:
-	if( coff_optional_header != NULL )
-	{
-		memory_free(
-		 coff_optional_header );
-	}
-	return( -1 );
 }
 
 /* Reads the section table
@@ -2291,6 +2613,7 @@ int libexe_io_handle_read_section_table(
 	ssize_t read_count                              = 0;
 	uint32_t section_data_offset                    = 0;
 	uint32_t section_data_size                      = 0;
+	uint32_t section_virtual_size                   = 0;
 	uint16_t section_index                          = 0;
 	int entry_index                                 = 0;
 
@@ -2419,6 +2742,10 @@ int libexe_io_handle_read_section_table(
 		 ( (exe_section_table_entry_t *) section_table_data )->data_offset,
 		 section_data_offset );
 
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_section_table_entry_t *) section_table_data )->virtual_size,
+		 section_virtual_size );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -2428,14 +2755,11 @@ int libexe_io_handle_read_section_table(
 			 section_index,
 			 section_descriptor->name );
 
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (exe_section_table_entry_t *) section_table_data )->virtual_size,
-			 value_32bit );
 			libcnotify_printf(
 			 "%s: entry: %02" PRIu16 " virtual size\t\t\t: %" PRIu32 "\n",
 			 function,
 			 section_index,
-			 value_32bit );
+			 section_virtual_size );
 
 			libcnotify_printf(
 			 "%s: entry: %02" PRIu16 " virtual address\t\t\t: 0x%08" PRIx32 "\n",
@@ -2508,6 +2832,18 @@ int libexe_io_handle_read_section_table(
 		section_table_data += sizeof( exe_section_table_entry_t );
 		section_table_size -= sizeof( exe_section_table_entry_t );
 
+		/* In a memory image the section data is stored at its virtual address
+		 * and spans the virtual size, which can be 0 in some linkers
+		 */
+		if( io_handle->is_memory_image != 0 )
+		{
+			section_data_offset = section_descriptor->virtual_address;
+
+			if( section_virtual_size != 0 )
+			{
+				section_data_size = section_virtual_size;
+			}
+		}
 		if( libexe_section_descriptor_set_data_range(
 		     section_descriptor,
 		     (off64_t) section_data_offset,
@@ -36,6 +36,7 @@ extern "C" {
 #endif
 
 extern const char *exe_mz_signature;
+extern const char *exe_pe_signature;
 
 typedef struct libexe_io_handle libexe_io_handle_t;
 
@@ -45,10 +46,53 @@ struct libexe_io_handle
 	 */
 	uint8_t executable_type;
 
+	/* The target architecture type
+	 */
+	uint16_t target_architecture_type;
+
 	/* The creation time
 	 */
 	uint32_t creation_time;
 
+	/* The COFF optional header signature
+	 */
+	uint16_t coff_optional_header_signature;
+
+	/* The image base
+	 */
+	uint64_t image_base;
+
+	/* The checksum
+	 */
+	uint32_t checksum;
+
+	/* The headers size
+	 */
+	uint32_t headers_size;
+
+	/* The offset of the checksum in the COFF optional header
+	 */
+	off64_t checksum_offset;
+
+	/* The offset of the certificate table entry in the data directories
+	 * Contains 0 if not available
+	 */
+	off64_t certificate_table_entry_offset;
+
+	/* Value to indicate the file contains a memory image
+	 * where the section data is stored at its virtual address
+	 */
+	uint8_t is_memory_image;
+
+	/* The data of the buffer the file was opened from
+	 * Contains NULL if the file was not opened from a buffer
+	 */
+	const uint8_t *buffer_data;
+
+	/* The size of the buffer the file was opened from
+	 */
+	size_t buffer_size;
+
 	/* The data directory
 	 */
         libexe_data_directory_descriptor_t data_directories[ LIBEXE_NUMBER_OF_DATA_DIRECTORIES ];
@@ -86,6 +130,13 @@ int libexe_io_handle_read_mz_header(
      uint32_t *extended_header_offset,
      libcerror_error_t **error );
 
+int libexe_io_handle_read_mz_header_data(
+     libexe_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *extended_header_offset,
+     libcerror_error_t **error );
+
 int libexe_io_handle_read_extended_header(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -120,12 +171,27 @@ int libexe_io_handle_read_coff_header(
      uint16_t *number_of_sections,
      libcerror_error_t **error );
 
+int libexe_io_handle_read_coff_header_data(
+     libexe_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *number_of_sections,
+     uint16_t *optional_header_size,
+     libcerror_error_t **error );
+
 int libexe_io_handle_read_coff_optional_header(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint16_t optional_header_size,
      libcerror_error_t **error );
 
+int libexe_io_handle_read_coff_optional_header_data(
+     libexe_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int libexe_io_handle_read_section_table(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -0,0 +1,1209 @@
+/*
+ * Load configuration functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+#include "libexe_load_configuration.h"
+
+#include "exe_load_configuration.h"
+
+/* Creates a load configuration
+ * Make sure the value load_configuration is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_load_configuration_initialize(
+     libexe_load_configuration_t **load_configuration,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_load_configuration_initialize";
+
+	if( load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	if( *load_configuration != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid load configuration value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*load_configuration = memory_allocate_structure(
+	                       libexe_load_configuration_t );
+
+	if( *load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create load configuration.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *load_configuration,
+	     0,
+	     sizeof( libexe_load_configuration_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear load configuration.",
+		 function );
+
+		memory_free(
+		 *load_configuration );
+
+		*load_configuration = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *load_configuration != NULL )
+	{
+		memory_free(
+		 *load_configuration );
+
+		*load_configuration = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a load configuration
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_load_configuration_free(
+     libexe_load_configuration_t **load_configuration,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_load_configuration_free";
+
+	if( load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	if( *load_configuration != NULL )
+	{
+		if( ( *load_configuration )->guard_cf_function_flags != NULL )
+		{
+			memory_free(
+			 ( *load_configuration )->guard_cf_function_flags );
+		}
+		if( ( *load_configuration )->guard_cf_function_addresses != NULL )
+		{
+			memory_free(
+			 ( *load_configuration )->guard_cf_function_addresses );
+		}
+		memory_free(
+		 *load_configuration );
+
+		*load_configuration = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the load configuration
+ * The size stored in the load configuration is used to determine which values are present,
+ * values that are not present are set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_load_configuration_read(
+     libexe_load_configuration_t *load_configuration,
+     libbfio_handle_t *file_io_handle,
+     uint32_t file_offset,
+     uint32_t size,
+     uint16_t coff_optional_header_signature,
+     libcerror_error_t **error )
+{
+	uint8_t load_configuration_data[ sizeof( exe_load_configuration_directory64_t ) ];
+
+	static char *function = "libexe_load_configuration_read";
+	size_t read_size      = 0;
+	size_t structure_size = 0;
+	ssize_t read_count    = 0;
+
+	if( load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	{
+		structure_size = sizeof( exe_load_configuration_directory32_t );
+	}
+	else if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	{
+		structure_size = sizeof( exe_load_configuration_directory64_t );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported COFF optional header signature: 0x%04" PRIx16 ".",
+		 function,
+		 coff_optional_header_signature );
+
+		return( -1 );
+	}
+	if( size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     load_configuration_data,
+	     0,
+	     sizeof( exe_load_configuration_directory64_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear load configuration data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading load configuration at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     (off64_t) file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek load configuration offset: %" PRIu32 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              load_configuration_data,
+	              4,
+	              error );
+
+	if( read_count != (ssize_t) 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read load configuration size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 load_configuration_data,
+	 read_size );
+
+	/* The size in the data directory is not reliable, older linkers store a fixed value of 64,
+	 * hence the size stored in the load configuration is used
+	 * Newer versions of the load configuration only add values at the end
+	 */
+	if( read_size > structure_size )
+	{
+		read_size = structure_size;
+	}
+	if( read_size > 4 )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( load_configuration_data[ 4 ] ),
+		              read_size - 4,
+		              error );
+
+		if( read_count != (ssize_t) ( read_size - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read load configuration.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: load configuration data:\n",
+		 function );
+		libcnotify_print_data(
+		 load_configuration_data,
+		 read_size,
+		 0 );
+	}
+#endif
+	if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->size,
+		 load_configuration->size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->creation_time,
+		 load_configuration->creation_time );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->major_version,
+		 load_configuration->major_version );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->minor_version,
+		 load_configuration->minor_version );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->global_flags_clear,
+		 load_configuration->global_flags_clear );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->global_flags_set,
+		 load_configuration->global_flags_set );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->critical_section_default_timeout,
+		 load_configuration->critical_section_default_timeout );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->de_commit_free_block_threshold,
+		 load_configuration->de_commit_free_block_threshold );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->de_commit_total_free_threshold,
+		 load_configuration->de_commit_total_free_threshold );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->lock_prefix_table,
+		 load_configuration->lock_prefix_table );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->maximum_allocation_size,
+		 load_configuration->maximum_allocation_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->virtual_memory_threshold,
+		 load_configuration->virtual_memory_threshold );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->process_affinity_mask,
+		 load_configuration->process_affinity_mask );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->process_heap_flags,
+		 load_configuration->process_heap_flags );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->csd_version,
+		 load_configuration->csd_version );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->dependent_load_flags,
+		 load_configuration->dependent_load_flags );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->edit_list,
+		 load_configuration->edit_list );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->security_cookie,
+		 load_configuration->security_cookie );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->se_handler_table,
+		 load_configuration->se_handler_table );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->se_handler_count,
+		 load_configuration->se_handler_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_cf_check_function_pointer,
+		 load_configuration->guard_cf_check_function_pointer );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_cf_dispatch_function_pointer,
+		 load_configuration->guard_cf_dispatch_function_pointer );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_cf_function_table,
+		 load_configuration->guard_cf_function_table );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_cf_function_count,
+		 load_configuration->guard_cf_function_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_flags,
+		 load_configuration->guard_flags );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_address_taken_iat_entry_table,
+		 load_configuration->guard_address_taken_iat_entry_table );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_address_taken_iat_entry_count,
+		 load_configuration->guard_address_taken_iat_entry_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_long_jump_target_table,
+		 load_configuration->guard_long_jump_target_table );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_long_jump_target_count,
+		 load_configuration->guard_long_jump_target_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_eh_continuation_table,
+		 load_configuration->guard_eh_continuation_table );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory32_t *) load_configuration_data )->guard_eh_continuation_count,
+		 load_configuration->guard_eh_continuation_count );
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->size,
+		 load_configuration->size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->creation_time,
+		 load_configuration->creation_time );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->major_version,
+		 load_configuration->major_version );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->minor_version,
+		 load_configuration->minor_version );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->global_flags_clear,
+		 load_configuration->global_flags_clear );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->global_flags_set,
+		 load_configuration->global_flags_set );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->critical_section_default_timeout,
+		 load_configuration->critical_section_default_timeout );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->de_commit_free_block_threshold,
+		 load_configuration->de_commit_free_block_threshold );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->de_commit_total_free_threshold,
+		 load_configuration->de_commit_total_free_threshold );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->lock_prefix_table,
+		 load_configuration->lock_prefix_table );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->maximum_allocation_size,
+		 load_configuration->maximum_allocation_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->virtual_memory_threshold,
+		 load_configuration->virtual_memory_threshold );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->process_affinity_mask,
+		 load_configuration->process_affinity_mask );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->process_heap_flags,
+		 load_configuration->process_heap_flags );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->csd_version,
+		 load_configuration->csd_version );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->dependent_load_flags,
+		 load_configuration->dependent_load_flags );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->edit_list,
+		 load_configuration->edit_list );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->security_cookie,
+		 load_configuration->security_cookie );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->se_handler_table,
+		 load_configuration->se_handler_table );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->se_handler_count,
+		 load_configuration->se_handler_count );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_cf_check_function_pointer,
+		 load_configuration->guard_cf_check_function_pointer );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_cf_dispatch_function_pointer,
+		 load_configuration->guard_cf_dispatch_function_pointer );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_cf_function_table,
+		 load_configuration->guard_cf_function_table );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_cf_function_count,
+		 load_configuration->guard_cf_function_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_flags,
+		 load_configuration->guard_flags );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_address_taken_iat_entry_table,
+		 load_configuration->guard_address_taken_iat_entry_table );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_address_taken_iat_entry_count,
+		 load_configuration->guard_address_taken_iat_entry_count );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_long_jump_target_table,
+		 load_configuration->guard_long_jump_target_table );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_long_jump_target_count,
+		 load_configuration->guard_long_jump_target_count );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_eh_continuation_table,
+		 load_configuration->guard_eh_continuation_table );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_load_configuration_directory64_t *) load_configuration_data )->guard_eh_continuation_count,
+		 load_configuration->guard_eh_continuation_count );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data directory size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 size );
+
+		libcnotify_printf(
+		 "%s: size\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 load_configuration->size );
+
+		libcnotify_printf(
+		 "%s: creation time\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 load_configuration->creation_time );
+
+		libcnotify_printf(
+		 "%s: major version\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 load_configuration->major_version );
+
+		libcnotify_printf(
+		 "%s: minor version\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 load_configuration->minor_version );
+
+		libcnotify_printf(
+		 "%s: global flags to clear\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 load_configuration->global_flags_clear );
+
+		libcnotify_printf(
+		 "%s: global flags to set\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 load_configuration->global_flags_set );
+
+		libcnotify_printf(
+		 "%s: critical section default timeout\t\t: %" PRIu32 "\n",
+		 function,
+		 load_configuration->critical_section_default_timeout );
+
+		libcnotify_printf(
+		 "%s: de-commit free block threshold\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->de_commit_free_block_threshold );
+
+		libcnotify_printf(
+		 "%s: de-commit total free threshold\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->de_commit_total_free_threshold );
+
+		libcnotify_printf(
+		 "%s: lock prefix table\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->lock_prefix_table );
+
+		libcnotify_printf(
+		 "%s: maximum allocation size\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->maximum_allocation_size );
+
+		libcnotify_printf(
+		 "%s: virtual memory threshold\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->virtual_memory_threshold );
+
+		libcnotify_printf(
+		 "%s: process affinity mask\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->process_affinity_mask );
+
+		libcnotify_printf(
+		 "%s: process heap flags\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 load_configuration->process_heap_flags );
+
+		libcnotify_printf(
+		 "%s: cSD version\t\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 load_configuration->csd_version );
+
+		libcnotify_printf(
+		 "%s: dependent load flags\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 load_configuration->dependent_load_flags );
+
+		libcnotify_printf(
+		 "%s: edit list\t\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->edit_list );
+
+		libcnotify_printf(
+		 "%s: security cookie\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->security_cookie );
+
+		libcnotify_printf(
+		 "%s: sE handler table\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->se_handler_table );
+
+		libcnotify_printf(
+		 "%s: sE handler count\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->se_handler_count );
+
+		libcnotify_printf(
+		 "%s: control flow guard check function pointer\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_cf_check_function_pointer );
+
+		libcnotify_printf(
+		 "%s: control flow guard dispatch function pointer\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_cf_dispatch_function_pointer );
+
+		libcnotify_printf(
+		 "%s: control flow guard function table\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_cf_function_table );
+
+		libcnotify_printf(
+		 "%s: control flow guard function count\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_cf_function_count );
+
+		libcnotify_printf(
+		 "%s: control flow guard flags\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 load_configuration->guard_flags );
+
+		libcnotify_printf(
+		 "%s: control flow guard address taken IAT entry table\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_address_taken_iat_entry_table );
+
+		libcnotify_printf(
+		 "%s: control flow guard address taken IAT entry count\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_address_taken_iat_entry_count );
+
+		libcnotify_printf(
+		 "%s: control flow guard long jump target table\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_long_jump_target_table );
+
+		libcnotify_printf(
+		 "%s: control flow guard long jump target count\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_long_jump_target_count );
+
+		libcnotify_printf(
+		 "%s: exception handling continuation table\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_eh_continuation_table );
+
+		libcnotify_printf(
+		 "%s: exception handling continuation count\t: 0x%08" PRIx64 "\n",
+		 function,
+		 load_configuration->guard_eh_continuation_count );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Compares two control flow guard function values
+ * The values contain the RVA in the upper bits and the flags in the lower 8 bits
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libexe_load_configuration_compare_guard_cf_function_values(
+     const void *first_value,
+     const void *second_value )
+{
+	uint64_t first_guard_cf_function_value  = *( (uint64_t *) first_value );
+	uint64_t second_guard_cf_function_value = *( (uint64_t *) second_value );
+
+	if( first_guard_cf_function_value < second_guard_cf_function_value )
+	{
+		return( -1 );
+	}
+	else if( first_guard_cf_function_value > second_guard_cf_function_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the control flow guard function table
+ * The size of the table entries is determined by the control flow guard flags
+ * The function addresses are stored sorted, since the lookup functions rely on it
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_load_configuration_read_guard_cf_function_table(
+     libexe_load_configuration_t *load_configuration,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data                = NULL;
+	uint8_t *table_data                = NULL;
+	uint64_t *guard_cf_function_values = NULL;
+	static char *function              = "libexe_load_configuration_read_guard_cf_function_table";
+	size64_t file_size                 = 0;
+	size_t entry_size                  = 0;
+	size_t table_size                  = 0;
+	ssize_t read_count                 = 0;
+	uint32_t relative_virtual_address  = 0;
+	int entry_index                    = 0;
+	int is_sorted                      = 1;
+	int number_of_entries              = 0;
+
+	if( load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	if( load_configuration->guard_cf_function_addresses != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid load configuration - guard CF function addresses value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( load_configuration->guard_cf_function_count == 0 )
+	{
+		return( 1 );
+	}
+	/* Every entry consists of a 4-byte RVA followed by the number of bytes
+	 * stored in the guard flags, of which the first byte contains the flags
+	 */
+	entry_size = 4 + (size_t) ( ( load_configuration->guard_flags & LIBEXE_GUARD_FLAGS_CF_FUNCTION_TABLE_SIZE_MASK ) >> LIBEXE_GUARD_FLAGS_CF_FUNCTION_TABLE_SIZE_SHIFT );
+
+	if( ( load_configuration->guard_cf_function_count > (uint64_t) ( INT_MAX / sizeof( uint64_t ) ) )
+	 || ( load_configuration->guard_cf_function_count > (uint64_t) ( SSIZE_MAX / entry_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid load configuration - guard CF function count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = (int) load_configuration->guard_cf_function_count;
+	table_size        = (size_t) number_of_entries * entry_size;
+
+	/* Make sure the table is stored in the file before allocating memory for it
+	 */
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < 0 )
+	 || ( (size64_t) file_offset > file_size )
+	 || ( (size64_t) table_size > ( file_size - (size64_t) file_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid guard CF function table offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading guard CF function table at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek guard CF function table offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		goto on_error;
+	}
+	table_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * table_size );
+
+	if( table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create guard CF function table data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              table_data,
+	              table_size,
+	              error );
+
+	if( read_count != (ssize_t) table_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read guard CF function table.",
+		 function );
+
+		goto on_error;
+	}
+	load_configuration->guard_cf_function_addresses = (uint32_t *) memory_allocate(
+	                                                                sizeof( uint32_t ) * number_of_entries );
+
+	if( load_configuration->guard_cf_function_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create guard CF function addresses.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry_size > 4 )
+	{
+		load_configuration->guard_cf_function_flags = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * number_of_entries );
+
+		if( load_configuration->guard_cf_function_flags == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create guard CF function flags.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	entry_data = table_data;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_data,
+		 relative_virtual_address );
+
+		if( ( entry_index > 0 )
+		 && ( relative_virtual_address < load_configuration->guard_cf_function_addresses[ entry_index - 1 ] ) )
+		{
+			is_sorted = 0;
+		}
+		load_configuration->guard_cf_function_addresses[ entry_index ] = relative_virtual_address;
+
+		if( load_configuration->guard_cf_function_flags != NULL )
+		{
+			load_configuration->guard_cf_function_flags[ entry_index ] = entry_data[ 4 ];
+		}
+		entry_data += entry_size;
+	}
+	memory_free(
+	 table_data );
+
+	table_data = NULL;
+
+	/* The table should be sorted but this is not enforced in the format
+	 * The RVA and flags are combined into a single value to sort them together
+	 */
+	if( is_sorted == 0 )
+	{
+		guard_cf_function_values = (uint64_t *) memory_allocate(
+		                                         sizeof( uint64_t ) * number_of_entries );
+
+		if( guard_cf_function_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create guard CF function values.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			guard_cf_function_values[ entry_index ] = (uint64_t) load_configuration->guard_cf_function_addresses[ entry_index ] << 8;
+
+			if( load_configuration->guard_cf_function_flags != NULL )
+			{
+				guard_cf_function_values[ entry_index ] |= load_configuration->guard_cf_function_flags[ entry_index ];
+			}
+		}
+		qsort(
+		 guard_cf_function_values,
+		 (size_t) number_of_entries,
+		 sizeof( uint64_t ),
+		 &libexe_load_configuration_compare_guard_cf_function_values );
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			load_configuration->guard_cf_function_addresses[ entry_index ] = (uint32_t) ( guard_cf_function_values[ entry_index ] >> 8 );
+
+			if( load_configuration->guard_cf_function_flags != NULL )
+			{
+				load_configuration->guard_cf_function_flags[ entry_index ] = (uint8_t) ( guard_cf_function_values[ entry_index ] & 0xff );
+			}
+		}
+		memory_free(
+		 guard_cf_function_values );
+	}
+	load_configuration->number_of_guard_cf_functions = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( load_configuration->guard_cf_function_flags != NULL )
+	{
+		memory_free(
+		 load_configuration->guard_cf_function_flags );
+
+		load_configuration->guard_cf_function_flags = NULL;
+	}
+	if( load_configuration->guard_cf_function_addresses != NULL )
+	{
+		memory_free(
+		 load_configuration->guard_cf_function_addresses );
+
+		load_configuration->guard_cf_function_addresses = NULL;
+	}
+	if( table_data != NULL )
+	{
+		memory_free(
+		 table_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of control flow guard functions
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_load_configuration_get_number_of_guard_cf_functions(
+     libexe_load_configuration_t *load_configuration,
+     int *number_of_guard_cf_functions,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_load_configuration_get_number_of_guard_cf_functions";
+
+	if( load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_guard_cf_functions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of guard CF functions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_guard_cf_functions = load_configuration->number_of_guard_cf_functions;
+
+	return( 1 );
+}
+
+/* Retrieves a specific control flow guard function
+ * The flags are 0 if the function table entries do not contain flags
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_load_configuration_get_guard_cf_function_by_index(
+     libexe_load_configuration_t *load_configuration,
+     int guard_cf_function_index,
+     uint32_t *relative_virtual_address,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_load_configuration_get_guard_cf_function_by_index";
+
+	if( load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guard_cf_function_index < 0 )
+	 || ( guard_cf_function_index >= load_configuration->number_of_guard_cf_functions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid guard CF function index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual address.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*relative_virtual_address = load_configuration->guard_cf_function_addresses[ guard_cf_function_index ];
+
+	if( load_configuration->guard_cf_function_flags != NULL )
+	{
+		*flags = load_configuration->guard_cf_function_flags[ guard_cf_function_index ];
+	}
+	else
+	{
+		*flags = 0;
+	}
+	return( 1 );
+}
+
+/* Determines if a relative virtual address is a control flow guard function using a binary search
+ * Returns 1 if the relative virtual address is a control flow guard function, 0 if not or -1 on error
+ */
+int libexe_load_configuration_has_guard_cf_function(
+     libexe_load_configuration_t *load_configuration,
+     uint32_t relative_virtual_address,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_load_configuration_has_guard_cf_function";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( load_configuration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load configuration.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = load_configuration->number_of_guard_cf_functions;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( load_configuration->guard_cf_function_addresses[ middle_index ] < relative_virtual_address )
+		{
+			lower_index = middle_index + 1;
+		}
+		else if( load_configuration->guard_cf_function_addresses[ middle_index ] > relative_virtual_address )
+		{
+			upper_index = middle_index;
+		}
+		else
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,226 @@
+/*
+ * Load configuration functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_LOAD_CONFIGURATION_H )
+#define _LIBEXE_LOAD_CONFIGURATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_load_configuration libexe_load_configuration_t;
+
+struct libexe_load_configuration
+{
+	/* The size
+	 */
+	uint32_t size;
+
+	/* The creation time
+	 */
+	uint32_t creation_time;
+
+	/* The major version
+	 */
+	uint16_t major_version;
+
+	/* The minor version
+	 */
+	uint16_t minor_version;
+
+	/* The global flags to clear
+	 */
+	uint32_t global_flags_clear;
+
+	/* The global flags to set
+	 */
+	uint32_t global_flags_set;
+
+	/* The critical section default timeout
+	 */
+	uint32_t critical_section_default_timeout;
+
+	/* The de-commit free block threshold
+	 */
+	uint64_t de_commit_free_block_threshold;
+
+	/* The de-commit total free threshold
+	 */
+	uint64_t de_commit_total_free_threshold;
+
+	/* The lock prefix table (VA)
+	 */
+	uint64_t lock_prefix_table;
+
+	/* The maximum allocation size
+	 */
+	uint64_t maximum_allocation_size;
+
+	/* The virtual memory threshold
+	 */
+	uint64_t virtual_memory_threshold;
+
+	/* The process affinity mask
+	 */
+	uint64_t process_affinity_mask;
+
+	/* The process heap flags
+	 */
+	uint32_t process_heap_flags;
+
+	/* The CSD version
+	 */
+	uint16_t csd_version;
+
+	/* The dependent load flags
+	 */
+	uint16_t dependent_load_flags;
+
+	/* The edit list (VA)
+	 */
+	uint64_t edit_list;
+
+	/* The security cookie (VA)
+	 */
+	uint64_t security_cookie;
+
+	/* The SE handler table (VA)
+	 */
+	uint64_t se_handler_table;
+
+	/* The SE handler count
+	 */
+	uint64_t se_handler_count;
+
+	/* The control flow guard check function pointer (VA)
+	 */
+	uint64_t guard_cf_check_function_pointer;
+
+	/* The control flow guard dispatch function pointer (VA)
+	 */
+	uint64_t guard_cf_dispatch_function_pointer;
+
+	/* The control flow guard function table (VA)
+	 */
+	uint64_t guard_cf_function_table;
+
+	/* The control flow guard function count
+	 */
+	uint64_t guard_cf_function_count;
+
+	/* The control flow guard flags
+	 */
+	uint32_t guard_flags;
+
+	/* The control flow guard address taken IAT entry table (VA)
+	 */
+	uint64_t guard_address_taken_iat_entry_table;
+
+	/* The control flow guard address taken IAT entry count
+	 */
+	uint64_t guard_address_taken_iat_entry_count;
+
+	/* The control flow guard long jump target table (VA)
+	 */
+	uint64_t guard_long_jump_target_table;
+
+	/* The control flow guard long jump target count
+	 */
+	uint64_t guard_long_jump_target_count;
+
+	/* The exception handling continuation table (VA)
+	 */
+	uint64_t guard_eh_continuation_table;
+
+	/* The exception handling continuation count
+	 */
+	uint64_t guard_eh_continuation_count;
+
+	/* The control flow guard function addresses
+	 * Contains RVAs sorted in ascending order
+	 */
+	uint32_t *guard_cf_function_addresses;
+
+	/* The control flow guard function flags
+	 * Contains NULL if the function table entries do not contain flags
+	 */
+	uint8_t *guard_cf_function_flags;
+
+	/* The number of control flow guard functions
+	 */
+	int number_of_guard_cf_functions;
+};
+
+int libexe_load_configuration_initialize(
+     libexe_load_configuration_t **load_configuration,
+     libcerror_error_t **error );
+
+int libexe_load_configuration_free(
+     libexe_load_configuration_t **load_configuration,
+     libcerror_error_t **error );
+
+int libexe_load_configuration_read(
+     libexe_load_configuration_t *load_configuration,
+     libbfio_handle_t *file_io_handle,
+     uint32_t file_offset,
+     uint32_t size,
+     uint16_t coff_optional_header_signature,
+     libcerror_error_t **error );
+
+int libexe_load_configuration_compare_guard_cf_function_values(
+     const void *first_value,
+     const void *second_value );
+
+int libexe_load_configuration_read_guard_cf_function_table(
+     libexe_load_configuration_t *load_configuration,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libexe_load_configuration_get_number_of_guard_cf_functions(
+     libexe_load_configuration_t *load_configuration,
+     int *number_of_guard_cf_functions,
+     libcerror_error_t **error );
+
+int libexe_load_configuration_get_guard_cf_function_by_index(
+     libexe_load_configuration_t *load_configuration,
+     int guard_cf_function_index,
+     uint32_t *relative_virtual_address,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+int libexe_load_configuration_has_guard_cf_function(
+     libexe_load_configuration_t *load_configuration,
+     uint32_t relative_virtual_address,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,1507 @@
+/*
+ * Content defined chunking Merkle tree functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+#include "libexe_libhmac.h"
+#include "libexe_merkle_tree.h"
+
+/* The signature of the serialized Merkle tree data
+ */
+const char *libexe_merkle_tree_data_signature = "EXEMTREE";
+
+/* Creates a Merkle tree
+ * Make sure the value merkle_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_initialize(
+     libexe_merkle_tree_t **merkle_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_merkle_tree_initialize";
+	int window_index      = 0;
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merkle_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Merkle tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*merkle_tree = memory_allocate_structure(
+	                libexe_merkle_tree_t );
+
+	if( *merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Merkle tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *merkle_tree,
+	     0,
+	     sizeof( libexe_merkle_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Merkle tree.",
+		 function );
+
+		memory_free(
+		 *merkle_tree );
+
+		*merkle_tree = NULL;
+
+		return( -1 );
+	}
+	if( libexe_merkle_tree_start_chunk(
+	     *merkle_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start first chunk.",
+		 function );
+
+		goto on_error;
+	}
+	/* The byte value that leaves the window was multiplied by the base
+	 * once for every other byte value in the window
+	 */
+	( *merkle_tree )->removal_factor = 1;
+
+	for( window_index = 1;
+	     window_index < LIBEXE_MERKLE_TREE_WINDOW_SIZE;
+	     window_index++ )
+	{
+		( *merkle_tree )->removal_factor *= LIBEXE_MERKLE_TREE_ROLLING_HASH_BASE;
+	}
+	return( 1 );
+
+on_error:
+	if( *merkle_tree != NULL )
+	{
+		libexe_merkle_tree_free(
+		 merkle_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a Merkle tree
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_free(
+     libexe_merkle_tree_t **merkle_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_merkle_tree_free";
+	int result            = 1;
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merkle_tree != NULL )
+	{
+		if( ( *merkle_tree )->chunk_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *merkle_tree )->chunk_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *merkle_tree )->node_hashes != NULL )
+		{
+			memory_free(
+			 ( *merkle_tree )->node_hashes );
+		}
+		if( ( *merkle_tree )->chunk_offsets != NULL )
+		{
+			memory_free(
+			 ( *merkle_tree )->chunk_offsets );
+		}
+		memory_free(
+		 *merkle_tree );
+
+		*merkle_tree = NULL;
+	}
+	return( result );
+}
+
+/* Starts a new chunk
+ * The chunk hash is prefixed with a 0 byte to distinguish it from the hashes of the nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_start_chunk(
+     libexe_merkle_tree_t *merkle_tree,
+     libcerror_error_t **error )
+{
+	uint8_t hash_prefix[ 1 ] = { 0 };
+
+	static char *function    = "libexe_merkle_tree_start_chunk";
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( merkle_tree->chunk_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Merkle tree - chunk SHA256 context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_initialize(
+	     &( merkle_tree->chunk_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize chunk SHA256 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_update(
+	     merkle_tree->chunk_context,
+	     hash_prefix,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update chunk SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	merkle_tree->chunk_size = 0;
+
+	return( 1 );
+}
+
+/* Appends the current chunk to the Merkle tree
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_append_chunk(
+     libexe_merkle_tree_t *merkle_tree,
+     libcerror_error_t **error )
+{
+	void *reallocation                = NULL;
+	static char *function             = "libexe_merkle_tree_append_chunk";
+	int number_of_allocated_chunks    = 0;
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( merkle_tree->number_of_chunks >= LIBEXE_MAXIMUM_NUMBER_OF_MERKLE_TREE_CHUNKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid Merkle tree - number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( merkle_tree->number_of_chunks >= merkle_tree->number_of_allocated_chunks )
+	{
+		number_of_allocated_chunks = merkle_tree->number_of_allocated_chunks * 2;
+
+		if( number_of_allocated_chunks == 0 )
+		{
+			number_of_allocated_chunks = 64;
+		}
+		if( number_of_allocated_chunks > LIBEXE_MAXIMUM_NUMBER_OF_MERKLE_TREE_CHUNKS )
+		{
+			number_of_allocated_chunks = LIBEXE_MAXIMUM_NUMBER_OF_MERKLE_TREE_CHUNKS;
+		}
+		reallocation = memory_reallocate(
+		                merkle_tree->chunk_offsets,
+		                sizeof( uint64_t ) * number_of_allocated_chunks );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize chunk offsets.",
+			 function );
+
+			return( -1 );
+		}
+		merkle_tree->chunk_offsets = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                merkle_tree->node_hashes,
+		                sizeof( uint8_t ) * LIBHMAC_SHA256_HASH_SIZE * number_of_allocated_chunks );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize node hashes.",
+			 function );
+
+			return( -1 );
+		}
+		merkle_tree->node_hashes                = (uint8_t *) reallocation;
+		merkle_tree->number_of_allocated_chunks = number_of_allocated_chunks;
+	}
+	if( libhmac_sha256_finalize(
+	     merkle_tree->chunk_context,
+	     &( merkle_tree->node_hashes[ merkle_tree->number_of_chunks * LIBHMAC_SHA256_HASH_SIZE ] ),
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize chunk SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_free(
+	     &( merkle_tree->chunk_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk SHA256 context.",
+		 function );
+
+		return( -1 );
+	}
+	merkle_tree->chunk_offsets[ merkle_tree->number_of_chunks ] = merkle_tree->data_size - merkle_tree->chunk_size;
+
+	merkle_tree->number_of_chunks += 1;
+
+	return( 1 );
+}
+
+/* Updates the Merkle tree
+ * The chunk boundaries are determined by a rolling hash over the last
+ * LIBEXE_MERKLE_TREE_WINDOW_SIZE bytes so that they only depend on the nearby data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_update(
+     libexe_merkle_tree_t *merkle_tree,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_merkle_tree_update";
+	size_t buffer_offset  = 0;
+	size_t chunk_start    = 0;
+	uint8_t byte_value    = 0;
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( merkle_tree->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Merkle tree - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		byte_value = buffer[ buffer_offset ];
+
+		merkle_tree->rolling_hash -= (uint64_t) merkle_tree->window[ merkle_tree->window_index ] * merkle_tree->removal_factor;
+		merkle_tree->rolling_hash *= LIBEXE_MERKLE_TREE_ROLLING_HASH_BASE;
+		merkle_tree->rolling_hash += (uint64_t) byte_value;
+
+		merkle_tree->window[ merkle_tree->window_index ] = byte_value;
+
+		merkle_tree->window_index += 1;
+
+		if( merkle_tree->window_index >= LIBEXE_MERKLE_TREE_WINDOW_SIZE )
+		{
+			merkle_tree->window_index = 0;
+		}
+		merkle_tree->chunk_size += 1;
+		merkle_tree->data_size  += 1;
+
+		if( merkle_tree->chunk_size < LIBEXE_MERKLE_TREE_MINIMUM_CHUNK_SIZE )
+		{
+			continue;
+		}
+		if( ( merkle_tree->chunk_size < LIBEXE_MERKLE_TREE_MAXIMUM_CHUNK_SIZE )
+		 && ( ( merkle_tree->rolling_hash & LIBEXE_MERKLE_TREE_BOUNDARY_MASK ) != 0 ) )
+		{
+			continue;
+		}
+		if( libhmac_sha256_update(
+		     merkle_tree->chunk_context,
+		     &( buffer[ chunk_start ] ),
+		     buffer_offset + 1 - chunk_start,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update chunk SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( libexe_merkle_tree_append_chunk(
+		     merkle_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append chunk.",
+			 function );
+
+			return( -1 );
+		}
+		if( libexe_merkle_tree_start_chunk(
+		     merkle_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start chunk.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_start = buffer_offset + 1;
+	}
+	if( chunk_start < size )
+	{
+		if( libhmac_sha256_update(
+		     merkle_tree->chunk_context,
+		     &( buffer[ chunk_start ] ),
+		     size - chunk_start,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update chunk SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the SHA256 hash of a node
+ * Returns 1 if successful or -1 on error
+ */
+static int libexe_merkle_tree_calculate_node_hash(
+            const uint8_t *node_data,
+            size_t node_data_size,
+            uint8_t *hash,
+            size_t hash_size,
+            libcerror_error_t **error )
+{
+	libhmac_sha256_context_t *context = NULL;
+	static char *function             = "libexe_merkle_tree_calculate_node_hash";
+
+	if( libhmac_sha256_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_update(
+	     context,
+	     node_data,
+	     node_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_finalize(
+	     context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_free(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		libhmac_sha256_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Finalizes the Merkle tree
+ * The hash of a node is the hash of a 1 byte followed by the hashes of its 2 child nodes,
+ * a node without a sibling is moved up to the next level unchanged
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_finalize(
+     libexe_merkle_tree_t *merkle_tree,
+     libcerror_error_t **error )
+{
+	uint8_t node_data[ 1 + ( 2 * LIBHMAC_SHA256_HASH_SIZE ) ];
+
+	void *reallocation    = NULL;
+	static char *function = "libexe_merkle_tree_finalize";
+	int level_offset      = 0;
+	int level_size        = 0;
+	int node_index        = 0;
+	int number_of_nodes   = 0;
+	int write_index       = 0;
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( merkle_tree->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Merkle tree - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( merkle_tree->chunk_size > 0 )
+	{
+		if( libexe_merkle_tree_append_chunk(
+		     merkle_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append last chunk.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libhmac_sha256_free(
+	          &( merkle_tree->chunk_context ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk SHA256 context.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_nodes = merkle_tree->number_of_chunks;
+	level_size      = merkle_tree->number_of_chunks;
+
+	while( level_size > 1 )
+	{
+		level_size       = ( level_size + 1 ) / 2;
+		number_of_nodes += level_size;
+	}
+	if( number_of_nodes > merkle_tree->number_of_chunks )
+	{
+		reallocation = memory_reallocate(
+		                merkle_tree->node_hashes,
+		                sizeof( uint8_t ) * LIBHMAC_SHA256_HASH_SIZE * number_of_nodes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize node hashes.",
+			 function );
+
+			return( -1 );
+		}
+		merkle_tree->node_hashes = (uint8_t *) reallocation;
+	}
+	node_data[ 0 ] = 1;
+
+	level_offset = 0;
+	level_size   = merkle_tree->number_of_chunks;
+	write_index  = merkle_tree->number_of_chunks;
+
+	while( level_size > 1 )
+	{
+		for( node_index = 0;
+		     node_index < level_size;
+		     node_index += 2 )
+		{
+			if( ( node_index + 1 ) < level_size )
+			{
+				if( memory_copy(
+				     &( node_data[ 1 ] ),
+				     &( merkle_tree->node_hashes[ ( level_offset + node_index ) * LIBHMAC_SHA256_HASH_SIZE ] ),
+				     2 * LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy child node hashes.",
+					 function );
+
+					return( -1 );
+				}
+				if( libexe_merkle_tree_calculate_node_hash(
+				     node_data,
+				     1 + ( 2 * LIBHMAC_SHA256_HASH_SIZE ),
+				     &( merkle_tree->node_hashes[ write_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+				     LIBHMAC_SHA256_HASH_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to calculate node SHA256 hash.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else if( memory_copy(
+			          &( merkle_tree->node_hashes[ write_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+			          &( merkle_tree->node_hashes[ ( level_offset + node_index ) * LIBHMAC_SHA256_HASH_SIZE ] ),
+			          LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy node hash.",
+				 function );
+
+				return( -1 );
+			}
+			write_index++;
+		}
+		level_offset += level_size;
+		level_size    = ( level_size + 1 ) / 2;
+	}
+	merkle_tree->number_of_nodes = number_of_nodes;
+	merkle_tree->is_finalized    = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the root hash
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_merkle_tree_get_root_hash(
+     libexe_merkle_tree_t *merkle_tree,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_merkle_tree_get_root_hash";
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < LIBHMAC_SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( merkle_tree->is_finalized == 0 )
+	 || ( merkle_tree->number_of_nodes == 0 ) )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     hash,
+	     &( merkle_tree->node_hashes[ ( merkle_tree->number_of_nodes - 1 ) * LIBHMAC_SHA256_HASH_SIZE ] ),
+	     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy root hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the serialized Merkle tree data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_get_data_size(
+     libexe_merkle_tree_t *merkle_tree,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_merkle_tree_get_data_size";
+
+	if( merkle_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Merkle tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( merkle_tree->is_finalized == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Merkle tree - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = LIBEXE_MERKLE_TREE_DATA_HEADER_SIZE
+	           + ( (size_t) merkle_tree->number_of_chunks * 8 )
+	           + ( (size_t) merkle_tree->number_of_nodes * LIBHMAC_SHA256_HASH_SIZE );
+
+	return( 1 );
+}
+
+/* Retrieves the serialized Merkle tree data
+ * The data consists of:
+ *   a header of LIBEXE_MERKLE_TREE_DATA_HEADER_SIZE bytes containing the signature "EXEMTREE",
+ *   a 32-bit format version, a 32-bit number of chunks and the 64-bit size of the data
+ *   the 64-bit offset of every chunk relative to the start of the data
+ *   the node hashes, the chunk hashes first, followed by every next level and the root hash last
+ * All values are stored in little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_get_data(
+     libexe_merkle_tree_t *merkle_tree,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libexe_merkle_tree_get_data";
+	size_t data_offset          = 0;
+	size_t required_data_size   = 0;
+	int chunk_index             = 0;
+
+	if( libexe_merkle_tree_get_data_size(
+	     merkle_tree,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < required_data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     libexe_merkle_tree_data_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 LIBEXE_MERKLE_TREE_DATA_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 (uint32_t) merkle_tree->number_of_chunks );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 merkle_tree->data_size );
+
+	data_offset = LIBEXE_MERKLE_TREE_DATA_HEADER_SIZE;
+
+	for( chunk_index = 0;
+	     chunk_index < merkle_tree->number_of_chunks;
+	     chunk_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 merkle_tree->chunk_offsets[ chunk_index ] );
+
+		data_offset += 8;
+	}
+	if( merkle_tree->number_of_nodes > 0 )
+	{
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     merkle_tree->node_hashes,
+		     (size_t) merkle_tree->number_of_nodes * LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy node hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the values of serialized Merkle tree data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_merkle_tree_data_get_values(
+     const uint8_t *data,
+     size_t data_size,
+     int *number_of_chunks,
+     uint64_t *chunks_data_size,
+     const uint8_t **chunk_offsets_data,
+     const uint8_t **node_hashes_data,
+     libcerror_error_t **error )
+{
+	static char *function       = "libexe_merkle_tree_data_get_values";
+	size_t required_data_size   = 0;
+	uint32_t format_version     = 0;
+	uint32_t value_32bit        = 0;
+	int level_size              = 0;
+	int number_of_nodes         = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LIBEXE_MERKLE_TREE_DATA_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offsets_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offsets data.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_hashes_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node hashes data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     libexe_merkle_tree_data_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 format_version );
+
+	if( format_version != LIBEXE_MERKLE_TREE_DATA_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) LIBEXE_MAXIMUM_NUMBER_OF_MERKLE_TREE_CHUNKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_nodes = (int) value_32bit;
+	level_size      = (int) value_32bit;
+
+	while( level_size > 1 )
+	{
+		level_size       = ( level_size + 1 ) / 2;
+		number_of_nodes += level_size;
+	}
+	required_data_size = LIBEXE_MERKLE_TREE_DATA_HEADER_SIZE
+	                   + ( (size_t) value_32bit * 8 )
+	                   + ( (size_t) number_of_nodes * LIBHMAC_SHA256_HASH_SIZE );
+
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = (int) value_32bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 *chunks_data_size );
+
+	*chunk_offsets_data = &( data[ LIBEXE_MERKLE_TREE_DATA_HEADER_SIZE ] );
+	*node_hashes_data   = &( data[ LIBEXE_MERKLE_TREE_DATA_HEADER_SIZE + ( (size_t) value_32bit * 8 ) ] );
+
+	return( 1 );
+}
+
+/* Retrieves a specific node hash of serialized Merkle tree data
+ * Level 0 contains the chunk hashes
+ * Returns a pointer to the node hash or NULL if the node does not exist
+ */
+const uint8_t *libexe_merkle_tree_data_get_node_hash(
+                const uint8_t *node_hashes_data,
+                int number_of_chunks,
+                int level,
+                int node_index )
+{
+	int level_index  = 0;
+	int level_offset = 0;
+	int level_size   = 0;
+
+	if( ( node_hashes_data == NULL )
+	 || ( number_of_chunks <= 0 )
+	 || ( level < 0 )
+	 || ( node_index < 0 ) )
+	{
+		return( NULL );
+	}
+	level_size = number_of_chunks;
+
+	for( level_index = 0;
+	     level_index < level;
+	     level_index++ )
+	{
+		if( level_size <= 1 )
+		{
+			return( NULL );
+		}
+		level_offset += level_size;
+		level_size    = ( level_size + 1 ) / 2;
+	}
+	if( node_index >= level_size )
+	{
+		return( NULL );
+	}
+	return( &( node_hashes_data[ ( level_offset + node_index ) * LIBHMAC_SHA256_HASH_SIZE ] ) );
+}
+
+/* Retrieves the range of a specific chunk of serialized Merkle tree data
+ * Returns 1 if successful or 0 if the chunk does not exist
+ */
+int libexe_merkle_tree_data_get_chunk_range(
+     const uint8_t *chunk_offsets_data,
+     int number_of_chunks,
+     uint64_t chunks_data_size,
+     int chunk_index,
+     uint64_t *chunk_offset,
+     uint64_t *chunk_size )
+{
+	uint64_t next_chunk_offset = 0;
+
+	if( ( chunk_offsets_data == NULL )
+	 || ( chunk_index < 0 )
+	 || ( chunk_index >= number_of_chunks ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( chunk_offsets_data[ chunk_index * 8 ] ),
+	 *chunk_offset );
+
+	if( ( chunk_index + 1 ) < number_of_chunks )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( chunk_offsets_data[ ( chunk_index + 1 ) * 8 ] ),
+		 next_chunk_offset );
+	}
+	else
+	{
+		next_chunk_offset = chunks_data_size;
+	}
+	if( next_chunk_offset < *chunk_offset )
+	{
+		return( 0 );
+	}
+	*chunk_size = next_chunk_offset - *chunk_offset;
+
+	return( 1 );
+}
+
+/* Searches a subtree of 2 serialized Merkle trees for the first differing chunk
+ * Subtrees with equal hashes are skipped without visiting their nodes
+ * Returns 1 if a differing chunk was found or 0 if not
+ */
+static int libexe_merkle_tree_data_find_differing_chunk(
+            const uint8_t *node_hashes_data1,
+            int number_of_chunks1,
+            const uint8_t *node_hashes_data2,
+            int number_of_chunks2,
+            int level,
+            int node_index,
+            int start_chunk_index,
+            int *chunk_index )
+{
+	const uint8_t *node_hash1 = NULL;
+	const uint8_t *node_hash2 = NULL;
+	int64_t first_chunk_index = 0;
+	int64_t last_chunk_index  = 0;
+
+	first_chunk_index = (int64_t) node_index << level;
+	last_chunk_index  = ( ( (int64_t) node_index + 1 ) << level ) - 1;
+
+	if( ( first_chunk_index >= number_of_chunks1 )
+	 && ( first_chunk_index >= number_of_chunks2 ) )
+	{
+		return( 0 );
+	}
+	if( last_chunk_index < start_chunk_index )
+	{
+		return( 0 );
+	}
+	node_hash1 = libexe_merkle_tree_data_get_node_hash(
+	              node_hashes_data1,
+	              number_of_chunks1,
+	              level,
+	              node_index );
+
+	node_hash2 = libexe_merkle_tree_data_get_node_hash(
+	              node_hashes_data2,
+	              number_of_chunks2,
+	              level,
+	              node_index );
+
+	if( ( node_hash1 != NULL )
+	 && ( node_hash2 != NULL ) )
+	{
+		if( memory_compare(
+		     node_hash1,
+		     node_hash2,
+		     LIBHMAC_SHA256_HASH_SIZE ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( level == 0 )
+	{
+		*chunk_index = node_index;
+
+		return( 1 );
+	}
+	if( libexe_merkle_tree_data_find_differing_chunk(
+	     node_hashes_data1,
+	     number_of_chunks1,
+	     node_hashes_data2,
+	     number_of_chunks2,
+	     level - 1,
+	     node_index * 2,
+	     start_chunk_index,
+	     chunk_index ) != 0 )
+	{
+		return( 1 );
+	}
+	return( libexe_merkle_tree_data_find_differing_chunk(
+	         node_hashes_data1,
+	         number_of_chunks1,
+	         node_hashes_data2,
+	         number_of_chunks2,
+	         level - 1,
+	         ( node_index * 2 ) + 1,
+	         start_chunk_index,
+	         chunk_index ) );
+}
+
+/* Retrieves the next differing chunk of 2 serialized Merkle trees
+ * The trees are walked from the root and only the subtrees with differing hashes are visited
+ * The chunk offset and size are relative to the start of the data of the first tree,
+ * or of the second tree if the chunk only exists in the second tree
+ * Returns 1 if successful, 0 if there are no more differing chunks or -1 on error
+ */
+int libexe_merkle_tree_data_get_next_differing_chunk(
+     const uint8_t *data1,
+     size_t data1_size,
+     const uint8_t *data2,
+     size_t data2_size,
+     int start_chunk_index,
+     int *chunk_index,
+     uint64_t *chunk_offset,
+     uint64_t *chunk_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *chunk_offsets_data1 = NULL;
+	const uint8_t *chunk_offsets_data2 = NULL;
+	const uint8_t *node_hashes_data1   = NULL;
+	const uint8_t *node_hashes_data2   = NULL;
+	static char *function              = "libexe_merkle_tree_data_get_next_differing_chunk";
+	uint64_t chunks_data_size1         = 0;
+	uint64_t chunks_data_size2         = 0;
+	int level                          = 0;
+	int level_size                     = 0;
+	int number_of_chunks1              = 0;
+	int number_of_chunks2              = 0;
+
+	if( start_chunk_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start chunk index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_merkle_tree_data_get_values(
+	     data1,
+	     data1_size,
+	     &number_of_chunks1,
+	     &chunks_data_size1,
+	     &chunk_offsets_data1,
+	     &node_hashes_data1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values of first Merkle tree data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_merkle_tree_data_get_values(
+	     data2,
+	     data2_size,
+	     &number_of_chunks2,
+	     &chunks_data_size2,
+	     &chunk_offsets_data2,
+	     &node_hashes_data2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values of second Merkle tree data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Start at the level of the root of the largest tree
+	 */
+	if( number_of_chunks1 > number_of_chunks2 )
+	{
+		level_size = number_of_chunks1;
+	}
+	else
+	{
+		level_size = number_of_chunks2;
+	}
+	while( level_size > 1 )
+	{
+		level_size = ( level_size + 1 ) / 2;
+		level     += 1;
+	}
+	if( libexe_merkle_tree_data_find_differing_chunk(
+	     node_hashes_data1,
+	     number_of_chunks1,
+	     node_hashes_data2,
+	     number_of_chunks2,
+	     level,
+	     0,
+	     start_chunk_index,
+	     chunk_index ) == 0 )
+	{
+		return( 0 );
+	}
+	if( libexe_merkle_tree_data_get_chunk_range(
+	     chunk_offsets_data1,
+	     number_of_chunks1,
+	     chunks_data_size1,
+	     *chunk_index,
+	     chunk_offset,
+	     chunk_size ) == 0 )
+	{
+		if( libexe_merkle_tree_data_get_chunk_range(
+		     chunk_offsets_data2,
+		     number_of_chunks2,
+		     chunks_data_size2,
+		     *chunk_index,
+		     chunk_offset,
+		     chunk_size ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %d range value out of bounds.",
+			 function,
+			 *chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,177 @@
+/*
+ * Content defined chunking Merkle tree functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_MERKLE_TREE_H )
+#define _LIBEXE_MERKLE_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_extern.h"
+#include "libexe_libcerror.h"
+#include "libexe_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_merkle_tree libexe_merkle_tree_t;
+
+struct libexe_merkle_tree
+{
+	/* The data size
+	 */
+	uint64_t data_size;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The number of allocated chunks
+	 */
+	int number_of_allocated_chunks;
+
+	/* The chunk offsets
+	 */
+	uint64_t *chunk_offsets;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The node hashes, the chunk hashes first and the root hash last
+	 */
+	uint8_t *node_hashes;
+
+	/* The SHA256 context of the current chunk
+	 */
+	libhmac_sha256_context_t *chunk_context;
+
+	/* The size of the current chunk
+	 */
+	uint32_t chunk_size;
+
+	/* The rolling hash
+	 */
+	uint64_t rolling_hash;
+
+	/* The factor of the byte value that leaves the rolling hash window
+	 */
+	uint64_t removal_factor;
+
+	/* The rolling hash window
+	 */
+	uint8_t window[ LIBEXE_MERKLE_TREE_WINDOW_SIZE ];
+
+	/* The rolling hash window index
+	 */
+	int window_index;
+
+	/* Value to indicate the Merkle tree has been finalized
+	 */
+	uint8_t is_finalized;
+};
+
+int libexe_merkle_tree_initialize(
+     libexe_merkle_tree_t **merkle_tree,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_free(
+     libexe_merkle_tree_t **merkle_tree,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_start_chunk(
+     libexe_merkle_tree_t *merkle_tree,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_append_chunk(
+     libexe_merkle_tree_t *merkle_tree,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_update(
+     libexe_merkle_tree_t *merkle_tree,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_finalize(
+     libexe_merkle_tree_t *merkle_tree,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_get_root_hash(
+     libexe_merkle_tree_t *merkle_tree,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_get_data_size(
+     libexe_merkle_tree_t *merkle_tree,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_get_data(
+     libexe_merkle_tree_t *merkle_tree,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libexe_merkle_tree_data_get_values(
+     const uint8_t *data,
+     size_t data_size,
+     int *number_of_chunks,
+     uint64_t *chunks_data_size,
+     const uint8_t **chunk_offsets_data,
+     const uint8_t **node_hashes_data,
+     libcerror_error_t **error );
+
+const uint8_t *libexe_merkle_tree_data_get_node_hash(
+                const uint8_t *node_hashes_data,
+                int number_of_chunks,
+                int level,
+                int node_index );
+
+int libexe_merkle_tree_data_get_chunk_range(
+     const uint8_t *chunk_offsets_data,
+     int number_of_chunks,
+     uint64_t chunks_data_size,
+     int chunk_index,
+     uint64_t *chunk_offset,
+     uint64_t *chunk_size );
+
+LIBEXE_EXTERN \
+int libexe_merkle_tree_data_get_next_differing_chunk(
+     const uint8_t *data1,
+     size_t data1_size,
+     const uint8_t *data2,
+     size_t data2_size,
+     int start_chunk_index,
+     int *chunk_index,
+     uint64_t *chunk_offset,
+     uint64_t *chunk_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_MERKLE_TREE_H ) */
+
@@ -0,0 +1,1462 @@
+/*
+ * Page hashes functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_libhmac.h"
+#include "libexe_page_hashes.h"
+
+/* Creates page hashes
+ * Make sure the value page_hashes is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_initialize(
+     libexe_page_hashes_t **page_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_page_hashes_initialize";
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_hashes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*page_hashes = memory_allocate_structure(
+	                libexe_page_hashes_t );
+
+	if( *page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_hashes,
+	     0,
+	     sizeof( libexe_page_hashes_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page hashes.",
+		 function );
+
+		memory_free(
+		 *page_hashes );
+
+		*page_hashes = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *page_hashes != NULL )
+	{
+		memory_free(
+		 *page_hashes );
+
+		*page_hashes = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees page hashes
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_free(
+     libexe_page_hashes_t **page_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_page_hashes_free";
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_hashes != NULL )
+	{
+		if( ( *page_hashes )->sha256_hashes != NULL )
+		{
+			memory_free(
+			 ( *page_hashes )->sha256_hashes );
+		}
+		if( ( *page_hashes )->sha1_hashes != NULL )
+		{
+			memory_free(
+			 ( *page_hashes )->sha1_hashes );
+		}
+		if( ( *page_hashes )->page_sizes != NULL )
+		{
+			memory_free(
+			 ( *page_hashes )->page_sizes );
+		}
+		if( ( *page_hashes )->page_offsets != NULL )
+		{
+			memory_free(
+			 ( *page_hashes )->page_offsets );
+		}
+		memory_free(
+		 *page_hashes );
+
+		*page_hashes = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two section ranges
+ * A section range contains the data offset in the upper 32-bit and the data size in the lower 32-bit
+ * Returns -1 if the first value is less than the second, 1 if greater or 0 if equal
+ */
+int libexe_page_hashes_compare_section_ranges(
+     const void *first_value,
+     const void *second_value )
+{
+	uint64_t first_section_range  = *( (uint64_t *) first_value );
+	uint64_t second_section_range = *( (uint64_t *) second_value );
+
+	if( first_section_range < second_section_range )
+	{
+		return( -1 );
+	}
+	else if( first_section_range > second_section_range )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the page layout
+ * The first page contains the headers, followed by the pages of the section data
+ * in order of their data offset and a terminating page without data, that contains
+ * the offset of the end of the section data
+ * A section range contains the data offset in the upper 32-bit and the data size in the lower 32-bit,
+ * the section ranges are sorted in place
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_set_layout(
+     libexe_page_hashes_t *page_hashes,
+     uint32_t headers_size,
+     uint64_t *section_ranges,
+     int number_of_section_ranges,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libexe_page_hashes_set_layout";
+	uint64_t number_of_pages = 0;
+	uint64_t section_offset  = 0;
+	uint64_t section_size    = 0;
+	uint32_t end_offset      = 0;
+	int page_index           = 0;
+	int range_index          = 0;
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_hashes->page_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page hashes - page offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_section_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of section ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_section_ranges > 0 )
+	 && ( section_ranges == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) headers_size > file_size )
+	{
+		headers_size = (uint32_t) file_size;
+	}
+	end_offset = headers_size;
+
+	if( number_of_section_ranges > 0 )
+	{
+		qsort(
+		 section_ranges,
+		 (size_t) number_of_section_ranges,
+		 sizeof( uint64_t ),
+		 &libexe_page_hashes_compare_section_ranges );
+	}
+	/* Determine the number of pages, including the headers and the terminating page
+	 */
+	number_of_pages = 2;
+
+	for( range_index = 0;
+	     range_index < number_of_section_ranges;
+	     range_index++ )
+	{
+		section_offset = section_ranges[ range_index ] >> 32;
+		section_size   = section_ranges[ range_index ] & 0xffffffffUL;
+
+		if( section_offset >= file_size )
+		{
+			continue;
+		}
+		if( section_size > ( file_size - section_offset ) )
+		{
+			section_size = file_size - section_offset;
+		}
+		number_of_pages += ( section_size + LIBEXE_PAGE_HASH_PAGE_SIZE - 1 ) / LIBEXE_PAGE_HASH_PAGE_SIZE;
+	}
+	if( number_of_pages > (uint64_t) LIBEXE_MAXIMUM_NUMBER_OF_PAGE_HASHES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of pages value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	page_hashes->page_offsets = (uint32_t *) memory_allocate(
+	                                          sizeof( uint32_t ) * (size_t) number_of_pages );
+
+	if( page_hashes->page_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page offsets.",
+		 function );
+
+		goto on_error;
+	}
+	page_hashes->page_sizes = (uint32_t *) memory_allocate(
+	                                        sizeof( uint32_t ) * (size_t) number_of_pages );
+
+	if( page_hashes->page_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page sizes.",
+		 function );
+
+		goto on_error;
+	}
+	page_hashes->sha1_hashes = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * LIBHMAC_SHA1_HASH_SIZE * (size_t) number_of_pages );
+
+	if( page_hashes->sha1_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create SHA1 hashes.",
+		 function );
+
+		goto on_error;
+	}
+	page_hashes->sha256_hashes = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * LIBHMAC_SHA256_HASH_SIZE * (size_t) number_of_pages );
+
+	if( page_hashes->sha256_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create SHA256 hashes.",
+		 function );
+
+		goto on_error;
+	}
+	page_hashes->page_offsets[ 0 ] = 0;
+	page_hashes->page_sizes[ 0 ]   = headers_size;
+
+	page_index = 1;
+
+	for( range_index = 0;
+	     range_index < number_of_section_ranges;
+	     range_index++ )
+	{
+		section_offset = section_ranges[ range_index ] >> 32;
+		section_size   = section_ranges[ range_index ] & 0xffffffffUL;
+
+		if( section_offset >= file_size )
+		{
+			continue;
+		}
+		if( section_size > ( file_size - section_offset ) )
+		{
+			section_size = file_size - section_offset;
+		}
+		if( section_size == 0 )
+		{
+			continue;
+		}
+		end_offset = (uint32_t) ( section_offset + section_size );
+
+		while( section_size > 0 )
+		{
+			page_hashes->page_offsets[ page_index ] = (uint32_t) section_offset;
+
+			if( section_size > LIBEXE_PAGE_HASH_PAGE_SIZE )
+			{
+				page_hashes->page_sizes[ page_index ] = LIBEXE_PAGE_HASH_PAGE_SIZE;
+			}
+			else
+			{
+				page_hashes->page_sizes[ page_index ] = (uint32_t) section_size;
+			}
+			section_offset += page_hashes->page_sizes[ page_index ];
+			section_size   -= page_hashes->page_sizes[ page_index ];
+
+			page_index++;
+		}
+	}
+	page_hashes->page_offsets[ page_index ] = end_offset;
+	page_hashes->page_sizes[ page_index ]   = 0;
+
+	page_index++;
+
+	page_hashes->number_of_pages = page_index;
+
+	return( 1 );
+
+on_error:
+	if( page_hashes->sha256_hashes != NULL )
+	{
+		memory_free(
+		 page_hashes->sha256_hashes );
+
+		page_hashes->sha256_hashes = NULL;
+	}
+	if( page_hashes->sha1_hashes != NULL )
+	{
+		memory_free(
+		 page_hashes->sha1_hashes );
+
+		page_hashes->sha1_hashes = NULL;
+	}
+	if( page_hashes->page_sizes != NULL )
+	{
+		memory_free(
+		 page_hashes->page_sizes );
+
+		page_hashes->page_sizes = NULL;
+	}
+	if( page_hashes->page_offsets != NULL )
+	{
+		memory_free(
+		 page_hashes->page_offsets );
+
+		page_hashes->page_offsets = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets a range that is excluded from the page hashes, such as the checksum
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_set_excluded_range(
+     libexe_page_hashes_t *page_hashes,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_page_hashes_set_excluded_range";
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_hashes->number_of_excluded_ranges >= 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page hashes - number of excluded ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid range size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	page_hashes->excluded_range_start[ page_hashes->number_of_excluded_ranges ] = range_offset;
+	page_hashes->excluded_range_end[ page_hashes->number_of_excluded_ranges ]   = range_offset + (off64_t) range_size;
+
+	page_hashes->number_of_excluded_ranges += 1;
+
+	return( 1 );
+}
+
+/* Computes the hashes of a specific page
+ * The page data is read into the page data buffer, which must be of page size
+ * Excluded ranges are left out of the headers page and data smaller than the page size
+ * is padded with 0-byte values
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_compute_page(
+     libexe_page_hashes_t *page_hashes,
+     libbfio_handle_t *file_io_handle,
+     int page_index,
+     uint8_t *page_data,
+     libcerror_error_t **error )
+{
+	libhmac_sha1_context_t *sha1_context     = NULL;
+	libhmac_sha256_context_t *sha256_context = NULL;
+	static char *function                    = "libexe_page_hashes_compute_page";
+	size_t data_offset                       = 0;
+	size_t data_size                         = 0;
+	size_t segment_size                      = 0;
+	ssize_t read_count                       = 0;
+	off64_t excluded_offset                  = 0;
+	off64_t file_offset                      = 0;
+	uint32_t page_size                       = 0;
+	int number_of_excluded_ranges            = 0;
+	int range_index                          = 0;
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_index < 0 )
+	 || ( page_index >= page_hashes->number_of_pages ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The terminating page has no data and its hashes are 0-byte values
+	 */
+	if( page_hashes->page_sizes[ page_index ] == 0 )
+	{
+		if( memory_set(
+		     &( page_hashes->sha1_hashes[ page_index * LIBHMAC_SHA1_HASH_SIZE ] ),
+		     0,
+		     LIBHMAC_SHA1_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     &( page_hashes->sha256_hashes[ page_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+		     0,
+		     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libhmac_sha1_initialize(
+	     &sha1_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA1 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_initialize(
+	     &sha256_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) page_hashes->page_offsets[ page_index ];
+	page_size   = page_hashes->page_sizes[ page_index ];
+
+	/* The excluded ranges only apply to the headers page
+	 */
+	if( page_index == 0 )
+	{
+		number_of_excluded_ranges = page_hashes->number_of_excluded_ranges;
+	}
+
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek page: %d offset: %" PRIi64 ".",
+		 function,
+		 page_index,
+		 file_offset );
+
+		goto on_error;
+	}
+	/* The headers page can be larger than the page size
+	 */
+	while( page_size > 0 )
+	{
+		data_size = LIBEXE_PAGE_HASH_PAGE_SIZE;
+
+		if( data_size > (size_t) page_size )
+		{
+			data_size = (size_t) page_size;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              page_data,
+		              data_size,
+		              error );
+
+		if( read_count != (ssize_t) data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page: %d data.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+		data_offset = 0;
+
+		while( data_offset < data_size )
+		{
+			/* Skip an excluded range that contains the current offset
+			 */
+			for( range_index = 0;
+			     range_index < number_of_excluded_ranges;
+			     range_index++ )
+			{
+				if( ( page_hashes->excluded_range_start[ range_index ] <= ( file_offset + (off64_t) data_offset ) )
+				 && ( page_hashes->excluded_range_end[ range_index ] > ( file_offset + (off64_t) data_offset ) ) )
+				{
+					excluded_offset = page_hashes->excluded_range_end[ range_index ] - file_offset;
+
+					if( excluded_offset > (off64_t) data_size )
+					{
+						excluded_offset = (off64_t) data_size;
+					}
+					data_offset = (size_t) excluded_offset;
+
+					break;
+				}
+			}
+			if( range_index < number_of_excluded_ranges )
+			{
+				continue;
+			}
+			segment_size = data_size - data_offset;
+
+			/* Stop at the start of the next excluded range
+			 */
+			for( range_index = 0;
+			     range_index < number_of_excluded_ranges;
+			     range_index++ )
+			{
+				excluded_offset = page_hashes->excluded_range_start[ range_index ] - file_offset;
+
+				if( ( excluded_offset > (off64_t) data_offset )
+				 && ( excluded_offset < (off64_t) ( data_offset + segment_size ) ) )
+				{
+					segment_size = (size_t) excluded_offset - data_offset;
+				}
+			}
+			if( libhmac_sha1_update(
+			     sha1_context,
+			     &( page_data[ data_offset ] ),
+			     segment_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA1 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+			if( libhmac_sha256_update(
+			     sha256_context,
+			     &( page_data[ data_offset ] ),
+			     segment_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA256 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset += segment_size;
+		}
+		file_offset += (off64_t) data_size;
+		page_size   -= (uint32_t) data_size;
+	}
+	/* Data smaller than the page size is padded with 0-byte values
+	 */
+	if( page_hashes->page_sizes[ page_index ] < LIBEXE_PAGE_HASH_PAGE_SIZE )
+	{
+		data_size = LIBEXE_PAGE_HASH_PAGE_SIZE - (size_t) page_hashes->page_sizes[ page_index ];
+
+		if( memory_set(
+		     page_data,
+		     0,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear page data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha1_update(
+		     sha1_context,
+		     page_data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA1 digest hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_update(
+		     sha256_context,
+		     page_data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 digest hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libhmac_sha1_finalize(
+	     sha1_context,
+	     &( page_hashes->sha1_hashes[ page_index * LIBHMAC_SHA1_HASH_SIZE ] ),
+	     LIBHMAC_SHA1_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize SHA1 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_finalize(
+	     sha256_context,
+	     &( page_hashes->sha256_hashes[ page_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_free(
+	     &sha256_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha1_free(
+	     &sha1_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA1 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Computes the hashes of a range of pages
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_compute_pages(
+     libexe_page_hashes_t *page_hashes,
+     libbfio_handle_t *file_io_handle,
+     int first_page_index,
+     int end_page_index,
+     libcerror_error_t **error )
+{
+	uint8_t *page_data    = NULL;
+	static char *function = "libexe_page_hashes_compute_pages";
+	int page_index        = 0;
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_page_index < 0 )
+	 || ( first_page_index > end_page_index )
+	 || ( end_page_index > page_hashes->number_of_pages ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * LIBEXE_PAGE_HASH_PAGE_SIZE );
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data.",
+		 function );
+
+		return( -1 );
+	}
+	for( page_index = first_page_index;
+	     page_index < end_page_index;
+	     page_index++ )
+	{
+		if( libexe_page_hashes_compute_page(
+		     page_hashes,
+		     file_io_handle,
+		     page_index,
+		     page_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compute hashes of page: %d.",
+			 function,
+			 page_index );
+
+			memory_free(
+			 page_data );
+
+			return( -1 );
+		}
+	}
+	memory_free(
+	 page_data );
+
+	return( 1 );
+}
+
+/* Computes the hashes of a range of pages in a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_compute_pages_thread_callback(
+     void *arguments )
+{
+	libexe_page_hashes_thread_arguments_t *thread_arguments = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments = (libexe_page_hashes_thread_arguments_t *) arguments;
+
+	thread_arguments->result = libexe_page_hashes_compute_pages(
+	                            thread_arguments->page_hashes,
+	                            thread_arguments->file_io_handle,
+	                            thread_arguments->first_page_index,
+	                            thread_arguments->end_page_index,
+	                            NULL );
+
+	return( thread_arguments->result );
+}
+
+/* Computes the hashes of all pages
+ * The pages are split into contiguous ranges that are hashed by worker threads,
+ * each with its own file IO handle. Without multi-threading support or if the number
+ * of threads is 1 or less the pages are hashed in the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_compute(
+     libexe_page_hashes_t *page_hashes,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libexe_page_hashes_thread_arguments_t *thread_arguments = NULL;
+	libcthreads_thread_t **threads                          = NULL;
+	int number_of_pages_per_thread                          = 0;
+	int result                                              = 1;
+	int thread_index                                        = 0;
+#endif
+	static char *function                                   = "libexe_page_hashes_compute";
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_hashes->page_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page hashes - missing page offsets.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > LIBEXE_MAXIMUM_NUMBER_OF_PAGE_HASH_THREADS )
+	{
+		number_of_threads = LIBEXE_MAXIMUM_NUMBER_OF_PAGE_HASH_THREADS;
+	}
+	if( number_of_threads > page_hashes->number_of_pages )
+	{
+		number_of_threads = page_hashes->number_of_pages;
+	}
+	if( number_of_threads > 1 )
+	{
+		threads = (libcthreads_thread_t **) memory_allocate(
+		                                     sizeof( libcthreads_thread_t * ) * number_of_threads );
+
+		if( threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     threads,
+		     0,
+		     sizeof( libcthreads_thread_t * ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			goto on_error;
+		}
+		thread_arguments = (libexe_page_hashes_thread_arguments_t *) memory_allocate(
+		                                                              sizeof( libexe_page_hashes_thread_arguments_t ) * number_of_threads );
+
+		if( thread_arguments == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create thread arguments.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     thread_arguments,
+		     0,
+		     sizeof( libexe_page_hashes_thread_arguments_t ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear thread arguments.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_pages_per_thread = ( page_hashes->number_of_pages + number_of_threads - 1 ) / number_of_threads;
+
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			thread_arguments[ thread_index ].page_hashes      = page_hashes;
+			thread_arguments[ thread_index ].first_page_index = thread_index * number_of_pages_per_thread;
+			thread_arguments[ thread_index ].end_page_index   = thread_arguments[ thread_index ].first_page_index + number_of_pages_per_thread;
+			thread_arguments[ thread_index ].result           = -1;
+
+			if( thread_arguments[ thread_index ].first_page_index > page_hashes->number_of_pages )
+			{
+				thread_arguments[ thread_index ].first_page_index = page_hashes->number_of_pages;
+			}
+			if( thread_arguments[ thread_index ].end_page_index > page_hashes->number_of_pages )
+			{
+				thread_arguments[ thread_index ].end_page_index = page_hashes->number_of_pages;
+			}
+			/* Every thread uses its own file IO handle since the offset is shared
+			 */
+			if( libbfio_handle_clone(
+			     &( thread_arguments[ thread_index ].file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			result = libbfio_handle_is_open(
+			          thread_arguments[ thread_index ].file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to determine if file IO handle: %d is open.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libbfio_handle_open(
+				     thread_arguments[ thread_index ].file_io_handle,
+				     LIBBFIO_OPEN_READ,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open file IO handle: %d.",
+					 function,
+					 thread_index );
+
+					goto on_error;
+				}
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( threads[ thread_index ] ),
+			     NULL,
+			     &libexe_page_hashes_compute_pages_thread_callback,
+			     (void *) &( thread_arguments[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		result = 1;
+
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( thread_arguments[ thread_index ].result != 1 )
+			{
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( thread_arguments[ thread_index ].file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 thread_arguments );
+
+		memory_free(
+		 threads );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compute page hashes.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( libexe_page_hashes_compute_pages(
+	     page_hashes,
+	     file_io_handle,
+	     0,
+	     page_hashes->number_of_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compute page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( threads[ thread_index ] != NULL )
+			{
+				libcthreads_thread_join(
+				 &( threads[ thread_index ] ),
+				 NULL );
+			}
+		}
+	}
+	if( thread_arguments != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( thread_arguments[ thread_index ].file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &( thread_arguments[ thread_index ].file_io_handle ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 thread_arguments );
+	}
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+	return( -1 );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Retrieves the number of pages
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_get_number_of_pages(
+     libexe_page_hashes_t *page_hashes,
+     int *number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_page_hashes_get_number_of_pages";
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pages = page_hashes->number_of_pages;
+
+	return( 1 );
+}
+
+/* Retrieves a specific page
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_page_hashes_get_page_by_index(
+     libexe_page_hashes_t *page_hashes,
+     int page_index,
+     uint32_t *page_offset,
+     uint8_t *sha1_hash,
+     size_t sha1_hash_size,
+     uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_page_hashes_get_page_by_index";
+
+	if( page_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_index < 0 )
+	 || ( page_index >= page_hashes->number_of_pages ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sha1_hash != NULL )
+	 && ( sha1_hash_size < LIBHMAC_SHA1_HASH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid SHA1 hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sha256_hash != NULL )
+	 && ( sha256_hash_size < LIBHMAC_SHA256_HASH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid SHA256 hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*page_offset = page_hashes->page_offsets[ page_index ];
+
+	if( sha1_hash != NULL )
+	{
+		if( memory_copy(
+		     sha1_hash,
+		     &( page_hashes->sha1_hashes[ page_index * LIBHMAC_SHA1_HASH_SIZE ] ),
+		     LIBHMAC_SHA1_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( sha256_hash != NULL )
+	{
+		if( memory_copy(
+		     sha256_hash,
+		     &( page_hashes->sha256_hashes[ page_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+		     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,166 @@
+/*
+ * Page hashes functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_PAGE_HASHES_H )
+#define _LIBEXE_PAGE_HASHES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_page_hashes libexe_page_hashes_t;
+
+struct libexe_page_hashes
+{
+	/* The number of pages
+	 */
+	int number_of_pages;
+
+	/* The page offsets
+	 */
+	uint32_t *page_offsets;
+
+	/* The page sizes
+	 */
+	uint32_t *page_sizes;
+
+	/* The SHA1 hashes
+	 */
+	uint8_t *sha1_hashes;
+
+	/* The SHA256 hashes
+	 */
+	uint8_t *sha256_hashes;
+
+	/* The start offsets of the ranges excluded from the hashes
+	 */
+	off64_t excluded_range_start[ 2 ];
+
+	/* The end offsets of the ranges excluded from the hashes
+	 */
+	off64_t excluded_range_end[ 2 ];
+
+	/* The number of excluded ranges
+	 */
+	int number_of_excluded_ranges;
+};
+
+typedef struct libexe_page_hashes_thread_arguments libexe_page_hashes_thread_arguments_t;
+
+struct libexe_page_hashes_thread_arguments
+{
+	/* The page hashes
+	 */
+	libexe_page_hashes_t *page_hashes;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The index of the first page
+	 */
+	int first_page_index;
+
+	/* The index of the page after the last page
+	 */
+	int end_page_index;
+
+	/* The result
+	 */
+	int result;
+};
+
+int libexe_page_hashes_initialize(
+     libexe_page_hashes_t **page_hashes,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_free(
+     libexe_page_hashes_t **page_hashes,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_compare_section_ranges(
+     const void *first_value,
+     const void *second_value );
+
+int libexe_page_hashes_set_layout(
+     libexe_page_hashes_t *page_hashes,
+     uint32_t headers_size,
+     uint64_t *section_ranges,
+     int number_of_section_ranges,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_set_excluded_range(
+     libexe_page_hashes_t *page_hashes,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_compute_page(
+     libexe_page_hashes_t *page_hashes,
+     libbfio_handle_t *file_io_handle,
+     int page_index,
+     uint8_t *page_data,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_compute_pages(
+     libexe_page_hashes_t *page_hashes,
+     libbfio_handle_t *file_io_handle,
+     int first_page_index,
+     int end_page_index,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_compute_pages_thread_callback(
+     void *arguments );
+
+int libexe_page_hashes_compute(
+     libexe_page_hashes_t *page_hashes,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_get_number_of_pages(
+     libexe_page_hashes_t *page_hashes,
+     int *number_of_pages,
+     libcerror_error_t **error );
+
+int libexe_page_hashes_get_page_by_index(
+     libexe_page_hashes_t *page_hashes,
+     int page_index,
+     uint32_t *page_offset,
+     uint8_t *sha1_hash,
+     size_t sha1_hash_size,
+     uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_PAGE_HASHES_H ) */
+
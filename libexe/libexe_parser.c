@@ -0,0 +1,975 @@
+/*
+ * Incremental parser functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_io_handle.h"
+#include "libexe_libcerror.h"
+#include "libexe_parser.h"
+
+#include "exe_file_header.h"
+#include "exe_section_table.h"
+
+/* The PE/COFF data directory index of each of the data directories
+ */
+static const int libexe_parser_data_directory_indexes[ LIBEXE_NUMBER_OF_DATA_DIRECTORIES ] = {
+	0, 1, 2, 3, 4, 5, 6, 9, 10, 12, 13, 14 };
+
+/* Creates a parser
+ * Make sure the value parser is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_parser_initialize(
+     libexe_parser_t **parser,
+     libcerror_error_t **error )
+{
+	libexe_internal_parser_t *internal_parser = NULL;
+	static char *function                     = "libexe_parser_initialize";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parser != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parser value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = memory_allocate_structure(
+	                   libexe_internal_parser_t );
+
+	if( internal_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parser.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_parser,
+	     0,
+	     sizeof( libexe_internal_parser_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parser.",
+		 function );
+
+		memory_free(
+		 internal_parser );
+
+		return( -1 );
+	}
+	if( libexe_io_handle_initialize(
+	     &( internal_parser->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_parser_set_required_range(
+	     internal_parser,
+	     LIBEXE_PARSER_STATE_MZ_HEADER,
+	     0,
+	     sizeof( exe_mz_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set required range.",
+		 function );
+
+		goto on_error;
+	}
+	*parser = (libexe_parser_t *) internal_parser;
+
+	return( 1 );
+
+on_error:
+	if( internal_parser != NULL )
+	{
+		if( internal_parser->buffer != NULL )
+		{
+			memory_free(
+			 internal_parser->buffer );
+		}
+		if( internal_parser->io_handle != NULL )
+		{
+			libexe_io_handle_free(
+			 &( internal_parser->io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 internal_parser );
+	}
+	return( -1 );
+}
+
+/* Frees a parser
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_parser_free(
+     libexe_parser_t **parser,
+     libcerror_error_t **error )
+{
+	libexe_internal_parser_t *internal_parser = NULL;
+	static char *function                     = "libexe_parser_free";
+	int result                                = 1;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parser != NULL )
+	{
+		internal_parser = (libexe_internal_parser_t *) *parser;
+		*parser         = NULL;
+
+		if( libexe_io_handle_free(
+		     &( internal_parser->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_parser->buffer != NULL )
+		{
+			memory_free(
+			 internal_parser->buffer );
+		}
+		memory_free(
+		 internal_parser );
+	}
+	return( result );
+}
+
+/* Retrieves the range of the data that is required to continue parsing
+ * The offset is relative to the start of the executable and the size
+ * excludes the data of the range that was already fed
+ * Returns 1 if successful, 0 if parsing has finished or -1 on error
+ */
+int libexe_parser_get_required_range(
+     libexe_parser_t *parser,
+     off64_t *offset,
+     size_t *size,
+     libcerror_error_t **error )
+{
+	libexe_internal_parser_t *internal_parser = NULL;
+	static char *function                     = "libexe_parser_get_required_range";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = (libexe_internal_parser_t *) parser;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parser->state == LIBEXE_PARSER_STATE_FINISHED )
+	{
+		return( 0 );
+	}
+	*offset = internal_parser->required_offset + (off64_t) internal_parser->buffer_data_size;
+	*size   = internal_parser->required_size - internal_parser->buffer_data_size;
+
+	return( 1 );
+}
+
+/* Sets the parser state and the range of the data that is required for it
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_parser_set_required_range(
+     libexe_internal_parser_t *internal_parser,
+     int state,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libexe_parser_set_required_range";
+
+	if( internal_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > internal_parser->buffer_allocated_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_parser->buffer,
+		                            sizeof( uint8_t ) * size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_parser->buffer                = reallocation;
+		internal_parser->buffer_allocated_size = size;
+	}
+	internal_parser->state            = state;
+	internal_parser->required_offset  = offset;
+	internal_parser->required_size    = size;
+	internal_parser->buffer_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the file offset of a relative virtual address using the section table data
+ * Returns 1 if successful, 0 if the relative virtual address is not stored in a section or -1 on error
+ */
+int libexe_parser_get_offset_by_relative_virtual_address(
+     libexe_internal_parser_t *internal_parser,
+     const uint8_t *section_table_data,
+     uint32_t relative_virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	exe_section_table_entry_t *section_table_entry = NULL;
+	static char *function                          = "libexe_parser_get_offset_by_relative_virtual_address";
+	uint32_t data_offset                           = 0;
+	uint32_t data_size                             = 0;
+	uint32_t virtual_address                       = 0;
+	uint16_t section_index                         = 0;
+
+	if( internal_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_table_data == NULL )
+	 && ( internal_parser->number_of_sections > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	for( section_index = 0;
+	     section_index < internal_parser->number_of_sections;
+	     section_index++ )
+	{
+		section_table_entry = (exe_section_table_entry_t *) &( section_table_data[ section_index * sizeof( exe_section_table_entry_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 section_table_entry->virtual_address,
+		 virtual_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 section_table_entry->data_size,
+		 data_size );
+
+		if( ( relative_virtual_address >= virtual_address )
+		 && ( ( relative_virtual_address - virtual_address ) < data_size ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 section_table_entry->data_offset,
+			 data_offset );
+
+			*offset = (off64_t) data_offset + ( relative_virtual_address - virtual_address );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Processes the data of the required range and determines the next range
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_parser_process_data(
+     libexe_internal_parser_t *internal_parser,
+     int (*event_callback)(
+            int event_type,
+            int event_index,
+            off64_t file_offset,
+            size64_t size,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	exe_section_table_entry_t *section_table_entry = NULL;
+	const uint8_t *data                            = NULL;
+	static char *function                          = "libexe_parser_process_data";
+	off64_t file_offset                            = 0;
+	size_t byte_index                              = 0;
+	size_t data_size                               = 0;
+	size_t overlap_offset                          = 0;
+	size_t overlap_size                            = 0;
+	size_t range_size                              = 0;
+	uint32_t section_data_offset                   = 0;
+	uint32_t section_data_size                     = 0;
+	uint32_t virtual_address                       = 0;
+	uint16_t section_index                         = 0;
+	int data_directory                             = 0;
+	int next_state                                 = LIBEXE_PARSER_STATE_FINISHED;
+	int result                                     = 1;
+
+	if( internal_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parser->buffer_data_size < internal_parser->required_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parser - buffer data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event callback.",
+		 function );
+
+		return( -1 );
+	}
+	data      = internal_parser->buffer;
+	data_size = internal_parser->required_size;
+
+	switch( internal_parser->state )
+	{
+		case LIBEXE_PARSER_STATE_MZ_HEADER:
+			internal_parser->extended_header_offset = 0;
+
+			if( libexe_io_handle_read_mz_header_data(
+			     internal_parser->io_handle,
+			     data,
+			     data_size,
+			     &( internal_parser->extended_header_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read MZ header.",
+				 function );
+
+				return( -1 );
+			}
+			result = event_callback(
+			          LIBEXE_PARSER_EVENT_TYPE_MZ_HEADER,
+			          0,
+			          0,
+			          (size64_t) data_size,
+			          0,
+			          callback_data );
+
+			if( ( result == 1 )
+			 && ( internal_parser->extended_header_offset != 0 ) )
+			{
+				next_state  = LIBEXE_PARSER_STATE_PE_HEADER;
+				file_offset = (off64_t) internal_parser->extended_header_offset;
+				range_size  = sizeof( exe_pe_header_t ) + sizeof( exe_coff_header_t );
+			}
+			break;
+
+		case LIBEXE_PARSER_STATE_PE_HEADER:
+			/* Executables with a LE or NE extended header are not supported
+			 * by the parser
+			 */
+			if( memory_compare(
+			     ( (exe_pe_header_t *) data )->signature,
+			     exe_pe_signature,
+			     4 ) != 0 )
+			{
+				break;
+			}
+			if( libexe_io_handle_read_coff_header_data(
+			     internal_parser->io_handle,
+			     &( data[ sizeof( exe_pe_header_t ) ] ),
+			     sizeof( exe_coff_header_t ),
+			     &( internal_parser->number_of_sections ),
+			     &( internal_parser->optional_header_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read COFF header.",
+				 function );
+
+				return( -1 );
+			}
+			internal_parser->io_handle->executable_type = LIBEXE_EXECUTABLE_TYPE_PE_COFF;
+
+			if( internal_parser->optional_header_size < sizeof( exe_coff_optional_header_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid optional header size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			file_offset = internal_parser->required_offset + sizeof( exe_pe_header_t );
+
+			result = event_callback(
+			          LIBEXE_PARSER_EVENT_TYPE_COFF_HEADER,
+			          0,
+			          file_offset,
+			          (size64_t) sizeof( exe_coff_header_t ),
+			          0,
+			          callback_data );
+
+			if( result == 1 )
+			{
+				next_state   = LIBEXE_PARSER_STATE_COFF_OPTIONAL_HEADER;
+				file_offset += sizeof( exe_coff_header_t );
+				range_size   = (size_t) internal_parser->optional_header_size;
+			}
+			break;
+
+		case LIBEXE_PARSER_STATE_COFF_OPTIONAL_HEADER:
+			if( libexe_io_handle_read_coff_optional_header_data(
+			     internal_parser->io_handle,
+			     data,
+			     data_size,
+			     internal_parser->required_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read COFF optional header.",
+				 function );
+
+				return( -1 );
+			}
+			result = event_callback(
+			          LIBEXE_PARSER_EVENT_TYPE_COFF_OPTIONAL_HEADER,
+			          0,
+			          internal_parser->required_offset,
+			          (size64_t) data_size,
+			          0,
+			          callback_data );
+
+			if( result == 1 )
+			{
+				next_state  = LIBEXE_PARSER_STATE_SECTION_TABLE;
+				file_offset = internal_parser->required_offset + (off64_t) data_size;
+				range_size  = sizeof( exe_section_table_entry_t ) * internal_parser->number_of_sections;
+			}
+			break;
+
+		case LIBEXE_PARSER_STATE_SECTION_TABLE:
+			for( section_index = 0;
+			     section_index < internal_parser->number_of_sections;
+			     section_index++ )
+			{
+				section_table_entry = (exe_section_table_entry_t *) &( data[ section_index * sizeof( exe_section_table_entry_t ) ] );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 section_table_entry->virtual_address,
+				 virtual_address );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 section_table_entry->data_size,
+				 section_data_size );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 section_table_entry->data_offset,
+				 section_data_offset );
+
+				result = event_callback(
+				          LIBEXE_PARSER_EVENT_TYPE_SECTION,
+				          (int) section_index,
+				          (off64_t) section_data_offset,
+				          (size64_t) section_data_size,
+				          virtual_address,
+				          callback_data );
+
+				if( result != 1 )
+				{
+					break;
+				}
+			}
+			for( data_directory = 0;
+			     ( result == 1 ) && ( data_directory < LIBEXE_NUMBER_OF_DATA_DIRECTORIES );
+			     data_directory++ )
+			{
+				virtual_address = internal_parser->io_handle->data_directories[ data_directory ].virtual_address;
+
+				if( ( virtual_address == 0 )
+				 || ( internal_parser->io_handle->data_directories[ data_directory ].size == 0 ) )
+				{
+					continue;
+				}
+				/* The certificate table contains a file offset instead of a relative virtual address
+				 */
+				if( data_directory == LIBEXE_DATA_DIRECTORY_CERTIFICATE_TABLE )
+				{
+					file_offset     = (off64_t) virtual_address;
+					virtual_address = 0;
+				}
+				else
+				{
+					result = libexe_parser_get_offset_by_relative_virtual_address(
+					          internal_parser,
+					          data,
+					          virtual_address,
+					          &file_offset,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve offset of data directory: %d.",
+						 function,
+						 data_directory );
+
+						return( -1 );
+					}
+					else if( result == 0 )
+					{
+						file_offset = -1;
+					}
+				}
+				result = event_callback(
+				          LIBEXE_PARSER_EVENT_TYPE_DATA_DIRECTORY,
+				          libexe_parser_data_directory_indexes[ data_directory ],
+				          file_offset,
+				          (size64_t) internal_parser->io_handle->data_directories[ data_directory ].size,
+				          virtual_address,
+				          callback_data );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported parser state: %d.",
+			 function,
+			 internal_parser->state );
+
+			return( -1 );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: event callback failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_state == LIBEXE_PARSER_STATE_FINISHED )
+	{
+		internal_parser->state = LIBEXE_PARSER_STATE_FINISHED;
+
+		return( 1 );
+	}
+	/* The next range can overlap with the data that was already fed,
+	 * e.g. if the extended header is stored inside the MZ header
+	 * The buffer contains the data from the start of the current range
+	 * up to the current offset
+	 */
+	if( file_offset < internal_parser->current_offset )
+	{
+		if( file_offset < internal_parser->required_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next range offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		overlap_offset = (size_t) ( file_offset - internal_parser->required_offset );
+		overlap_size   = internal_parser->buffer_data_size - overlap_offset;
+
+		/* The source and destination can overlap, hence the data is copied
+		 * front to back instead of using memory_copy
+		 */
+		for( byte_index = 0;
+		     byte_index < overlap_size;
+		     byte_index++ )
+		{
+			internal_parser->buffer[ byte_index ] = internal_parser->buffer[ overlap_offset + byte_index ];
+		}
+	}
+	if( libexe_parser_set_required_range(
+	     internal_parser,
+	     next_state,
+	     file_offset,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set required range.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser->buffer_data_size = overlap_size;
+
+	return( 1 );
+}
+
+/* Feeds the next data of the executable to the parser
+ * The data is the continuation of the data fed before, starting at offset 0.
+ * Data before the required range is skipped and the event callback is called
+ * for every header, section and data directory as soon as it can be decoded.
+ * The event callback should return 1 to continue, 0 to stop parsing or -1 on error
+ * Returns 1 if more data is required, 0 if parsing has finished or -1 on error
+ */
+int libexe_parser_feed(
+     libexe_parser_t *parser,
+     const uint8_t *data,
+     size_t data_size,
+     int (*event_callback)(
+            int event_type,
+            int event_index,
+            off64_t file_offset,
+            size64_t size,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_internal_parser_t *internal_parser = NULL;
+	static char *function                     = "libexe_parser_feed";
+	size_t data_offset                        = 0;
+	size_t read_size                          = 0;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = (libexe_internal_parser_t *) parser;
+
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event callback.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_parser->state != LIBEXE_PARSER_STATE_FINISHED )
+	{
+		if( internal_parser->current_offset < internal_parser->required_offset )
+		{
+			read_size = data_size - data_offset;
+
+			if( (off64_t) read_size > ( internal_parser->required_offset - internal_parser->current_offset ) )
+			{
+				read_size = (size_t) ( internal_parser->required_offset - internal_parser->current_offset );
+			}
+			data_offset                     += read_size;
+			internal_parser->current_offset += read_size;
+
+			if( internal_parser->current_offset < internal_parser->required_offset )
+			{
+				break;
+			}
+		}
+		if( internal_parser->buffer_data_size < internal_parser->required_size )
+		{
+			read_size = internal_parser->required_size - internal_parser->buffer_data_size;
+
+			if( read_size > ( data_size - data_offset ) )
+			{
+				read_size = data_size - data_offset;
+			}
+			if( read_size == 0 )
+			{
+				break;
+			}
+			if( memory_copy(
+			     &( internal_parser->buffer[ internal_parser->buffer_data_size ] ),
+			     &( data[ data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset                       += read_size;
+			internal_parser->buffer_data_size += read_size;
+			internal_parser->current_offset   += read_size;
+
+			if( internal_parser->buffer_data_size < internal_parser->required_size )
+			{
+				break;
+			}
+		}
+		if( libexe_parser_process_data(
+		     internal_parser,
+		     event_callback,
+		     callback_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process data.",
+			 function );
+
+			internal_parser->state = LIBEXE_PARSER_STATE_FINISHED;
+
+			return( -1 );
+		}
+	}
+	if( internal_parser->state == LIBEXE_PARSER_STATE_FINISHED )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the target architecture type
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_parser_get_target_architecture_type(
+     libexe_parser_t *parser,
+     uint16_t *target_architecture_type,
+     libcerror_error_t **error )
+{
+	libexe_internal_parser_t *internal_parser = NULL;
+	static char *function                     = "libexe_parser_get_target_architecture_type";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = (libexe_internal_parser_t *) parser;
+
+	if( target_architecture_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target architecture type.",
+		 function );
+
+		return( -1 );
+	}
+	*target_architecture_type = internal_parser->io_handle->target_architecture_type;
+
+	return( 1 );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Incremental parser functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_PARSER_H )
+#define _LIBEXE_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_extern.h"
+#include "libexe_io_handle.h"
+#include "libexe_libcerror.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_internal_parser libexe_internal_parser_t;
+
+struct libexe_internal_parser
+{
+	/* The IO handle that contains the decoded header values
+	 */
+	libexe_io_handle_t *io_handle;
+
+	/* The parser state
+	 */
+	int state;
+
+	/* The offset of the next byte of the stream that is fed
+	 */
+	off64_t current_offset;
+
+	/* The offset of the data that is required to continue parsing
+	 */
+	off64_t required_offset;
+
+	/* The size of the data that is required to continue parsing
+	 */
+	size_t required_size;
+
+	/* The buffer that contains the data of the required range fed so far
+	 */
+	uint8_t *buffer;
+
+	/* The allocated size of the buffer
+	 */
+	size_t buffer_allocated_size;
+
+	/* The size of the data in the buffer
+	 */
+	size_t buffer_data_size;
+
+	/* The extended header offset
+	 */
+	uint32_t extended_header_offset;
+
+	/* The number of sections
+	 */
+	uint16_t number_of_sections;
+
+	/* The optional header size
+	 */
+	uint16_t optional_header_size;
+};
+
+LIBEXE_EXTERN \
+int libexe_parser_initialize(
+     libexe_parser_t **parser,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_parser_free(
+     libexe_parser_t **parser,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_parser_get_required_range(
+     libexe_parser_t *parser,
+     off64_t *offset,
+     size_t *size,
+     libcerror_error_t **error );
+
+int libexe_parser_set_required_range(
+     libexe_internal_parser_t *internal_parser,
+     int state,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libexe_parser_get_offset_by_relative_virtual_address(
+     libexe_internal_parser_t *internal_parser,
+     const uint8_t *section_table_data,
+     uint32_t relative_virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+int libexe_parser_process_data(
+     libexe_internal_parser_t *internal_parser,
+     int (*event_callback)(
+            int event_type,
+            int event_index,
+            off64_t file_offset,
+            size64_t size,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_parser_feed(
+     libexe_parser_t *parser,
+     const uint8_t *data,
+     size_t data_size,
+     int (*event_callback)(
+            int event_type,
+            int event_index,
+            off64_t file_offset,
+            size64_t size,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_parser_get_target_architecture_type(
+     libexe_parser_t *parser,
+     uint16_t *target_architecture_type,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_PARSER_H ) */
+
@@ -0,0 +1,305 @@
+/*
+ * Pattern functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+#include "libexe_pattern.h"
+
+/* Creates a pattern
+ * Make sure the value pattern is referencing, is set to NULL
+ * If mask is NULL all bits of the pattern are significant
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_pattern_initialize(
+     libexe_pattern_t **pattern,
+     const uint8_t *data,
+     const uint8_t *mask,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_pattern_initialize";
+	size_t data_offset    = 0;
+	size_t run_offset     = 0;
+	size_t run_size       = 0;
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pattern != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pattern value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > LIBEXE_PATTERN_MAXIMUM_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*pattern = memory_allocate_structure(
+	            libexe_pattern_t );
+
+	if( *pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *pattern,
+	     0,
+	     sizeof( libexe_pattern_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pattern.",
+		 function );
+
+		memory_free(
+		 *pattern );
+
+		*pattern = NULL;
+
+		return( -1 );
+	}
+	( *pattern )->data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * size );
+
+	if( ( *pattern )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *pattern )->mask = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * size );
+
+	if( ( *pattern )->mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mask.",
+		 function );
+
+		goto on_error;
+	}
+	if( mask == NULL )
+	{
+		if( memory_set(
+		     ( *pattern )->mask,
+		     0xff,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set mask.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( memory_copy(
+	          ( *pattern )->mask,
+	          mask,
+	          size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy mask.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data is stored masked so that matching only needs to mask the buffer
+	 * and the anchor is the longest run of bytes without wildcard bits
+	 */
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset++ )
+	{
+		( *pattern )->data[ data_offset ] = data[ data_offset ] & ( *pattern )->mask[ data_offset ];
+
+		if( ( *pattern )->mask[ data_offset ] != 0xff )
+		{
+			run_size = 0;
+
+			continue;
+		}
+		if( run_size == 0 )
+		{
+			run_offset = data_offset;
+		}
+		run_size++;
+
+		if( run_size > ( *pattern )->anchor_size )
+		{
+			( *pattern )->anchor_offset = run_offset;
+			( *pattern )->anchor_size   = run_size;
+		}
+	}
+	if( ( *pattern )->anchor_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern without a byte that is not a wildcard.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( *pattern )->anchor_size > LIBEXE_PATTERN_MAXIMUM_ANCHOR_SIZE )
+	{
+		( *pattern )->anchor_size = LIBEXE_PATTERN_MAXIMUM_ANCHOR_SIZE;
+	}
+	( *pattern )->size = size;
+
+	return( 1 );
+
+on_error:
+	if( *pattern != NULL )
+	{
+		libexe_pattern_free(
+		 pattern,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_pattern_free(
+     libexe_pattern_t **pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_pattern_free";
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pattern != NULL )
+	{
+		if( ( *pattern )->mask != NULL )
+		{
+			memory_free(
+			 ( *pattern )->mask );
+		}
+		if( ( *pattern )->data != NULL )
+		{
+			memory_free(
+			 ( *pattern )->data );
+		}
+		memory_free(
+		 *pattern );
+
+		*pattern = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if the pattern matches the start of a buffer
+ * Returns 1 if the pattern matches or 0 if not
+ */
+int libexe_pattern_matches(
+     libexe_pattern_t *pattern,
+     const uint8_t *buffer,
+     size_t buffer_size )
+{
+	size_t data_offset = 0;
+
+	if( buffer_size < pattern->size )
+	{
+		return( 0 );
+	}
+	for( data_offset = 0;
+	     data_offset < pattern->size;
+	     data_offset++ )
+	{
+		if( ( buffer[ data_offset ] & pattern->mask[ data_offset ] ) != pattern->data[ data_offset ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,80 @@
+/*
+ * Pattern functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_PATTERN_H )
+#define _LIBEXE_PATTERN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_pattern libexe_pattern_t;
+
+struct libexe_pattern
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The mask, a data byte matches if its masked value equals the masked pattern byte
+	 */
+	uint8_t *mask;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The offset of the anchor, the part of the pattern without wildcard bits
+	 */
+	size_t anchor_offset;
+
+	/* The size of the anchor
+	 */
+	size_t anchor_size;
+};
+
+int libexe_pattern_initialize(
+     libexe_pattern_t **pattern,
+     const uint8_t *data,
+     const uint8_t *mask,
+     size_t size,
+     libcerror_error_t **error );
+
+int libexe_pattern_free(
+     libexe_pattern_t **pattern,
+     libcerror_error_t **error );
+
+int libexe_pattern_matches(
+     libexe_pattern_t *pattern,
+     const uint8_t *buffer,
+     size_t buffer_size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_PATTERN_H ) */
+
@@ -0,0 +1,968 @@
+/*
+ * Pattern set functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_pattern.h"
+#include "libexe_pattern_set.h"
+
+/* Creates a pattern set
+ * Make sure the value pattern_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_pattern_set_initialize(
+     libexe_pattern_set_t **pattern_set,
+     libcerror_error_t **error )
+{
+	libexe_internal_pattern_set_t *internal_pattern_set = NULL;
+	static char *function                               = "libexe_pattern_set_initialize";
+
+	if( pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pattern_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pattern set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pattern_set = memory_allocate_structure(
+	                        libexe_internal_pattern_set_t );
+
+	if( internal_pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pattern set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_pattern_set,
+	     0,
+	     sizeof( libexe_internal_pattern_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pattern set.",
+		 function );
+
+		memory_free(
+		 internal_pattern_set );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_pattern_set->patterns_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create patterns array.",
+		 function );
+
+		goto on_error;
+	}
+	*pattern_set = (libexe_pattern_set_t *) internal_pattern_set;
+
+	return( 1 );
+
+on_error:
+	if( internal_pattern_set != NULL )
+	{
+		memory_free(
+		 internal_pattern_set );
+	}
+	return( -1 );
+}
+
+/* Frees a pattern set
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_pattern_set_free(
+     libexe_pattern_set_t **pattern_set,
+     libcerror_error_t **error )
+{
+	libexe_internal_pattern_set_t *internal_pattern_set = NULL;
+	static char *function                               = "libexe_pattern_set_free";
+	int result                                          = 1;
+
+	if( pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pattern_set != NULL )
+	{
+		internal_pattern_set = (libexe_internal_pattern_set_t *) *pattern_set;
+		*pattern_set         = NULL;
+
+		if( libexe_pattern_set_free_automaton(
+		     internal_pattern_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free automaton.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_pattern_set->patterns_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_pattern_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free patterns array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_pattern_set );
+	}
+	return( result );
+}
+
+/* Frees the automaton of a pattern set
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_pattern_set_free_automaton(
+     libexe_internal_pattern_set_t *internal_pattern_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_pattern_set_free_automaton";
+
+	if( internal_pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pattern_set->next_output_patterns != NULL )
+	{
+		memory_free(
+		 internal_pattern_set->next_output_patterns );
+
+		internal_pattern_set->next_output_patterns = NULL;
+	}
+	if( internal_pattern_set->output_states != NULL )
+	{
+		memory_free(
+		 internal_pattern_set->output_states );
+
+		internal_pattern_set->output_states = NULL;
+	}
+	if( internal_pattern_set->output_patterns != NULL )
+	{
+		memory_free(
+		 internal_pattern_set->output_patterns );
+
+		internal_pattern_set->output_patterns = NULL;
+	}
+	if( internal_pattern_set->failure_states != NULL )
+	{
+		memory_free(
+		 internal_pattern_set->failure_states );
+
+		internal_pattern_set->failure_states = NULL;
+	}
+	if( internal_pattern_set->transition_targets != NULL )
+	{
+		memory_free(
+		 internal_pattern_set->transition_targets );
+
+		internal_pattern_set->transition_targets = NULL;
+	}
+	if( internal_pattern_set->transition_bytes != NULL )
+	{
+		memory_free(
+		 internal_pattern_set->transition_bytes );
+
+		internal_pattern_set->transition_bytes = NULL;
+	}
+	if( internal_pattern_set->transitions_index != NULL )
+	{
+		memory_free(
+		 internal_pattern_set->transitions_index );
+
+		internal_pattern_set->transitions_index = NULL;
+	}
+	internal_pattern_set->number_of_states = 0;
+	internal_pattern_set->is_compiled      = 0;
+
+	return( 1 );
+}
+
+/* Appends a pattern
+ * The mask contains a value for every pattern byte, a data byte matches the pattern byte
+ * if the bits set in the mask are equal, use 0x00 for a wildcard byte
+ * If mask is NULL all bits of the pattern are significant
+ * Every pattern needs at least one byte with a mask of 0xff
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_pattern_set_append_pattern(
+     libexe_pattern_set_t *pattern_set,
+     const uint8_t *pattern,
+     const uint8_t *mask,
+     size_t pattern_size,
+     int *pattern_index,
+     libcerror_error_t **error )
+{
+	libexe_internal_pattern_set_t *internal_pattern_set = NULL;
+	libexe_pattern_t *internal_pattern                  = NULL;
+	static char *function                               = "libexe_pattern_set_append_pattern";
+	int number_of_patterns                              = 0;
+
+	if( pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pattern_set = (libexe_internal_pattern_set_t *) pattern_set;
+
+	if( internal_pattern_set->is_compiled != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pattern set - already compiled.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_pattern_set->patterns_array,
+	     &number_of_patterns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of patterns.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_patterns >= LIBEXE_MAXIMUM_NUMBER_OF_PATTERNS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of patterns value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_pattern_initialize(
+	     &internal_pattern,
+	     pattern,
+	     mask,
+	     pattern_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_pattern_set->patterns_array,
+	     pattern_index,
+	     (intptr_t *) internal_pattern,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append pattern to array.",
+		 function );
+
+		goto on_error;
+	}
+	if( pattern_size > internal_pattern_set->maximum_pattern_size )
+	{
+		internal_pattern_set->maximum_pattern_size = pattern_size;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_pattern != NULL )
+	{
+		libexe_pattern_free(
+		 &internal_pattern,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compiles the pattern set into an Aho-Corasick automaton of the pattern anchors
+ * Once compiled the pattern set is not changed by scanning and can be shared by multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_pattern_set_compile(
+     libexe_pattern_set_t *pattern_set,
+     libcerror_error_t **error )
+{
+	libexe_internal_pattern_set_t *internal_pattern_set = NULL;
+	libexe_pattern_t *internal_pattern                  = NULL;
+	uint8_t *state_bytes                                = NULL;
+	int *first_child_states                             = NULL;
+	int *next_sibling_states                            = NULL;
+	int *states_queue                                   = NULL;
+	static char *function                               = "libexe_pattern_set_compile";
+	size_t anchor_offset                                = 0;
+	uint8_t byte_value                                  = 0;
+	int child_state                                     = 0;
+	int failure_state                                   = 0;
+	int maximum_number_of_states                        = 0;
+	int number_of_patterns                              = 0;
+	int pattern_index                                   = 0;
+	int queue_end                                       = 0;
+	int queue_start                                     = 0;
+	int sort_index                                      = 0;
+	int state                                           = 0;
+	int target_state                                    = 0;
+	int transition_index                                = 0;
+
+	if( pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pattern_set = (libexe_internal_pattern_set_t *) pattern_set;
+
+	if( internal_pattern_set->is_compiled != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pattern set - already compiled.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_pattern_set->patterns_array,
+	     &number_of_patterns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of patterns.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every anchor byte adds at most 1 state to the root state
+	 */
+	maximum_number_of_states = 1 + ( number_of_patterns * LIBEXE_PATTERN_MAXIMUM_ANCHOR_SIZE );
+
+	internal_pattern_set->transitions_index = (int *) memory_allocate(
+	                                                   sizeof( int ) * ( maximum_number_of_states + 1 ) );
+
+	internal_pattern_set->transition_bytes = (uint8_t *) memory_allocate(
+	                                                      sizeof( uint8_t ) * maximum_number_of_states );
+
+	internal_pattern_set->transition_targets = (int *) memory_allocate(
+	                                                    sizeof( int ) * maximum_number_of_states );
+
+	internal_pattern_set->failure_states = (int *) memory_allocate(
+	                                                sizeof( int ) * maximum_number_of_states );
+
+	internal_pattern_set->output_patterns = (int *) memory_allocate(
+	                                                 sizeof( int ) * maximum_number_of_states );
+
+	internal_pattern_set->output_states = (int *) memory_allocate(
+	                                               sizeof( int ) * maximum_number_of_states );
+
+	internal_pattern_set->next_output_patterns = (int *) memory_allocate(
+	                                                      sizeof( int ) * ( number_of_patterns + 1 ) );
+
+	state_bytes = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * maximum_number_of_states );
+
+	first_child_states = (int *) memory_allocate(
+	                              sizeof( int ) * maximum_number_of_states );
+
+	next_sibling_states = (int *) memory_allocate(
+	                               sizeof( int ) * maximum_number_of_states );
+
+	states_queue = (int *) memory_allocate(
+	                        sizeof( int ) * maximum_number_of_states );
+
+	if( ( internal_pattern_set->transitions_index == NULL )
+	 || ( internal_pattern_set->transition_bytes == NULL )
+	 || ( internal_pattern_set->transition_targets == NULL )
+	 || ( internal_pattern_set->failure_states == NULL )
+	 || ( internal_pattern_set->output_patterns == NULL )
+	 || ( internal_pattern_set->output_states == NULL )
+	 || ( internal_pattern_set->next_output_patterns == NULL )
+	 || ( state_bytes == NULL )
+	 || ( first_child_states == NULL )
+	 || ( next_sibling_states == NULL )
+	 || ( states_queue == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create automaton.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_pattern_set->root_transitions,
+	     0,
+	     sizeof( int ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear root transitions.",
+		 function );
+
+		goto on_error;
+	}
+	first_child_states[ 0 ]                       = 0;
+	internal_pattern_set->failure_states[ 0 ]     = 0;
+	internal_pattern_set->output_patterns[ 0 ]    = -1;
+	internal_pattern_set->output_states[ 0 ]      = 0;
+	internal_pattern_set->number_of_states        = 1;
+
+	/* Build the trie of the pattern anchors
+	 */
+	for( pattern_index = 0;
+	     pattern_index < number_of_patterns;
+	     pattern_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_pattern_set->patterns_array,
+		     pattern_index,
+		     (intptr_t **) &internal_pattern,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pattern: %d.",
+			 function,
+			 pattern_index );
+
+			goto on_error;
+		}
+		state = 0;
+
+		for( anchor_offset = 0;
+		     anchor_offset < internal_pattern->anchor_size;
+		     anchor_offset++ )
+		{
+			byte_value = internal_pattern->data[ internal_pattern->anchor_offset + anchor_offset ];
+
+			if( state == 0 )
+			{
+				target_state = internal_pattern_set->root_transitions[ byte_value ];
+			}
+			else
+			{
+				for( target_state = first_child_states[ state ];
+				     target_state != 0;
+				     target_state = next_sibling_states[ target_state ] )
+				{
+					if( state_bytes[ target_state ] == byte_value )
+					{
+						break;
+					}
+				}
+			}
+			if( target_state == 0 )
+			{
+				target_state = internal_pattern_set->number_of_states++;
+
+				state_bytes[ target_state ]                           = byte_value;
+				first_child_states[ target_state ]                    = 0;
+				next_sibling_states[ target_state ]                   = first_child_states[ state ];
+				first_child_states[ state ]                           = target_state;
+				internal_pattern_set->output_patterns[ target_state ] = -1;
+
+				if( state == 0 )
+				{
+					internal_pattern_set->root_transitions[ byte_value ] = target_state;
+				}
+			}
+			state = target_state;
+		}
+		internal_pattern_set->next_output_patterns[ pattern_index ] = internal_pattern_set->output_patterns[ state ];
+		internal_pattern_set->output_patterns[ state ]              = pattern_index;
+	}
+	/* Determine the failure and output states in breadth first order
+	 */
+	for( child_state = first_child_states[ 0 ];
+	     child_state != 0;
+	     child_state = next_sibling_states[ child_state ] )
+	{
+		internal_pattern_set->failure_states[ child_state ] = 0;
+		internal_pattern_set->output_states[ child_state ]  = 0;
+
+		states_queue[ queue_end++ ] = child_state;
+	}
+	while( queue_start < queue_end )
+	{
+		state = states_queue[ queue_start++ ];
+
+		for( child_state = first_child_states[ state ];
+		     child_state != 0;
+		     child_state = next_sibling_states[ child_state ] )
+		{
+			byte_value    = state_bytes[ child_state ];
+			failure_state = internal_pattern_set->failure_states[ state ];
+
+			do
+			{
+				if( failure_state == 0 )
+				{
+					target_state = internal_pattern_set->root_transitions[ byte_value ];
+				}
+				else
+				{
+					for( target_state = first_child_states[ failure_state ];
+					     target_state != 0;
+					     target_state = next_sibling_states[ target_state ] )
+					{
+						if( state_bytes[ target_state ] == byte_value )
+						{
+							break;
+						}
+					}
+				}
+				if( target_state != 0 )
+				{
+					break;
+				}
+				failure_state = internal_pattern_set->failure_states[ failure_state ];
+			}
+			while( failure_state != 0 );
+
+			/* The last failure state tried is the root state
+			 */
+			if( ( target_state == 0 )
+			 && ( failure_state == 0 ) )
+			{
+				target_state = internal_pattern_set->root_transitions[ byte_value ];
+			}
+			internal_pattern_set->failure_states[ child_state ] = target_state;
+
+			if( internal_pattern_set->output_patterns[ target_state ] != -1 )
+			{
+				internal_pattern_set->output_states[ child_state ] = target_state;
+			}
+			else
+			{
+				internal_pattern_set->output_states[ child_state ] = internal_pattern_set->output_states[ target_state ];
+			}
+			states_queue[ queue_end++ ] = child_state;
+		}
+	}
+	/* Store the transitions of the states other than the root state sorted by byte value
+	 */
+	for( state = 0;
+	     state < internal_pattern_set->number_of_states;
+	     state++ )
+	{
+		internal_pattern_set->transitions_index[ state ] = transition_index;
+
+		if( state == 0 )
+		{
+			continue;
+		}
+		for( child_state = first_child_states[ state ];
+		     child_state != 0;
+		     child_state = next_sibling_states[ child_state ] )
+		{
+			byte_value = state_bytes[ child_state ];
+
+			for( sort_index = transition_index;
+			     sort_index > internal_pattern_set->transitions_index[ state ];
+			     sort_index-- )
+			{
+				if( internal_pattern_set->transition_bytes[ sort_index - 1 ] < byte_value )
+				{
+					break;
+				}
+				internal_pattern_set->transition_bytes[ sort_index ]   = internal_pattern_set->transition_bytes[ sort_index - 1 ];
+				internal_pattern_set->transition_targets[ sort_index ] = internal_pattern_set->transition_targets[ sort_index - 1 ];
+			}
+			internal_pattern_set->transition_bytes[ sort_index ]   = byte_value;
+			internal_pattern_set->transition_targets[ sort_index ] = child_state;
+
+			transition_index++;
+		}
+	}
+	internal_pattern_set->transitions_index[ internal_pattern_set->number_of_states ] = transition_index;
+
+	memory_free(
+	 states_queue );
+	memory_free(
+	 next_sibling_states );
+	memory_free(
+	 first_child_states );
+	memory_free(
+	 state_bytes );
+
+	internal_pattern_set->is_compiled = 1;
+
+	return( 1 );
+
+on_error:
+	if( states_queue != NULL )
+	{
+		memory_free(
+		 states_queue );
+	}
+	if( next_sibling_states != NULL )
+	{
+		memory_free(
+		 next_sibling_states );
+	}
+	if( first_child_states != NULL )
+	{
+		memory_free(
+		 first_child_states );
+	}
+	if( state_bytes != NULL )
+	{
+		memory_free(
+		 state_bytes );
+	}
+	libexe_pattern_set_free_automaton(
+	 internal_pattern_set,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Initializes a match state
+ * Matches that end before the minimum end offset are not returned
+ */
+void libexe_pattern_set_initialize_match_state(
+      libexe_pattern_match_state_t *match_state,
+      size_t minimum_end_offset )
+{
+	if( match_state != NULL )
+	{
+		match_state->buffer_offset      = 0;
+		match_state->minimum_end_offset = minimum_end_offset;
+		match_state->state              = 0;
+		match_state->output_state       = 0;
+		match_state->pattern_index      = -1;
+	}
+}
+
+/* Retrieves the next match in a buffer
+ * Matches are returned in order of the end of their anchors, patterns that do not
+ * fit entirely in the buffer are not returned
+ * Returns 1 if successful, 0 if no more matches or -1 on error
+ */
+int libexe_pattern_set_get_next_match(
+     libexe_internal_pattern_set_t *internal_pattern_set,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libexe_pattern_match_state_t *match_state,
+     int *pattern_index,
+     size_t *match_offset,
+     libcerror_error_t **error )
+{
+	libexe_pattern_t *internal_pattern = NULL;
+	static char *function              = "libexe_pattern_set_get_next_match";
+	size_t anchor_end_offset           = 0;
+	size_t pattern_offset              = 0;
+	uint8_t byte_value                 = 0;
+	int lower_index                    = 0;
+	int middle_index                   = 0;
+	int next_state                     = 0;
+	int state                          = 0;
+	int upper_index                    = 0;
+
+	if( internal_pattern_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pattern_set->is_compiled == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pattern set - not compiled.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match state.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern index.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match offset.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		/* Verify the patterns of which the anchor ends at the current offset
+		 */
+		while( match_state->pattern_index != -1 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_pattern_set->patterns_array,
+			     match_state->pattern_index,
+			     (intptr_t **) &internal_pattern,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve pattern: %d.",
+				 function,
+				 match_state->pattern_index );
+
+				return( -1 );
+			}
+			*pattern_index = match_state->pattern_index;
+
+			match_state->pattern_index = internal_pattern_set->next_output_patterns[ match_state->pattern_index ];
+
+			if( match_state->pattern_index == -1 )
+			{
+				match_state->output_state = internal_pattern_set->output_states[ match_state->output_state ];
+
+				if( match_state->output_state != 0 )
+				{
+					match_state->pattern_index = internal_pattern_set->output_patterns[ match_state->output_state ];
+				}
+			}
+			anchor_end_offset = internal_pattern->anchor_offset + internal_pattern->anchor_size;
+
+			if( match_state->buffer_offset < anchor_end_offset )
+			{
+				continue;
+			}
+			pattern_offset = match_state->buffer_offset - anchor_end_offset;
+
+			if( ( pattern_offset + internal_pattern->size ) <= match_state->minimum_end_offset )
+			{
+				continue;
+			}
+			if( libexe_pattern_matches(
+			     internal_pattern,
+			     &( buffer[ pattern_offset ] ),
+			     buffer_size - pattern_offset ) != 0 )
+			{
+				*match_offset = pattern_offset;
+
+				return( 1 );
+			}
+		}
+		if( match_state->buffer_offset >= buffer_size )
+		{
+			break;
+		}
+		byte_value = buffer[ match_state->buffer_offset++ ];
+		state      = match_state->state;
+
+		while( 1 )
+		{
+			if( state == 0 )
+			{
+				next_state = internal_pattern_set->root_transitions[ byte_value ];
+
+				break;
+			}
+			lower_index = internal_pattern_set->transitions_index[ state ];
+			upper_index = internal_pattern_set->transitions_index[ state + 1 ];
+			next_state  = 0;
+
+			while( lower_index < upper_index )
+			{
+				middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+				if( internal_pattern_set->transition_bytes[ middle_index ] == byte_value )
+				{
+					next_state = internal_pattern_set->transition_targets[ middle_index ];
+
+					break;
+				}
+				else if( internal_pattern_set->transition_bytes[ middle_index ] < byte_value )
+				{
+					lower_index = middle_index + 1;
+				}
+				else
+				{
+					upper_index = middle_index;
+				}
+			}
+			if( next_state != 0 )
+			{
+				break;
+			}
+			state = internal_pattern_set->failure_states[ state ];
+		}
+		match_state->state = next_state;
+
+		if( internal_pattern_set->output_patterns[ next_state ] != -1 )
+		{
+			match_state->output_state = next_state;
+		}
+		else
+		{
+			match_state->output_state = internal_pattern_set->output_states[ next_state ];
+		}
+		if( match_state->output_state != 0 )
+		{
+			match_state->pattern_index = internal_pattern_set->output_patterns[ match_state->output_state ];
+		}
+	}
+	return( 0 );
+}
+
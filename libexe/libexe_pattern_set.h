@@ -0,0 +1,163 @@
+/*
+ * Pattern set functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_PATTERN_SET_H )
+#define _LIBEXE_PATTERN_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_extern.h"
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_internal_pattern_set libexe_internal_pattern_set_t;
+
+struct libexe_internal_pattern_set
+{
+	/* The patterns array
+	 */
+	libcdata_array_t *patterns_array;
+
+	/* The maximum pattern size
+	 */
+	size_t maximum_pattern_size;
+
+	/* The number of automaton states, state 0 is the root state
+	 */
+	int number_of_states;
+
+	/* The transitions of the root state
+	 */
+	int root_transitions[ 256 ];
+
+	/* The index of the first transition of each state, the transitions of a state
+	 * are sorted by byte value
+	 */
+	int *transitions_index;
+
+	/* The byte values of the transitions
+	 */
+	uint8_t *transition_bytes;
+
+	/* The target states of the transitions
+	 */
+	int *transition_targets;
+
+	/* The failure state of each state
+	 */
+	int *failure_states;
+
+	/* The index of the first pattern of which the anchor ends in each state or -1 if none
+	 */
+	int *output_patterns;
+
+	/* The nearest state on the failure path of each state that has an output pattern or 0 if none
+	 */
+	int *output_states;
+
+	/* The index of the next pattern with the same anchor or -1 if none
+	 */
+	int *next_output_patterns;
+
+	/* Value to indicate the pattern set was compiled
+	 */
+	uint8_t is_compiled;
+};
+
+typedef struct libexe_pattern_match_state libexe_pattern_match_state_t;
+
+struct libexe_pattern_match_state
+{
+	/* The offset of the next byte in the buffer
+	 */
+	size_t buffer_offset;
+
+	/* The minimum offset of the end of a match, matches that end before
+	 * this offset are not returned
+	 */
+	size_t minimum_end_offset;
+
+	/* The current automaton state
+	 */
+	int state;
+
+	/* The current output state
+	 */
+	int output_state;
+
+	/* The index of the next pattern to check or -1 if none
+	 */
+	int pattern_index;
+};
+
+LIBEXE_EXTERN \
+int libexe_pattern_set_initialize(
+     libexe_pattern_set_t **pattern_set,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_pattern_set_free(
+     libexe_pattern_set_t **pattern_set,
+     libcerror_error_t **error );
+
+int libexe_pattern_set_free_automaton(
+     libexe_internal_pattern_set_t *internal_pattern_set,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_pattern_set_append_pattern(
+     libexe_pattern_set_t *pattern_set,
+     const uint8_t *pattern,
+     const uint8_t *mask,
+     size_t pattern_size,
+     int *pattern_index,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_pattern_set_compile(
+     libexe_pattern_set_t *pattern_set,
+     libcerror_error_t **error );
+
+void libexe_pattern_set_initialize_match_state(
+      libexe_pattern_match_state_t *match_state,
+      size_t minimum_end_offset );
+
+int libexe_pattern_set_get_next_match(
+     libexe_internal_pattern_set_t *internal_pattern_set,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libexe_pattern_match_state_t *match_state,
+     int *pattern_index,
+     size_t *match_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_PATTERN_SET_H ) */
+
@@ -0,0 +1,1281 @@
+/*
+ * The range IO handle functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_read_plan_io_handle.h"
+
+/* Creates a read plan IO handle
+ * Make sure the value io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_initialize(
+     libexe_read_plan_io_handle_t **io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_initialize";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = memory_allocate_structure(
+	              libexe_read_plan_io_handle_t );
+
+	if( *io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_handle,
+	     0,
+	     sizeof( libexe_read_plan_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read plan IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libexe_read_plan_io_handle_free(
+     libexe_read_plan_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_free";
+	int range_index       = 0;
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->file_io_handle_opened_in_library != 0 )
+		{
+			if( libbfio_handle_close(
+			     ( *io_handle )->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The file IO handle is only freed if it was created by cloning
+		 */
+		if( ( *io_handle )->file_io_handle_created_in_library != 0 )
+		{
+			if( libbfio_handle_free(
+			     &( ( *io_handle )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->ranges != NULL )
+		{
+			for( range_index = 0;
+			     range_index < ( *io_handle )->number_of_ranges;
+			     range_index++ )
+			{
+				if( ( *io_handle )->ranges[ range_index ].data != NULL )
+				{
+					memory_free(
+					 ( *io_handle )->ranges[ range_index ].data );
+				}
+			}
+			memory_free(
+			 ( *io_handle )->ranges );
+		}
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the IO handle and its attributes
+ * The clone uses a clone of the file IO handle since the offset of the file IO handle is shared
+ * The clone does not contain the ranges of the source and reads all data from the file IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libexe_read_plan_io_handle_clone(
+     libexe_read_plan_io_handle_t **destination_io_handle,
+     libexe_read_plan_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libexe_read_plan_io_handle_clone";
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		*destination_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     source_io_handle->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_read_plan_io_handle_initialize(
+	     destination_io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_io_handle )->file_io_handle_created_in_library = 1;
+	( *destination_io_handle )->access_flags                      = source_io_handle->access_flags;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a range to the read plan
+ * Ranges can only be appended before the IO handle is opened, since
+ * the read plan is executed when the IO handle is opened
+ * Ranges that are empty or exceed the maximum read size are not read in advance
+ * but are read from the file IO handle when requested
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_append_range(
+     libexe_read_plan_io_handle_t *io_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libexe_read_plan_range_t *reallocation = NULL;
+	static char *function                  = "libexe_read_plan_io_handle_append_range";
+	int number_of_allocated_ranges         = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->number_of_requested_ranges += 1;
+	io_handle->requested_size             += size;
+
+	if( ( size == 0 )
+	 || ( size > (size64_t) LIBEXE_READ_PLAN_MAXIMUM_READ_SIZE ) )
+	{
+		return( 1 );
+	}
+	if( io_handle->number_of_ranges >= io_handle->number_of_allocated_ranges )
+	{
+		number_of_allocated_ranges = io_handle->number_of_allocated_ranges * 2;
+
+		if( number_of_allocated_ranges == 0 )
+		{
+			number_of_allocated_ranges = 16;
+		}
+		reallocation = (libexe_read_plan_range_t *) memory_reallocate(
+		                                             io_handle->ranges,
+		                                             sizeof( libexe_read_plan_range_t ) * number_of_allocated_ranges );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->ranges                     = reallocation;
+		io_handle->number_of_allocated_ranges = number_of_allocated_ranges;
+	}
+	io_handle->ranges[ io_handle->number_of_ranges ].offset = offset;
+	io_handle->ranges[ io_handle->number_of_ranges ].size   = size;
+	io_handle->ranges[ io_handle->number_of_ranges ].data   = NULL;
+
+	io_handle->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Executes the read plan
+ * The ranges are sorted by offset and ranges that overlap or are separated by
+ * a gap smaller than the maximum gap size are merged, as long as the merged range
+ * does not exceed the maximum read size. Every merged range is read with a single read
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_execute(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	libexe_read_plan_range_t range;
+
+	static char *function  = "libexe_read_plan_io_handle_execute";
+	size64_t range_end     = 0;
+	ssize_t read_count     = 0;
+	int merged_range_index = 0;
+	int range_index        = 0;
+	int sort_index         = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the ranges by offset, the number of ranges is small
+	 */
+	for( range_index = 1;
+	     range_index < io_handle->number_of_ranges;
+	     range_index++ )
+	{
+		range = io_handle->ranges[ range_index ];
+
+		for( sort_index = range_index;
+		     sort_index > 0;
+		     sort_index-- )
+		{
+			if( io_handle->ranges[ sort_index - 1 ].offset <= range.offset )
+			{
+				break;
+			}
+			io_handle->ranges[ sort_index ] = io_handle->ranges[ sort_index - 1 ];
+		}
+		io_handle->ranges[ sort_index ] = range;
+	}
+	/* Merge the ranges and limit them to the size of the file IO handle
+	 */
+	merged_range_index = -1;
+
+	for( range_index = 0;
+	     range_index < io_handle->number_of_ranges;
+	     range_index++ )
+	{
+		range = io_handle->ranges[ range_index ];
+
+		if( (size64_t) range.offset >= io_handle->size )
+		{
+			break;
+		}
+		if( range.size > ( io_handle->size - range.offset ) )
+		{
+			range.size = io_handle->size - range.offset;
+		}
+		range_end = (size64_t) range.offset + range.size;
+
+		if( merged_range_index >= 0 )
+		{
+			if( ( (size64_t) range.offset <= ( (size64_t) io_handle->ranges[ merged_range_index ].offset + io_handle->ranges[ merged_range_index ].size + LIBEXE_READ_PLAN_MAXIMUM_GAP_SIZE ) )
+			 && ( ( range_end - io_handle->ranges[ merged_range_index ].offset ) <= (size64_t) LIBEXE_READ_PLAN_MAXIMUM_READ_SIZE ) )
+			{
+				if( range_end > ( (size64_t) io_handle->ranges[ merged_range_index ].offset + io_handle->ranges[ merged_range_index ].size ) )
+				{
+					io_handle->ranges[ merged_range_index ].size = range_end - io_handle->ranges[ merged_range_index ].offset;
+				}
+				continue;
+			}
+		}
+		merged_range_index += 1;
+
+		io_handle->ranges[ merged_range_index ] = range;
+	}
+	io_handle->number_of_ranges = merged_range_index + 1;
+
+	for( range_index = 0;
+	     range_index < io_handle->number_of_ranges;
+	     range_index++ )
+	{
+		io_handle->ranges[ range_index ].data = (uint8_t *) memory_allocate(
+		                                                     sizeof( uint8_t ) * (size_t) io_handle->ranges[ range_index ].size );
+
+		if( io_handle->ranges[ range_index ].data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create range: %d data.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( libbfio_handle_seek_offset(
+		     io_handle->file_io_handle,
+		     io_handle->ranges[ range_index ].offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file IO handle.",
+			 function,
+			 io_handle->ranges[ range_index ].offset,
+			 io_handle->ranges[ range_index ].offset );
+
+			return( -1 );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              io_handle->file_io_handle,
+		              io_handle->ranges[ range_index ].data,
+		              (size_t) io_handle->ranges[ range_index ].size,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->ranges[ range_index ].size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read range: %d data from file IO handle.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		io_handle->number_of_reads += 1;
+		io_handle->read_size       += (size64_t) read_count;
+	}
+	return( 1 );
+}
+
+/* Retrieves the read plan statistics
+ * The number of reads and read size include the reads of data
+ * that was not read in advance
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_get_statistics(
+     libexe_read_plan_io_handle_t *io_handle,
+     int *number_of_requested_ranges,
+     int *number_of_reads,
+     size64_t *requested_size,
+     size64_t *read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_get_statistics";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requested_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requested ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( requested_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid requested size.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_requested_ranges = io_handle->number_of_requested_ranges;
+	*number_of_reads            = io_handle->number_of_reads;
+	*requested_size             = io_handle->requested_size;
+	*read_size                  = io_handle->read_size;
+
+	return( 1 );
+}
+
+/* Opens the IO handle
+ * The file IO handle is opened if necessary and the read plan is executed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_open(
+     libexe_read_plan_io_handle_t *io_handle,
+     int flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libexe_read_plan_io_handle_open";
+	int file_io_handle_is_open = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: IO handle already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* Currently only support for reading data
+	 */
+	if( ( flags & ~( LIBBFIO_ACCESS_FLAG_READ ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          io_handle->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     io_handle->file_io_handle,
+		     flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		io_handle->file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     io_handle->file_io_handle,
+	     &( io_handle->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_read_plan_io_handle_execute(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to execute read plan.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->current_offset = 0;
+	io_handle->access_flags   = flags;
+	io_handle->is_open        = 1;
+
+	return( 1 );
+
+on_error:
+	if( io_handle->file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 io_handle->file_io_handle,
+		 NULL );
+
+		io_handle->file_io_handle_opened_in_library = 0;
+	}
+	return( -1 );
+}
+
+/* Closes the IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_close(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_close";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     io_handle->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->file_io_handle_opened_in_library = 0;
+	}
+	io_handle->is_open = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the IO handle
+ * The data is copied from the ranges that were read in advance,
+ * other data is read from the file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libexe_read_plan_io_handle_read(
+         libexe_read_plan_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libexe_read_plan_range_t *range = NULL;
+	static char *function           = "libexe_read_plan_io_handle_read";
+	size64_t range_data_offset      = 0;
+	size_t buffer_offset            = 0;
+	size_t read_size                = 0;
+	ssize_t read_count              = 0;
+	int range_index                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) io_handle->current_offset >= io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( io_handle->size - io_handle->current_offset ) )
+	{
+		size = (size_t) ( io_handle->size - io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		read_size = size - buffer_offset;
+
+		/* The ranges are sorted by offset and do not overlap
+		 */
+		for( range_index = 0;
+		     range_index < io_handle->number_of_ranges;
+		     range_index++ )
+		{
+			range = &( io_handle->ranges[ range_index ] );
+
+			if( ( range->offset + (off64_t) range->size ) > io_handle->current_offset )
+			{
+				break;
+			}
+		}
+		if( range_index >= io_handle->number_of_ranges )
+		{
+			range = NULL;
+		}
+		else if( range->offset > io_handle->current_offset )
+		{
+			/* Read the data before the next range from the file IO handle
+			 */
+			if( (size64_t) read_size > (size64_t) ( range->offset - io_handle->current_offset ) )
+			{
+				read_size = (size_t) ( range->offset - io_handle->current_offset );
+			}
+			range = NULL;
+		}
+		if( range != NULL )
+		{
+			range_data_offset = (size64_t) ( io_handle->current_offset - range->offset );
+
+			if( (size64_t) read_size > ( range->size - range_data_offset ) )
+			{
+				read_size = (size_t) ( range->size - range_data_offset );
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( range->data[ range_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy range: %d data.",
+				 function,
+				 range_index );
+
+				return( -1 );
+			}
+			read_count = (ssize_t) read_size;
+		}
+		else
+		{
+			if( libbfio_handle_seek_offset(
+			     io_handle->file_io_handle,
+			     io_handle->current_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file IO handle.",
+				 function,
+				 io_handle->current_offset,
+				 io_handle->current_offset );
+
+				return( -1 );
+			}
+			read_count = libbfio_handle_read_buffer(
+			              io_handle->file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count <= -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer from file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+			io_handle->number_of_reads += 1;
+			io_handle->read_size       += (size64_t) read_count;
+		}
+		buffer_offset             += (size_t) read_count;
+		io_handle->current_offset += (off64_t) read_count;
+
+		if( read_count == 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libexe_read_plan_io_handle_write(
+         libexe_read_plan_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_write";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - no write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Seeks a certain offset within the IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libexe_read_plan_io_handle_seek_offset(
+         libexe_read_plan_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_seek_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the attached file exists
+ * Returns 1 if the attached file exists, 0 if not or -1 on error
+ */
+int libexe_read_plan_io_handle_exists(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_exists";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_io_handle == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Check if the attached file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libexe_read_plan_io_handle_is_open(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_is_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the attached file size
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_get_size(
+     libexe_read_plan_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_get_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = io_handle->size;
+
+	return( 1 );
+}
+
+/* Creates a file IO handle of a read plan IO handle
+ * The read plan IO handle is freed when the file IO handle is freed, where
+ * the file IO handle of the read plan IO handle is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_read_plan_io_handle_get_file_io_handle(
+     libexe_read_plan_io_handle_t *io_handle,
+     libbfio_handle_t **read_plan_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_read_plan_io_handle_get_file_io_handle";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_initialize(
+	     read_plan_file_io_handle,
+	     (intptr_t *) io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libexe_read_plan_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libexe_read_plan_io_handle_clone,
+	     (int (*)(intptr_t *, int flags, libcerror_error_t **)) libexe_read_plan_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libexe_read_plan_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libexe_read_plan_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libexe_read_plan_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libexe_read_plan_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libexe_read_plan_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libexe_read_plan_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libexe_read_plan_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
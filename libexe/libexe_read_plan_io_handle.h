@@ -0,0 +1,195 @@
+/*
+ * Read plan IO handle functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_READ_PLAN_IO_HANDLE_H )
+#define _LIBEXE_READ_PLAN_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_read_plan_range libexe_read_plan_range_t;
+
+struct libexe_read_plan_range
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The data, which is set when the read plan is executed
+	 */
+	uint8_t *data;
+};
+
+typedef struct libexe_read_plan_io_handle libexe_read_plan_io_handle_t;
+
+struct libexe_read_plan_io_handle
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was created inside the read plan IO handle
+	 */
+	uint8_t file_io_handle_created_in_library;
+
+	/* Value to indicate if the file IO handle was opened inside the read plan IO handle
+	 */
+	uint8_t file_io_handle_opened_in_library;
+
+	/* The ranges, which are sorted and merged when the read plan is executed
+	 */
+	libexe_read_plan_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The number of allocated ranges
+	 */
+	int number_of_allocated_ranges;
+
+	/* The number of requested ranges
+	 */
+	int number_of_requested_ranges;
+
+	/* The requested size
+	 */
+	size64_t requested_size;
+
+	/* The number of reads of the file IO handle
+	 */
+	int number_of_reads;
+
+	/* The number of bytes read from the file IO handle
+	 */
+	size64_t read_size;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the IO handle is open
+	 */
+	uint8_t is_open;
+
+	/* The current access flags
+	 */
+	int access_flags;
+};
+
+int libexe_read_plan_io_handle_initialize(
+     libexe_read_plan_io_handle_t **io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_free(
+     libexe_read_plan_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_clone(
+     libexe_read_plan_io_handle_t **destination_io_handle,
+     libexe_read_plan_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_append_range(
+     libexe_read_plan_io_handle_t *io_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_execute(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_get_statistics(
+     libexe_read_plan_io_handle_t *io_handle,
+     int *number_of_requested_ranges,
+     int *number_of_reads,
+     size64_t *requested_size,
+     size64_t *read_size,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_open(
+     libexe_read_plan_io_handle_t *io_handle,
+     int flags,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_close(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libexe_read_plan_io_handle_read(
+         libexe_read_plan_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libexe_read_plan_io_handle_write(
+         libexe_read_plan_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libexe_read_plan_io_handle_seek_offset(
+         libexe_read_plan_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_exists(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_is_open(
+     libexe_read_plan_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_get_size(
+     libexe_read_plan_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libexe_read_plan_io_handle_get_file_io_handle(
+     libexe_read_plan_io_handle_t *io_handle,
+     libbfio_handle_t **read_plan_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_READ_PLAN_IO_HANDLE_H ) */
+
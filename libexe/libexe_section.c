@@ -577,7 +577,11 @@ ssize_t libexe_section_read_buffer(
 {
 	libexe_internal_section_t *internal_section = NULL;
 	static char *function                       = "libexe_section_read_buffer";
+	size64_t segment_size                       = 0;
+	size_t read_size                            = 0;
 	ssize_t read_count                          = 0;
+	off64_t current_offset                      = 0;
+	off64_t segment_offset                      = 0;
 
 	if( section == NULL )
 	{
@@ -603,6 +607,110 @@ ssize_t libexe_section_read_buffer(
 
 		return( -1 );
 	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_section->io_handle != NULL )
+	 && ( internal_section->io_handle->buffer_data != NULL ) )
+	{
+		if( libexe_section_descriptor_get_data_range(
+		     internal_section->section_descriptor,
+		     &segment_offset,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section data range.",
+			 function );
+
+			return( -1 );
+		}
+		/* Section data that is fully contained in the buffer the file was opened from
+		 * is copied directly from the buffer, the data stream only maintains the offset
+		 */
+		if( ( segment_offset >= 0 )
+		 && ( (size64_t) segment_offset <= (size64_t) internal_section->io_handle->buffer_size )
+		 && ( segment_size <= ( (size64_t) internal_section->io_handle->buffer_size - segment_offset ) ) )
+		{
+			if( libfdata_stream_get_offset(
+			     internal_section->section_descriptor->data_stream,
+			     &current_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve section data stream offset.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( current_offset < 0 )
+			 || ( (size64_t) current_offset >= segment_size ) )
+			{
+				return( 0 );
+			}
+			read_size = buffer_size;
+
+			if( (size64_t) read_size > ( segment_size - current_offset ) )
+			{
+				read_size = (size_t) ( segment_size - current_offset );
+			}
+			if( memory_copy(
+			     buffer,
+			     &( internal_section->io_handle->buffer_data[ segment_offset + current_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy section data.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfdata_stream_seek_offset(
+			     internal_section->section_descriptor->data_stream,
+			     current_offset + (off64_t) read_size,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek in section data stream.",
+				 function );
+
+				return( -1 );
+			}
+			return( (ssize_t) read_size );
+		}
+	}
 	read_count = libfdata_stream_read_buffer(
 	              internal_section->section_descriptor->data_stream,
 	              (intptr_t *) internal_section->file_io_handle,
@@ -932,6 +1040,101 @@ int libexe_section_get_virtual_address(
 	return( 1 );
 }
 
+/* Retrieves a pointer to the section data
+ * The pointer references the buffer the file was opened from and is valid until the file is closed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_section_get_data_pointer(
+     libexe_section_t *section,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_section_t *internal_section = NULL;
+	static char *function                       = "libexe_section_get_data_pointer";
+	size64_t segment_size                       = 0;
+	off64_t segment_offset                      = 0;
+
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	internal_section = (libexe_internal_section_t *) section;
+
+	if( internal_section->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid section - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_section->io_handle->buffer_data == NULL )
+	{
+		return( 0 );
+	}
+	if( libexe_section_descriptor_get_data_range(
+	     internal_section->section_descriptor,
+	     &segment_offset,
+	     &segment_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section data range.",
+		 function );
+
+		return( -1 );
+	}
+	/* Section data that is not fully contained in the buffer is only
+	 * available by reading it
+	 */
+	if( ( segment_offset < 0 )
+	 || ( (size64_t) segment_offset > (size64_t) internal_section->io_handle->buffer_size )
+	 || ( segment_size > ( (size64_t) internal_section->io_handle->buffer_size - segment_offset ) ) )
+	{
+		return( 0 );
+	}
+	*data      = &( internal_section->io_handle->buffer_data[ segment_offset ] );
+	*data_size = (size_t) segment_size;
+
+	return( 1 );
+}
+
 /* Retrieves the section data file IO handle
  * Returns 1 if successful -1 on error
  */
@@ -150,6 +150,13 @@ int libexe_section_get_virtual_address(
      uint32_t *virtual_address,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_section_get_data_pointer(
+     libexe_section_t *section,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_section_get_data_file_io_handle(
      libexe_section_t *section,
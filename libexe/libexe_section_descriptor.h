@@ -52,6 +52,10 @@ struct libexe_section_descriptor
 	/* The data stream
 	 */
 	libfdata_stream_t *data_stream;
+
+	/* The access pattern of the section data
+	 */
+	int access_pattern;
 };
 
 int libexe_section_descriptor_initialize(
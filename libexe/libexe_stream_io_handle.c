@@ -0,0 +1,1084 @@
+/*
+ * The stream IO handle functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_stream_io_handle.h"
+
+/* Creates a stream IO handle
+ * Make sure the value io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_stream_io_handle_initialize(
+     libexe_stream_io_handle_t **io_handle,
+     ssize_t (*read_callback)(
+              uint8_t *buffer,
+              size_t size,
+              void *callback_data ),
+     void *callback_data,
+     size64_t stream_size,
+     size_t maximum_buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_initialize";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_buffer_size != 0 )
+	 && ( maximum_buffer_size < LIBEXE_STREAM_IO_HANDLE_MINIMUM_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = memory_allocate_structure(
+	              libexe_stream_io_handle_t );
+
+	if( *io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_handle,
+	     0,
+	     sizeof( libexe_stream_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->read_callback       = read_callback;
+	( *io_handle )->callback_data       = callback_data;
+	( *io_handle )->stream_size         = stream_size;
+	( *io_handle )->maximum_buffer_size = maximum_buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a stream IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libexe_stream_io_handle_free(
+     libexe_stream_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_free";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->buffer );
+		}
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones (duplicates) the IO handle and its attributes
+ * A stream can only be consumed once and therefore cannot be cloned
+ * Returns 1 if succesful or -1 on error
+ */
+int libexe_stream_io_handle_clone(
+     libexe_stream_io_handle_t **destination_io_handle,
+     libexe_stream_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_clone";
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		*destination_io_handle = NULL;
+
+		return( 1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unable to clone stream IO handle.",
+	 function );
+
+	return( -1 );
+}
+
+/* Opens the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_stream_io_handle_open(
+     libexe_stream_io_handle_t *io_handle,
+     int flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: IO handle already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* Currently only support for reading data
+	 */
+	if( ( flags & ~( LIBBFIO_ACCESS_FLAG_READ ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = io_handle->buffer_offset;
+	io_handle->access_flags   = flags;
+	io_handle->is_open        = 1;
+
+	return( 1 );
+}
+
+/* Closes the IO handle
+ * The data that was consumed from the stream is not released
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_stream_io_handle_close(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_close";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->is_open = 0;
+
+	return( 0 );
+}
+
+/* Sets the data callback
+ * The data callback is passed the data as it is consumed from the stream,
+ * which allows the data to be processed in a single forward pass
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_stream_io_handle_set_data_callback(
+     libexe_stream_io_handle_t *io_handle,
+     int (*data_callback)(
+            off64_t stream_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *data_callback_data ),
+     void *data_callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_set_data_callback";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->data_callback        = data_callback;
+	io_handle->data_callback_data   = data_callback_data;
+	io_handle->data_callback_offset = io_handle->buffer_offset;
+
+	return( 1 );
+}
+
+/* Passes the buffered data that has not been processed to the data callback
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_stream_io_handle_flush_data_callback(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_flush_data_callback";
+	size_t buffer_offset  = 0;
+	off64_t stream_offset = 0;
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->data_callback == NULL )
+	{
+		return( 1 );
+	}
+	stream_offset = io_handle->buffer_offset + (off64_t) io_handle->buffer_data_size;
+
+	if( io_handle->data_callback_offset < io_handle->buffer_offset )
+	{
+		io_handle->data_callback_offset = io_handle->buffer_offset;
+	}
+	if( io_handle->data_callback_offset >= stream_offset )
+	{
+		return( 1 );
+	}
+	buffer_offset = (size_t) ( io_handle->data_callback_offset - io_handle->buffer_offset );
+
+	result = io_handle->data_callback(
+	          io_handle->data_callback_offset,
+	          &( io_handle->buffer[ buffer_offset ] ),
+	          io_handle->buffer_data_size - buffer_offset,
+	          io_handle->data_callback_data );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: data callback failed at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 io_handle->data_callback_offset,
+		 io_handle->data_callback_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		io_handle->data_callback_offset = stream_offset;
+	}
+	return( 1 );
+}
+
+/* Consumes data from the stream until the buffer contains the data at a specific offset
+ * When the buffer has reached the maximum buffer size the oldest half of the buffered data is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_stream_io_handle_fill_buffer(
+     libexe_stream_io_handle_t *io_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	static char *function      = "libexe_stream_io_handle_fill_buffer";
+	size64_t remaining_size    = 0;
+	size_t buffer_discard_size = 0;
+	size_t read_size           = 0;
+	ssize_t read_count         = 0;
+	off64_t stream_offset      = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= io_handle->stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < io_handle->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek backwards to offset: %" PRIi64 " (0x%08" PRIx64 ") before buffered data of stream.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	stream_offset = io_handle->buffer_offset + (off64_t) io_handle->buffer_data_size;
+
+	while( offset >= stream_offset )
+	{
+		if( io_handle->buffer_data_size == io_handle->buffer_allocated_size )
+		{
+			if( ( io_handle->maximum_buffer_size == 0 )
+			 || ( io_handle->buffer_allocated_size < io_handle->maximum_buffer_size ) )
+			{
+				read_size = io_handle->buffer_allocated_size * 2;
+
+				if( read_size < LIBEXE_STREAM_IO_HANDLE_MINIMUM_BUFFER_SIZE )
+				{
+					read_size = LIBEXE_STREAM_IO_HANDLE_MINIMUM_BUFFER_SIZE;
+				}
+				if( ( io_handle->maximum_buffer_size != 0 )
+				 && ( read_size > io_handle->maximum_buffer_size ) )
+				{
+					read_size = io_handle->maximum_buffer_size;
+				}
+				if( read_size > (size_t) SSIZE_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid buffer size value exceeds maximum.",
+					 function );
+
+					return( -1 );
+				}
+				reallocation = (uint8_t *) memory_reallocate(
+				                            io_handle->buffer,
+				                            sizeof( uint8_t ) * read_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize buffer.",
+					 function );
+
+					return( -1 );
+				}
+				io_handle->buffer                = reallocation;
+				io_handle->buffer_allocated_size = read_size;
+			}
+			else
+			{
+				/* The data is passed to the data callback before it is discarded
+				 */
+				if( libexe_stream_io_handle_flush_data_callback(
+				     io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to flush data callback.",
+					 function );
+
+					return( -1 );
+				}
+				/* The discarded part is at least as large as the part that is kept
+				 * hence the source and destination of the copy do not overlap
+				 */
+				buffer_discard_size = io_handle->buffer_data_size - ( io_handle->buffer_data_size / 2 );
+
+				if( memory_copy(
+				     io_handle->buffer,
+				     &( io_handle->buffer[ buffer_discard_size ] ),
+				     io_handle->buffer_data_size - buffer_discard_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy buffered data.",
+					 function );
+
+					return( -1 );
+				}
+				io_handle->buffer_offset    += (off64_t) buffer_discard_size;
+				io_handle->buffer_data_size -= buffer_discard_size;
+			}
+		}
+		read_size      = io_handle->buffer_allocated_size - io_handle->buffer_data_size;
+		remaining_size = io_handle->stream_size - (size64_t) stream_offset;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = io_handle->read_callback(
+		              &( io_handle->buffer[ io_handle->buffer_data_size ] ),
+		              read_size,
+		              io_handle->callback_data );
+
+		if( ( read_count <= 0 )
+		 || ( (size_t) read_count > read_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data from stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 stream_offset,
+			 stream_offset );
+
+			return( -1 );
+		}
+		io_handle->buffer_data_size += (size_t) read_count;
+
+		stream_offset += (off64_t) read_count;
+
+		if( libexe_stream_io_handle_flush_data_callback(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush data callback.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from the IO handle
+ * Data before the current offset is read from the buffer and data after
+ * the buffered data is consumed from the stream
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libexe_stream_io_handle_read(
+         libexe_stream_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_read";
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	size_t read_count     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) io_handle->current_offset >= io_handle->stream_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( io_handle->stream_size - io_handle->current_offset ) )
+	{
+		size = (size_t) ( io_handle->stream_size - io_handle->current_offset );
+	}
+	while( read_count < size )
+	{
+		if( libexe_stream_io_handle_fill_buffer(
+		     io_handle,
+		     io_handle->current_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to fill buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset = (size_t) ( io_handle->current_offset - io_handle->buffer_offset );
+		read_size     = io_handle->buffer_data_size - buffer_offset;
+
+		if( read_size > ( size - read_count ) )
+		{
+			read_size = size - read_count;
+		}
+		if( memory_copy(
+		     &( buffer[ read_count ] ),
+		     &( io_handle->buffer[ buffer_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffered data.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->current_offset += (off64_t) read_size;
+
+		read_count += read_size;
+	}
+	return( (ssize_t) read_count );
+}
+
+/* Writes a buffer to the IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libexe_stream_io_handle_write(
+         libexe_stream_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_write";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - no write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Seeks a certain offset within the IO handle
+ * Seeking does not consume data from the stream, a seek backwards before
+ * the buffered data fails on the next read
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libexe_stream_io_handle_seek_offset(
+         libexe_stream_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_seek_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) io_handle->stream_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the attached stream exists
+ * Returns 1 if the attached stream exists, 0 if not or -1 on error
+ */
+int libexe_stream_io_handle_exists(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_exists";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->read_callback == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Check if the attached stream is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libexe_stream_io_handle_is_open(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_is_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the attached stream size
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_stream_io_handle_get_size(
+     libexe_stream_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_stream_io_handle_get_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = io_handle->stream_size;
+
+	return( 1 );
+}
+
+/* Creates a file IO handle of a forward-only stream
+ * The read callback returns the number of bytes read, which is at most size,
+ * or -1 on error. The data consumed from the stream is buffered so that
+ * the data can be read more than once. A maximum buffer size of 0 represents
+ * no maximum. The optional data callback is passed the data as it is consumed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_stream_io_handle_get_file_io_handle(
+     ssize_t (*read_callback)(
+              uint8_t *buffer,
+              size_t size,
+              void *callback_data ),
+     void *callback_data,
+     size64_t stream_size,
+     size_t maximum_buffer_size,
+     int (*data_callback)(
+            off64_t stream_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *data_callback_data ),
+     void *data_callback_data,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libexe_stream_io_handle_t *io_handle = NULL;
+	static char *function                = "libexe_stream_io_handle_get_file_io_handle";
+
+	if( libexe_stream_io_handle_initialize(
+	     &io_handle,
+	     read_callback,
+	     callback_data,
+	     stream_size,
+	     maximum_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_stream_io_handle_set_data_callback(
+	     io_handle,
+	     data_callback,
+	     data_callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data callback.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libexe_stream_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libexe_stream_io_handle_clone,
+	     (int (*)(intptr_t *, int flags, libcerror_error_t **)) libexe_stream_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libexe_stream_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libexe_stream_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libexe_stream_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libexe_stream_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libexe_stream_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libexe_stream_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libexe_stream_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_handle != NULL )
+	{
+		libexe_stream_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,206 @@
+/*
+ * The stream IO handle functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_STREAM_IO_HANDLE_H )
+#define _LIBEXE_STREAM_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_stream_io_handle libexe_stream_io_handle_t;
+
+struct libexe_stream_io_handle
+{
+	/* The read callback
+	 */
+	ssize_t (*read_callback)(
+	           uint8_t *buffer,
+	           size_t size,
+	           void *callback_data );
+
+	/* The read callback data
+	 */
+	void *callback_data;
+
+	/* The stream size
+	 */
+	size64_t stream_size;
+
+	/* The maximum buffer size, 0 represents no maximum
+	 */
+	size_t maximum_buffer_size;
+
+	/* The buffer that contains the most recently consumed data of the stream
+	 */
+	uint8_t *buffer;
+
+	/* The allocated size of the buffer
+	 */
+	size_t buffer_allocated_size;
+
+	/* The size of the data in the buffer
+	 */
+	size_t buffer_data_size;
+
+	/* The stream offset of the data in the buffer
+	 */
+	off64_t buffer_offset;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The data callback, which is passed the data as it is consumed from the stream
+	 * The data callback returns 1 if the data was processed, 0 if the data should
+	 * be passed again later or -1 on error
+	 */
+	int (*data_callback)(
+	       off64_t stream_offset,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *data_callback_data );
+
+	/* The data callback data
+	 */
+	void *data_callback_data;
+
+	/* The stream offset of the buffered data that has not been processed by the data callback
+	 */
+	off64_t data_callback_offset;
+
+	/* Value to indicate the IO handle is open
+	 */
+	uint8_t is_open;
+
+	/* The current access flags
+	 */
+	int access_flags;
+};
+
+int libexe_stream_io_handle_initialize(
+     libexe_stream_io_handle_t **io_handle,
+     ssize_t (*read_callback)(
+              uint8_t *buffer,
+              size_t size,
+              void *callback_data ),
+     void *callback_data,
+     size64_t stream_size,
+     size_t maximum_buffer_size,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_free(
+     libexe_stream_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_clone(
+     libexe_stream_io_handle_t **destination_io_handle,
+     libexe_stream_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_open(
+     libexe_stream_io_handle_t *io_handle,
+     int flags,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_close(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_set_data_callback(
+     libexe_stream_io_handle_t *io_handle,
+     int (*data_callback)(
+            off64_t stream_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *data_callback_data ),
+     void *data_callback_data,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_flush_data_callback(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_fill_buffer(
+     libexe_stream_io_handle_t *io_handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
+ssize_t libexe_stream_io_handle_read(
+         libexe_stream_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libexe_stream_io_handle_write(
+         libexe_stream_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libexe_stream_io_handle_seek_offset(
+         libexe_stream_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libexe_stream_io_handle_exists(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_is_open(
+     libexe_stream_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_get_size(
+     libexe_stream_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libexe_stream_io_handle_get_file_io_handle(
+     ssize_t (*read_callback)(
+              uint8_t *buffer,
+              size_t size,
+              void *callback_data ),
+     void *callback_data,
+     size64_t stream_size,
+     size_t maximum_buffer_size,
+     int (*data_callback)(
+            off64_t stream_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *data_callback_data ),
+     void *data_callback_data,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_STREAM_IO_HANDLE_H ) */
+
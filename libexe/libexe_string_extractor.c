@@ -0,0 +1,626 @@
+/*
+ * String extractor functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+#include "libexe_string_extractor.h"
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEXE_STRING_EXTRACTOR_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+/* A printable character is a tab or a character in the range 0x20 - 0x7e
+ */
+#define libexe_string_extractor_is_printable( byte_value ) \
+	( ( (uint8_t) ( ( byte_value ) - 0x20 ) < 0x5f ) || ( ( byte_value ) == 0x09 ) )
+
+/* Creates a string extractor
+ * Make sure the value string_extractor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_extractor_initialize(
+     libexe_string_extractor_t **string_extractor,
+     uint8_t string_types,
+     size_t minimum_length,
+     off64_t file_offset,
+     uint32_t relative_virtual_address,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_extractor_initialize";
+	int parity            = 0;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_extractor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string extractor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_types == 0 )
+	 || ( ( string_types & ~( LIBEXE_STRING_TYPES_SUPPORTED ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string types: 0x%02" PRIx8 ".",
+		 function,
+		 string_types );
+
+		return( -1 );
+	}
+	if( ( minimum_length == 0 )
+	 || ( minimum_length > LIBEXE_STRING_EXTRACTOR_MAXIMUM_STRING_LENGTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string callback.",
+		 function );
+
+		return( -1 );
+	}
+	*string_extractor = memory_allocate_structure(
+	                     libexe_string_extractor_t );
+
+	if( *string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string extractor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_extractor,
+	     0,
+	     sizeof( libexe_string_extractor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string extractor.",
+		 function );
+
+		memory_free(
+		 *string_extractor );
+
+		*string_extractor = NULL;
+
+		return( -1 );
+	}
+	if( ( string_types & LIBEXE_STRING_TYPE_ASCII ) != 0 )
+	{
+		( *string_extractor )->ascii_string = (uint8_t *) memory_allocate(
+		                                                   sizeof( uint8_t ) * LIBEXE_STRING_EXTRACTOR_MAXIMUM_STRING_LENGTH );
+
+		if( ( *string_extractor )->ascii_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create ASCII string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( string_types & LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN ) != 0 )
+	{
+		for( parity = 0;
+		     parity < 2;
+		     parity++ )
+		{
+			( *string_extractor )->utf16_strings[ parity ] = (uint8_t *) memory_allocate(
+			                                                              sizeof( uint8_t ) * LIBEXE_STRING_EXTRACTOR_MAXIMUM_STRING_LENGTH );
+
+			if( ( *string_extractor )->utf16_strings[ parity ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create UTF-16 string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	( *string_extractor )->string_types             = string_types;
+	( *string_extractor )->minimum_length           = minimum_length;
+	( *string_extractor )->file_offset              = file_offset;
+	( *string_extractor )->relative_virtual_address = relative_virtual_address;
+	( *string_extractor )->string_callback          = string_callback;
+	( *string_extractor )->callback_data            = callback_data;
+
+	return( 1 );
+
+on_error:
+	if( *string_extractor != NULL )
+	{
+		libexe_string_extractor_free(
+		 string_extractor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a string extractor
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_extractor_free(
+     libexe_string_extractor_t **string_extractor,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_extractor_free";
+	int parity            = 0;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_extractor != NULL )
+	{
+		for( parity = 0;
+		     parity < 2;
+		     parity++ )
+		{
+			if( ( *string_extractor )->utf16_strings[ parity ] != NULL )
+			{
+				memory_free(
+				 ( *string_extractor )->utf16_strings[ parity ] );
+			}
+		}
+		if( ( *string_extractor )->ascii_string != NULL )
+		{
+			memory_free(
+			 ( *string_extractor )->ascii_string );
+		}
+		memory_free(
+		 *string_extractor );
+
+		*string_extractor = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if a block of LIBEXE_STRING_EXTRACTOR_BLOCK_SIZE bytes contains a printable character
+ * Returns 1 if the block contains a printable character or 0 if not
+ */
+static int libexe_string_extractor_block_has_printable(
+            const uint8_t *block )
+{
+#if defined( LIBEXE_STRING_EXTRACTOR_HAVE_SSE2 )
+	__m128i block_values = _mm_setzero_si128();
+	__m128i printable    = _mm_setzero_si128();
+	__m128i sign_bits    = _mm_set1_epi8( (char) 0x80 );
+	__m128i lower_bound  = _mm_set1_epi8( (char) ( 0x1f ^ 0x80 ) );
+	__m128i upper_bound  = _mm_set1_epi8( (char) ( 0x7f ^ 0x80 ) );
+	__m128i tab          = _mm_set1_epi8( 0x09 );
+	__m128i values       = _mm_setzero_si128();
+	size_t block_offset  = 0;
+
+	for( block_offset = 0;
+	     block_offset < LIBEXE_STRING_EXTRACTOR_BLOCK_SIZE;
+	     block_offset += 16 )
+	{
+		block_values = _mm_loadu_si128(
+		                (const __m128i *) &( block[ block_offset ] ) );
+
+		/* The sign bit is flipped so that the signed comparisons act as unsigned comparisons
+		 */
+		values = _mm_xor_si128(
+		          block_values,
+		          sign_bits );
+
+		printable = _mm_or_si128(
+		             printable,
+		             _mm_and_si128(
+		              _mm_cmpgt_epi8(
+		               values,
+		               lower_bound ),
+		              _mm_cmplt_epi8(
+		               values,
+		               upper_bound ) ) );
+
+		printable = _mm_or_si128(
+		             printable,
+		             _mm_cmpeq_epi8(
+		              block_values,
+		              tab ) );
+	}
+	return( _mm_movemask_epi8( printable ) != 0 );
+#else
+	size_t block_offset = 0;
+	int has_printable   = 0;
+
+	for( block_offset = 0;
+	     block_offset < LIBEXE_STRING_EXTRACTOR_BLOCK_SIZE;
+	     block_offset++ )
+	{
+		has_printable |= libexe_string_extractor_is_printable(
+		                  block[ block_offset ] );
+	}
+	return( has_printable );
+#endif
+}
+
+/* Passes a string to the string callback if it has the minimum length
+ * Returns 1 if successful, 0 if the string callback requested to stop or -1 on error
+ */
+static int libexe_string_extractor_emit_string(
+            libexe_string_extractor_t *string_extractor,
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            size64_t string_offset,
+            libcerror_error_t **error )
+{
+	static char *function             = "libexe_string_extractor_emit_string";
+	uint32_t relative_virtual_address = 0;
+	int result                        = 0;
+
+	if( string_length < string_extractor->minimum_length )
+	{
+		return( 1 );
+	}
+	/* Data that is not mapped into the image, such as the overlay, has no relative virtual address
+	 */
+	if( string_extractor->relative_virtual_address != 0 )
+	{
+		relative_virtual_address = string_extractor->relative_virtual_address + (uint32_t) string_offset;
+	}
+	result = string_extractor->string_callback(
+	          string_type,
+	          string,
+	          string_length,
+	          string_extractor->file_offset + (off64_t) string_offset,
+	          relative_virtual_address,
+	          string_extractor->callback_data );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: string callback failed for string at offset: %" PRIu64 ".",
+		 function,
+		 string_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		string_extractor->is_stopped = 1;
+	}
+	return( result );
+}
+
+/* Updates the string extractor
+ * Blocks of data without printable characters are skipped when no string is in progress
+ * Returns 1 if successful, 0 if the string callback requested to stop or -1 on error
+ */
+int libexe_string_extractor_update(
+     libexe_string_extractor_t *string_extractor,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_extractor_update";
+	size_t buffer_offset  = 0;
+	size_t scan_offset    = 0;
+	uint8_t byte_value    = 0;
+	uint8_t is_printable  = 0;
+	int parity            = 0;
+	int result            = 1;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_extractor->is_stopped != 0 )
+	{
+		return( 0 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		/* When no string is in progress, the data can be skipped until a block
+		 * that contains a printable character
+		 */
+		if( ( buffer_offset >= scan_offset )
+		 && ( string_extractor->previous_byte_is_printable == 0 )
+		 && ( string_extractor->ascii_string_length == 0 )
+		 && ( string_extractor->utf16_string_lengths[ 0 ] == 0 )
+		 && ( string_extractor->utf16_string_lengths[ 1 ] == 0 ) )
+		{
+			while( ( buffer_size - buffer_offset ) >= LIBEXE_STRING_EXTRACTOR_BLOCK_SIZE )
+			{
+				if( libexe_string_extractor_block_has_printable(
+				     &( buffer[ buffer_offset ] ) ) != 0 )
+				{
+					/* Process the block byte by byte before checking the next block
+					 */
+					scan_offset = buffer_offset + LIBEXE_STRING_EXTRACTOR_BLOCK_SIZE;
+
+					break;
+				}
+				buffer_offset                  += LIBEXE_STRING_EXTRACTOR_BLOCK_SIZE;
+				string_extractor->data_offset  += LIBEXE_STRING_EXTRACTOR_BLOCK_SIZE;
+				string_extractor->previous_byte = buffer[ buffer_offset - 1 ];
+			}
+			if( buffer_offset >= buffer_size )
+			{
+				break;
+			}
+		}
+		byte_value   = buffer[ buffer_offset ];
+		is_printable = (uint8_t) libexe_string_extractor_is_printable(
+		                          byte_value );
+
+		if( ( string_extractor->string_types & LIBEXE_STRING_TYPE_ASCII ) != 0 )
+		{
+			if( ( is_printable == 0 )
+			 || ( string_extractor->ascii_string_length >= LIBEXE_STRING_EXTRACTOR_MAXIMUM_STRING_LENGTH ) )
+			{
+				if( string_extractor->ascii_string_length > 0 )
+				{
+					result = libexe_string_extractor_emit_string(
+					          string_extractor,
+					          LIBEXE_STRING_TYPE_ASCII,
+					          string_extractor->ascii_string,
+					          string_extractor->ascii_string_length,
+					          string_extractor->ascii_string_offset,
+					          error );
+
+					string_extractor->ascii_string_length = 0;
+				}
+			}
+			if( ( result == 1 )
+			 && ( is_printable != 0 ) )
+			{
+				if( string_extractor->ascii_string_length == 0 )
+				{
+					string_extractor->ascii_string_offset = string_extractor->data_offset;
+				}
+				string_extractor->ascii_string[ string_extractor->ascii_string_length++ ] = byte_value;
+			}
+		}
+		/* A UTF-16 little-endian character consists of a printable character followed by a 0 byte,
+		 * strings at even and odd offsets are tracked separately
+		 */
+		if( ( result == 1 )
+		 && ( ( string_extractor->string_types & LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN ) != 0 )
+		 && ( string_extractor->data_offset > 0 ) )
+		{
+			parity = (int) ( ( string_extractor->data_offset - 1 ) & 1 );
+
+			if( ( string_extractor->previous_byte_is_printable == 0 )
+			 || ( byte_value != 0 )
+			 || ( string_extractor->utf16_string_lengths[ parity ] >= LIBEXE_STRING_EXTRACTOR_MAXIMUM_STRING_LENGTH ) )
+			{
+				if( string_extractor->utf16_string_lengths[ parity ] > 0 )
+				{
+					result = libexe_string_extractor_emit_string(
+					          string_extractor,
+					          LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+					          string_extractor->utf16_strings[ parity ],
+					          string_extractor->utf16_string_lengths[ parity ],
+					          string_extractor->utf16_string_offsets[ parity ],
+					          error );
+
+					string_extractor->utf16_string_lengths[ parity ] = 0;
+				}
+			}
+			if( ( result == 1 )
+			 && ( string_extractor->previous_byte_is_printable != 0 )
+			 && ( byte_value == 0 ) )
+			{
+				if( string_extractor->utf16_string_lengths[ parity ] == 0 )
+				{
+					string_extractor->utf16_string_offsets[ parity ] = string_extractor->data_offset - 1;
+				}
+				string_extractor->utf16_strings[ parity ][ string_extractor->utf16_string_lengths[ parity ]++ ] = string_extractor->previous_byte;
+			}
+		}
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to emit string.",
+				 function );
+			}
+			return( result );
+		}
+		string_extractor->previous_byte              = byte_value;
+		string_extractor->previous_byte_is_printable = is_printable;
+		string_extractor->data_offset               += 1;
+
+		buffer_offset++;
+	}
+	return( 1 );
+}
+
+/* Finalizes the string extractor
+ * Passes the strings that are still in progress to the string callback
+ * Returns 1 if successful, 0 if the string callback requested to stop or -1 on error
+ */
+int libexe_string_extractor_finalize(
+     libexe_string_extractor_t *string_extractor,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_extractor_finalize";
+	int parity            = 0;
+	int result            = 1;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_extractor->is_stopped != 0 )
+	{
+		return( 0 );
+	}
+	if( string_extractor->ascii_string_length > 0 )
+	{
+		result = libexe_string_extractor_emit_string(
+		          string_extractor,
+		          LIBEXE_STRING_TYPE_ASCII,
+		          string_extractor->ascii_string,
+		          string_extractor->ascii_string_length,
+		          string_extractor->ascii_string_offset,
+		          error );
+
+		string_extractor->ascii_string_length = 0;
+	}
+	/* Emit the UTF-16 strings in the order of their offsets
+	 */
+	parity = 0;
+
+	if( ( string_extractor->utf16_string_lengths[ 0 ] > 0 )
+	 && ( string_extractor->utf16_string_lengths[ 1 ] > 0 )
+	 && ( string_extractor->utf16_string_offsets[ 1 ] < string_extractor->utf16_string_offsets[ 0 ] ) )
+	{
+		parity = 1;
+	}
+	while( ( result == 1 )
+	    && ( ( string_extractor->utf16_string_lengths[ 0 ] > 0 )
+	     ||  ( string_extractor->utf16_string_lengths[ 1 ] > 0 ) ) )
+	{
+		if( string_extractor->utf16_string_lengths[ parity ] > 0 )
+		{
+			result = libexe_string_extractor_emit_string(
+			          string_extractor,
+			          LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+			          string_extractor->utf16_strings[ parity ],
+			          string_extractor->utf16_string_lengths[ parity ],
+			          string_extractor->utf16_string_offsets[ parity ],
+			          error );
+
+			string_extractor->utf16_string_lengths[ parity ] = 0;
+		}
+		parity = 1 - parity;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to emit string.",
+		 function );
+	}
+	return( result );
+}
+
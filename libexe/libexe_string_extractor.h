@@ -0,0 +1,144 @@
+/*
+ * String extractor functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_STRING_EXTRACTOR_H )
+#define _LIBEXE_STRING_EXTRACTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_string_extractor libexe_string_extractor_t;
+
+struct libexe_string_extractor
+{
+	/* The string types
+	 */
+	uint8_t string_types;
+
+	/* The minimum string length
+	 */
+	size_t minimum_length;
+
+	/* The file offset of the data
+	 */
+	off64_t file_offset;
+
+	/* The relative virtual address of the data or 0 if the data is not mapped into the image
+	 */
+	uint32_t relative_virtual_address;
+
+	/* The string callback function
+	 */
+	int (*string_callback)(
+	       uint8_t string_type,
+	       const uint8_t *string,
+	       size_t string_length,
+	       off64_t file_offset,
+	       uint32_t relative_virtual_address,
+	       void *callback_data );
+
+	/* The string callback data
+	 */
+	void *callback_data;
+
+	/* The offset of the next byte relative to the start of the data
+	 */
+	size64_t data_offset;
+
+	/* The previous byte value
+	 */
+	uint8_t previous_byte;
+
+	/* Value to indicate the previous byte is a printable character
+	 */
+	uint8_t previous_byte_is_printable;
+
+	/* The ASCII string
+	 */
+	uint8_t *ascii_string;
+
+	/* The ASCII string length
+	 */
+	size_t ascii_string_length;
+
+	/* The ASCII string offset relative to the start of the data
+	 */
+	size64_t ascii_string_offset;
+
+	/* The UTF-16 little-endian strings at even and odd offsets
+	 */
+	uint8_t *utf16_strings[ 2 ];
+
+	/* The UTF-16 little-endian string lengths in characters
+	 */
+	size_t utf16_string_lengths[ 2 ];
+
+	/* The UTF-16 little-endian string offsets relative to the start of the data
+	 */
+	size64_t utf16_string_offsets[ 2 ];
+
+	/* Value to indicate the string callback requested to stop
+	 */
+	uint8_t is_stopped;
+};
+
+int libexe_string_extractor_initialize(
+     libexe_string_extractor_t **string_extractor,
+     uint8_t string_types,
+     size_t minimum_length,
+     off64_t file_offset,
+     uint32_t relative_virtual_address,
+     int (*string_callback)(
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            off64_t file_offset,
+            uint32_t relative_virtual_address,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libexe_string_extractor_free(
+     libexe_string_extractor_t **string_extractor,
+     libcerror_error_t **error );
+
+int libexe_string_extractor_update(
+     libexe_string_extractor_t *string_extractor,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libexe_string_extractor_finalize(
+     libexe_string_extractor_t *string_extractor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_STRING_EXTRACTOR_H ) */
+
@@ -0,0 +1,660 @@
+/*
+ * Thread local storage (TLS) directory functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+#include "libexe_tls_directory.h"
+
+#include "exe_tls_directory.h"
+
+/* Creates a TLS directory
+ * Make sure the value tls_directory is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tls_directory_initialize(
+     libexe_tls_directory_t **tls_directory,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_tls_directory_initialize";
+
+	if( tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tls_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid TLS directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*tls_directory = memory_allocate_structure(
+	                  libexe_tls_directory_t );
+
+	if( *tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create TLS directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *tls_directory,
+	     0,
+	     sizeof( libexe_tls_directory_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear TLS directory.",
+		 function );
+
+		memory_free(
+		 *tls_directory );
+
+		*tls_directory = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *tls_directory != NULL )
+	{
+		memory_free(
+		 *tls_directory );
+
+		*tls_directory = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a TLS directory
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tls_directory_free(
+     libexe_tls_directory_t **tls_directory,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_tls_directory_free";
+
+	if( tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tls_directory != NULL )
+	{
+		if( ( *tls_directory )->callback_addresses != NULL )
+		{
+			memory_free(
+			 ( *tls_directory )->callback_addresses );
+		}
+		memory_free(
+		 *tls_directory );
+
+		*tls_directory = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the TLS directory
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tls_directory_read(
+     libexe_tls_directory_t *tls_directory,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint16_t coff_optional_header_signature,
+     libcerror_error_t **error )
+{
+	uint8_t tls_directory_data[ sizeof( exe_tls_directory64_t ) ];
+
+	static char *function = "libexe_tls_directory_read";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	{
+		read_size = sizeof( exe_tls_directory32_t );
+	}
+	else if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	{
+		read_size = sizeof( exe_tls_directory64_t );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported COFF optional header signature: 0x%04" PRIx16 ".",
+		 function,
+		 coff_optional_header_signature );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading TLS directory at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek TLS directory offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              tls_directory_data,
+	              read_size,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: TLS directory data:\n",
+		 function );
+		libcnotify_print_data(
+		 tls_directory_data,
+		 read_size,
+		 0 );
+	}
+#endif
+	if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory32_t *) tls_directory_data )->raw_data_start_address,
+		 tls_directory->raw_data_start_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory32_t *) tls_directory_data )->raw_data_end_address,
+		 tls_directory->raw_data_end_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory32_t *) tls_directory_data )->index_address,
+		 tls_directory->index_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory32_t *) tls_directory_data )->callbacks_address,
+		 tls_directory->callbacks_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory32_t *) tls_directory_data )->size_of_zero_fill,
+		 tls_directory->size_of_zero_fill );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory32_t *) tls_directory_data )->characteristics,
+		 tls_directory->characteristics );
+	}
+	else
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_tls_directory64_t *) tls_directory_data )->raw_data_start_address,
+		 tls_directory->raw_data_start_address );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_tls_directory64_t *) tls_directory_data )->raw_data_end_address,
+		 tls_directory->raw_data_end_address );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_tls_directory64_t *) tls_directory_data )->index_address,
+		 tls_directory->index_address );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_tls_directory64_t *) tls_directory_data )->callbacks_address,
+		 tls_directory->callbacks_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory64_t *) tls_directory_data )->size_of_zero_fill,
+		 tls_directory->size_of_zero_fill );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_tls_directory64_t *) tls_directory_data )->characteristics,
+		 tls_directory->characteristics );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: raw data start address\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 tls_directory->raw_data_start_address );
+
+		libcnotify_printf(
+		 "%s: raw data end address\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 tls_directory->raw_data_end_address );
+
+		libcnotify_printf(
+		 "%s: index address\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 tls_directory->index_address );
+
+		libcnotify_printf(
+		 "%s: callbacks address\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 tls_directory->callbacks_address );
+
+		libcnotify_printf(
+		 "%s: size of zero fill\t\t\t: %" PRIu32 "\n",
+		 function,
+		 tls_directory->size_of_zero_fill );
+
+		libcnotify_printf(
+		 "%s: characteristics\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 tls_directory->characteristics );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the TLS callbacks
+ * The callbacks are stored as an array of VAs that is terminated by a 0 value
+ * The array is read in chunks, most files only require a single read
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tls_directory_read_callbacks(
+     libexe_tls_directory_t *tls_directory,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint16_t coff_optional_header_signature,
+     libcerror_error_t **error )
+{
+	uint8_t callbacks_data[ LIBEXE_TLS_CALLBACKS_READ_BUFFER_SIZE ];
+
+	void *reallocation            = NULL;
+	static char *function         = "libexe_tls_directory_read_callbacks";
+	size64_t file_size            = 0;
+	size_t data_offset            = 0;
+	size_t entry_size             = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	uint64_t callback_address     = 0;
+	int maximum_number_of_entries = 0;
+
+	if( tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( tls_directory->callback_addresses != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid TLS directory - callback addresses value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	{
+		entry_size = 4;
+	}
+	else if( coff_optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	{
+		entry_size = 8;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported COFF optional header signature: 0x%04" PRIx16 ".",
+		 function,
+		 coff_optional_header_signature );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading TLS callbacks at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek TLS callbacks offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		goto on_error;
+	}
+	/* An array without a terminating 0 value is considered to end at the end of the file
+	 */
+	while( (size64_t) file_offset < file_size )
+	{
+		read_size = LIBEXE_TLS_CALLBACKS_READ_BUFFER_SIZE;
+
+		if( (size64_t) read_size > ( file_size - (size64_t) file_offset ) )
+		{
+			read_size = (size_t) ( file_size - (size64_t) file_offset );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              callbacks_data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read TLS callbacks.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+
+		for( data_offset = 0;
+		     ( data_offset + entry_size ) <= read_size;
+		     data_offset += entry_size )
+		{
+			if( entry_size == 4 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( callbacks_data[ data_offset ] ),
+				 callback_address );
+			}
+			else
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( callbacks_data[ data_offset ] ),
+				 callback_address );
+			}
+			if( callback_address == 0 )
+			{
+				return( 1 );
+			}
+			if( tls_directory->number_of_callbacks >= LIBEXE_MAXIMUM_NUMBER_OF_TLS_CALLBACKS )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of TLS callbacks value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			if( tls_directory->number_of_callbacks >= maximum_number_of_entries )
+			{
+				maximum_number_of_entries += LIBEXE_TLS_CALLBACKS_READ_BUFFER_SIZE / 4;
+
+				reallocation = memory_reallocate(
+				                tls_directory->callback_addresses,
+				                sizeof( uint64_t ) * maximum_number_of_entries );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize callback addresses.",
+					 function );
+
+					goto on_error;
+				}
+				tls_directory->callback_addresses = (uint64_t *) reallocation;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: callback: %02d address\t\t: 0x%08" PRIx64 "\n",
+				 function,
+				 tls_directory->number_of_callbacks,
+				 callback_address );
+			}
+#endif
+			tls_directory->callback_addresses[ tls_directory->number_of_callbacks++ ] = callback_address;
+		}
+		/* A partial entry at the end of the file is ignored
+		 */
+		if( read_size < LIBEXE_TLS_CALLBACKS_READ_BUFFER_SIZE )
+		{
+			break;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( tls_directory->callback_addresses != NULL )
+	{
+		memory_free(
+		 tls_directory->callback_addresses );
+
+		tls_directory->callback_addresses = NULL;
+	}
+	tls_directory->number_of_callbacks = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of TLS callbacks
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tls_directory_get_number_of_callbacks(
+     libexe_tls_directory_t *tls_directory,
+     int *number_of_callbacks,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_tls_directory_get_number_of_callbacks";
+
+	if( tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_callbacks = tls_directory->number_of_callbacks;
+
+	return( 1 );
+}
+
+/* Retrieves the virtual address of a specific TLS callback
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tls_directory_get_callback_by_index(
+     libexe_tls_directory_t *tls_directory,
+     int callback_index,
+     uint64_t *virtual_address,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_tls_directory_get_callback_by_index";
+
+	if( tls_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid TLS directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( callback_index < 0 )
+	 || ( callback_index >= tls_directory->number_of_callbacks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid callback index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid virtual address.",
+		 function );
+
+		return( -1 );
+	}
+	*virtual_address = tls_directory->callback_addresses[ callback_index ];
+
+	return( 1 );
+}
+
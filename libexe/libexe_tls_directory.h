@@ -0,0 +1,111 @@
+/*
+ * Thread local storage (TLS) directory functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_TLS_DIRECTORY_H )
+#define _LIBEXE_TLS_DIRECTORY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_tls_directory libexe_tls_directory_t;
+
+struct libexe_tls_directory
+{
+	/* The raw data start address
+	 */
+	uint64_t raw_data_start_address;
+
+	/* The raw data end address
+	 */
+	uint64_t raw_data_end_address;
+
+	/* The index address
+	 */
+	uint64_t index_address;
+
+	/* The callbacks address
+	 */
+	uint64_t callbacks_address;
+
+	/* The size of zero fill
+	 */
+	uint32_t size_of_zero_fill;
+
+	/* The characteristics
+	 */
+	uint32_t characteristics;
+
+	/* The callback addresses
+	 * Contains VAs
+	 */
+	uint64_t *callback_addresses;
+
+	/* The number of callbacks
+	 */
+	int number_of_callbacks;
+};
+
+int libexe_tls_directory_initialize(
+     libexe_tls_directory_t **tls_directory,
+     libcerror_error_t **error );
+
+int libexe_tls_directory_free(
+     libexe_tls_directory_t **tls_directory,
+     libcerror_error_t **error );
+
+int libexe_tls_directory_read(
+     libexe_tls_directory_t *tls_directory,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint16_t coff_optional_header_signature,
+     libcerror_error_t **error );
+
+int libexe_tls_directory_read_callbacks(
+     libexe_tls_directory_t *tls_directory,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint16_t coff_optional_header_signature,
+     libcerror_error_t **error );
+
+int libexe_tls_directory_get_number_of_callbacks(
+     libexe_tls_directory_t *tls_directory,
+     int *number_of_callbacks,
+     libcerror_error_t **error );
+
+int libexe_tls_directory_get_callback_by_index(
+     libexe_tls_directory_t *tls_directory,
+     int callback_index,
+     uint64_t *virtual_address,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,475 @@
+/*
+ * Trend Micro locality sensitive hash (TLSH) functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+#include "libexe_tlsh.h"
+
+/* The Pearson hash permutation table
+ */
+const uint8_t libexe_tlsh_pearson_table[ 256 ] = {
+	  1,  87,  49,  12, 176, 178, 102, 166, 121, 193,   6,  84, 249, 230,  44, 163,
+	 14, 197, 213, 181, 161,  85, 218,  80,  64, 239,  24, 226, 236, 142,  38, 200,
+	110, 177, 104, 103, 141, 253, 255,  50,  77, 101,  81,  18,  45,  96,  31, 222,
+	 25, 107, 190,  70,  86, 237, 240,  34,  72, 242,  20, 214, 244, 227, 149, 235,
+	 97, 234,  57,  22,  60, 250,  82, 175, 208,   5, 127, 199, 111,  62, 135, 248,
+	174, 169, 211,  58,  66, 154, 106, 195, 245, 171,  17, 187, 182, 179,   0, 243,
+	132,  56, 148,  75, 128, 133, 158, 100, 130, 126,  91,  13, 153, 246, 216, 219,
+	119,  68, 223,  78,  83,  88, 201,  99, 122,  11,  92,  32, 136, 114,  52,  10,
+	138,  30,  48, 183, 156,  35,  61,  26, 143,  74, 251,  94, 129, 162,  63, 152,
+	170,   7, 115, 167, 241, 206,   3, 150,  55,  59, 151, 220,  90,  53,  23, 131,
+	125, 173,  15, 238,  79,  95,  89,  16, 105, 137, 225, 224, 217, 160,  37, 123,
+	118,  73,   2, 157,  46, 116,   9, 145, 134, 228, 207, 212, 202, 215,  69, 229,
+	 27, 188,  67, 124, 168, 252,  42,   4,  29, 108,  21, 247,  19, 205,  39, 203,
+	233,  40, 186, 147, 198, 192, 155,  33, 164, 191,  98, 204, 165, 180, 117,  76,
+	140,  36, 210, 172,  41,  54, 159,   8, 185, 232, 113, 196, 231,  47, 146, 120,
+	 51,  65,  28, 144, 254, 221,  93, 189, 194, 139, 112,  43,  71, 109, 184, 209
+};
+
+/* The hexadecimal characters used in the hash string
+ */
+const char libexe_tlsh_hexadecimal_characters[ 17 ] = \
+	"0123456789ABCDEF";
+
+/* Maps 3 byte values and a salt to a bucket using the Pearson hash
+ */
+#define libexe_tlsh_get_bucket( salt, byte_value1, byte_value2, byte_value3 ) \
+	libexe_tlsh_pearson_table[ libexe_tlsh_pearson_table[ libexe_tlsh_pearson_table[ libexe_tlsh_pearson_table[ salt ] ^ ( byte_value1 ) ] ^ ( byte_value2 ) ] ^ ( byte_value3 ) ]
+
+/* Creates a TLSH context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tlsh_initialize(
+     libexe_tlsh_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_tlsh_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            libexe_tlsh_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( libexe_tlsh_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a TLSH context
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tlsh_free(
+     libexe_tlsh_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_tlsh_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the TLSH context
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_tlsh_update(
+     libexe_tlsh_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_tlsh_update";
+	size_t buffer_offset  = 0;
+	uint8_t byte_value0   = 0;
+	uint8_t byte_value1   = 0;
+	uint8_t byte_value2   = 0;
+	uint8_t byte_value3   = 0;
+	uint8_t byte_value4   = 0;
+	uint8_t window_index  = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	window_index = (uint8_t) ( context->data_size % LIBEXE_TLSH_SLIDING_WINDOW_SIZE );
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		context->window[ window_index ] = buffer[ buffer_offset ];
+
+		/* The triplets are only counted once the sliding window is filled
+		 */
+		if( context->data_size >= ( LIBEXE_TLSH_SLIDING_WINDOW_SIZE - 1 ) )
+		{
+			byte_value0 = context->window[ window_index ];
+			byte_value1 = context->window[ ( window_index + 4 ) % LIBEXE_TLSH_SLIDING_WINDOW_SIZE ];
+			byte_value2 = context->window[ ( window_index + 3 ) % LIBEXE_TLSH_SLIDING_WINDOW_SIZE ];
+			byte_value3 = context->window[ ( window_index + 2 ) % LIBEXE_TLSH_SLIDING_WINDOW_SIZE ];
+			byte_value4 = context->window[ ( window_index + 1 ) % LIBEXE_TLSH_SLIDING_WINDOW_SIZE ];
+
+			context->checksum = libexe_tlsh_get_bucket( 0, byte_value0, byte_value1, context->checksum );
+
+			context->buckets[ libexe_tlsh_get_bucket( 2, byte_value0, byte_value1, byte_value2 ) ] += 1;
+			context->buckets[ libexe_tlsh_get_bucket( 3, byte_value0, byte_value1, byte_value3 ) ] += 1;
+			context->buckets[ libexe_tlsh_get_bucket( 5, byte_value0, byte_value2, byte_value3 ) ] += 1;
+			context->buckets[ libexe_tlsh_get_bucket( 7, byte_value0, byte_value2, byte_value4 ) ] += 1;
+			context->buckets[ libexe_tlsh_get_bucket( 11, byte_value0, byte_value1, byte_value4 ) ] += 1;
+			context->buckets[ libexe_tlsh_get_bucket( 13, byte_value0, byte_value3, byte_value4 ) ] += 1;
+		}
+		context->data_size += 1;
+
+		window_index += 1;
+
+		if( window_index >= LIBEXE_TLSH_SLIDING_WINDOW_SIZE )
+		{
+			window_index = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the natural logarithm of a non-zero value
+ * The value is scaled into the range [1, 2) and the natural logarithm of the remainder
+ * is approximated with the series ln(m) = 2 * atanh((m - 1) / (m + 1)), this avoids
+ * a dependency on the math library
+ */
+static double libexe_tlsh_log(
+               uint64_t value )
+{
+	double mantissa   = 0.0;
+	double series_sum = 0.0;
+	double term       = 0.0;
+	double z          = 0.0;
+	double z_squared  = 0.0;
+	int exponent      = 0;
+	int term_index    = 0;
+
+	mantissa = (double) value;
+
+	while( mantissa >= 2.0 )
+	{
+		mantissa /= 2.0;
+		exponent += 1;
+	}
+	z         = ( mantissa - 1.0 ) / ( mantissa + 1.0 );
+	z_squared = z * z;
+	term      = z;
+
+	for( term_index = 1;
+	     term_index < 40;
+	     term_index += 2 )
+	{
+		series_sum += term / (double) term_index;
+		term       *= z_squared;
+	}
+	/* ln(2) = 0.6931471805599453
+	 */
+	return( ( (double) exponent * 0.6931471805599453 ) + ( 2.0 * series_sum ) );
+}
+
+/* Finalizes the TLSH context and retrieves the hash string
+ * The string is formatted as the version "T1" followed by 70 hexadecimal characters
+ * The string size should be at least LIBEXE_TLSH_STRING_SIZE
+ * Returns 1 if successful, 0 if there is not enough data or variation in the data or -1 on error
+ */
+int libexe_tlsh_finalize(
+     libexe_tlsh_context_t *context,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	uint32_t sorted_buckets[ LIBEXE_TLSH_NUMBER_OF_BUCKETS ];
+	uint8_t code[ LIBEXE_TLSH_CODE_SIZE ];
+	uint8_t header[ 3 ];
+
+	static char *function      = "libexe_tlsh_finalize";
+	double length_logarithm    = 0.0;
+	size_t string_index        = 0;
+	uint32_t bucket_count      = 0;
+	uint32_t number_of_buckets = 0;
+	uint32_t quartile1         = 0;
+	uint32_t quartile2         = 0;
+	uint32_t quartile3         = 0;
+	int bucket_index           = 0;
+	int code_index             = 0;
+	int header_index           = 0;
+	int length_value           = 0;
+	int sort_index             = 0;
+	uint8_t code_value         = 0;
+	uint8_t quartile1_ratio    = 0;
+	uint8_t quartile2_ratio    = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < LIBEXE_TLSH_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->data_size < LIBEXE_TLSH_MINIMUM_DATA_SIZE )
+	{
+		return( 0 );
+	}
+	/* Determine the quartiles of the bucket counts
+	 */
+	for( bucket_index = 0;
+	     bucket_index < LIBEXE_TLSH_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		bucket_count = context->buckets[ bucket_index ];
+
+		if( bucket_count > 0 )
+		{
+			number_of_buckets++;
+		}
+		for( sort_index = bucket_index;
+		     sort_index > 0;
+		     sort_index-- )
+		{
+			if( sorted_buckets[ sort_index - 1 ] <= bucket_count )
+			{
+				break;
+			}
+			sorted_buckets[ sort_index ] = sorted_buckets[ sort_index - 1 ];
+		}
+		sorted_buckets[ sort_index ] = bucket_count;
+	}
+	quartile1 = sorted_buckets[ ( LIBEXE_TLSH_NUMBER_OF_BUCKETS / 4 ) - 1 ];
+	quartile2 = sorted_buckets[ ( LIBEXE_TLSH_NUMBER_OF_BUCKETS / 2 ) - 1 ];
+	quartile3 = sorted_buckets[ ( ( LIBEXE_TLSH_NUMBER_OF_BUCKETS * 3 ) / 4 ) - 1 ];
+
+	/* More than half of the buckets must be in use
+	 */
+	if( ( quartile3 == 0 )
+	 || ( number_of_buckets <= ( LIBEXE_TLSH_NUMBER_OF_BUCKETS / 2 ) ) )
+	{
+		return( 0 );
+	}
+	/* Every bucket is encoded in 2 bits relative to the quartiles
+	 */
+	for( code_index = 0;
+	     code_index < LIBEXE_TLSH_CODE_SIZE;
+	     code_index++ )
+	{
+		code_value = 0;
+
+		for( bucket_index = 0;
+		     bucket_index < 4;
+		     bucket_index++ )
+		{
+			bucket_count = context->buckets[ ( code_index * 4 ) + bucket_index ];
+
+			if( bucket_count > quartile3 )
+			{
+				code_value |= (uint8_t) ( 3 << ( bucket_index * 2 ) );
+			}
+			else if( bucket_count > quartile2 )
+			{
+				code_value |= (uint8_t) ( 2 << ( bucket_index * 2 ) );
+			}
+			else if( bucket_count > quartile1 )
+			{
+				code_value |= (uint8_t) ( 1 << ( bucket_index * 2 ) );
+			}
+		}
+		code[ code_index ] = code_value;
+	}
+	/* The length is encoded on a logarithmic scale
+	 */
+	length_logarithm = libexe_tlsh_log(
+	                    context->data_size );
+
+	if( context->data_size <= 656 )
+	{
+		length_value = (int) ( length_logarithm / 0.4054651 );
+	}
+	else if( context->data_size <= 3199 )
+	{
+		length_value = (int) ( ( length_logarithm / 0.26236426 ) - 8.72777 );
+	}
+	else
+	{
+		length_value = (int) ( ( length_logarithm / 0.095310180 ) - 62.5472 );
+	}
+	quartile1_ratio = (uint8_t) ( (uint32_t) ( (float) ( (uint64_t) quartile1 * 100 ) / (float) quartile3 ) % 16 );
+	quartile2_ratio = (uint8_t) ( (uint32_t) ( (float) ( (uint64_t) quartile2 * 100 ) / (float) quartile3 ) % 16 );
+
+	/* The header bytes are stored with their nibbles swapped
+	 */
+	header[ 0 ] = (uint8_t) ( ( context->checksum << 4 ) | ( context->checksum >> 4 ) );
+	header[ 1 ] = (uint8_t) ( ( ( length_value & 0x0f ) << 4 ) | ( ( length_value >> 4 ) & 0x0f ) );
+	header[ 2 ] = (uint8_t) ( ( quartile1_ratio << 4 ) | quartile2_ratio );
+
+	string[ string_index++ ] = 'T';
+	string[ string_index++ ] = '1';
+
+	for( header_index = 0;
+	     header_index < 3;
+	     header_index++ )
+	{
+		string[ string_index++ ] = libexe_tlsh_hexadecimal_characters[ header[ header_index ] >> 4 ];
+		string[ string_index++ ] = libexe_tlsh_hexadecimal_characters[ header[ header_index ] & 0x0f ];
+	}
+	/* The code is stored in reverse order
+	 */
+	for( code_index = LIBEXE_TLSH_CODE_SIZE - 1;
+	     code_index >= 0;
+	     code_index-- )
+	{
+		string[ string_index++ ] = libexe_tlsh_hexadecimal_characters[ code[ code_index ] >> 4 ];
+		string[ string_index++ ] = libexe_tlsh_hexadecimal_characters[ code[ code_index ] & 0x0f ];
+	}
+	string[ string_index ] = 0;
+
+	return( 1 );
+}
+
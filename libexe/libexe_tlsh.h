@@ -0,0 +1,81 @@
+/*
+ * Trend Micro locality sensitive hash (TLSH) functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_TLSH_H )
+#define _LIBEXE_TLSH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_tlsh_context libexe_tlsh_context_t;
+
+struct libexe_tlsh_context
+{
+	/* The bucket counts
+	 */
+	uint32_t buckets[ 256 ];
+
+	/* The data size
+	 */
+	uint64_t data_size;
+
+	/* The sliding window
+	 */
+	uint8_t window[ LIBEXE_TLSH_SLIDING_WINDOW_SIZE ];
+
+	/* The checksum
+	 */
+	uint8_t checksum;
+};
+
+int libexe_tlsh_initialize(
+     libexe_tlsh_context_t **context,
+     libcerror_error_t **error );
+
+int libexe_tlsh_free(
+     libexe_tlsh_context_t **context,
+     libcerror_error_t **error );
+
+int libexe_tlsh_update(
+     libexe_tlsh_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libexe_tlsh_finalize(
+     libexe_tlsh_context_t *context,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_TLSH_H ) */
+
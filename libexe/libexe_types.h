@@ -35,11 +35,17 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libexe_file {}		libexe_file_t;
+typedef struct libexe_parser {}		libexe_parser_t;
+typedef struct libexe_pattern_set {}	libexe_pattern_set_t;
 typedef struct libexe_section {}	libexe_section_t;
+typedef struct libexe_unwind_information {}	libexe_unwind_information_t;
 
 #else
 typedef intptr_t libexe_file_t;
+typedef intptr_t libexe_parser_t;
+typedef intptr_t libexe_pattern_set_t;
 typedef intptr_t libexe_section_t;
+typedef intptr_t libexe_unwind_information_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -0,0 +1,1271 @@
+/*
+ * Unwind information functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+#include "libexe_unwind_information.h"
+
+#include "exe_exception_table.h"
+#include "exe_unwind_information.h"
+
+/* Creates unwind information
+ * Make sure the value unwind_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_initialize(
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_initialize";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unwind_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwind information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = memory_allocate_structure(
+	                               libexe_internal_unwind_information_t );
+
+	if( internal_unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unwind information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_unwind_information,
+	     0,
+	     sizeof( libexe_internal_unwind_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear unwind information.",
+		 function );
+
+		goto on_error;
+	}
+	*unwind_information = (libexe_unwind_information_t *) internal_unwind_information;
+
+	return( 1 );
+
+on_error:
+	if( internal_unwind_information != NULL )
+	{
+		memory_free(
+		 internal_unwind_information );
+	}
+	return( -1 );
+}
+
+/* Frees unwind information
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_free(
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_free";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unwind_information != NULL )
+	{
+		internal_unwind_information = (libexe_internal_unwind_information_t *) *unwind_information;
+		*unwind_information         = NULL;
+
+		if( internal_unwind_information->operations != NULL )
+		{
+			memory_free(
+			 internal_unwind_information->operations );
+		}
+		memory_free(
+		 internal_unwind_information );
+	}
+	return( 1 );
+}
+
+/* Clones unwind information
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_clone(
+     libexe_unwind_information_t **destination_unwind_information,
+     libexe_unwind_information_t *source_unwind_information,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_destination_unwind_information = NULL;
+	libexe_internal_unwind_information_t *internal_source_unwind_information      = NULL;
+	static char *function                                                         = "libexe_unwind_information_clone";
+
+	if( destination_unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_unwind_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination unwind information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_unwind_information == NULL )
+	{
+		*destination_unwind_information = NULL;
+
+		return( 1 );
+	}
+	internal_source_unwind_information = (libexe_internal_unwind_information_t *) source_unwind_information;
+
+	internal_destination_unwind_information = memory_allocate_structure(
+	                                           libexe_internal_unwind_information_t );
+
+	if( internal_destination_unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination unwind information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_destination_unwind_information,
+	     internal_source_unwind_information,
+	     sizeof( libexe_internal_unwind_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination unwind information.",
+		 function );
+
+		memory_free(
+		 internal_destination_unwind_information );
+
+		return( -1 );
+	}
+	internal_destination_unwind_information->operations = NULL;
+
+	if( internal_source_unwind_information->operations != NULL )
+	{
+		internal_destination_unwind_information->operations = (libexe_unwind_operation_t *) memory_allocate(
+		                                                                                     sizeof( libexe_unwind_operation_t ) * internal_source_unwind_information->number_of_operations );
+
+		if( internal_destination_unwind_information->operations == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination operations.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_destination_unwind_information->operations,
+		     internal_source_unwind_information->operations,
+		     sizeof( libexe_unwind_operation_t ) * internal_source_unwind_information->number_of_operations ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination operations.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*destination_unwind_information = (libexe_unwind_information_t *) internal_destination_unwind_information;
+
+	return( 1 );
+
+on_error:
+	if( internal_destination_unwind_information != NULL )
+	{
+		if( internal_destination_unwind_information->operations != NULL )
+		{
+			memory_free(
+			 internal_destination_unwind_information->operations );
+		}
+		memory_free(
+		 internal_destination_unwind_information );
+	}
+	return( -1 );
+}
+
+/* Compares two unwind information locations by their file offset
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libexe_unwind_information_compare_locations(
+     const void *first_location,
+     const void *second_location )
+{
+	off64_t first_file_offset  = ( (libexe_unwind_information_location_t *) first_location )->file_offset;
+	off64_t second_file_offset = ( (libexe_unwind_information_location_t *) second_location )->file_offset;
+
+	if( first_file_offset < second_file_offset )
+	{
+		return( -1 );
+	}
+	else if( first_file_offset > second_file_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the unwind information
+ * This function supports the x64 (AMD64) unwind information format
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_read_data(
+     libexe_unwind_information_t *unwind_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	libexe_unwind_operation_t *operation                              = NULL;
+	const uint8_t *unwind_code_data                                   = NULL;
+	static char *function                                             = "libexe_unwind_information_read_data";
+	size_t data_offset                                                = 0;
+	size_t required_data_size                                         = 0;
+	uint16_t value_16bit                                              = 0;
+	uint8_t number_of_slots                                           = 0;
+	uint8_t unwind_code_index                                         = 0;
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( internal_unwind_information->operations != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwind information - operations value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( exe_unwind_information_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information->version                = ( (exe_unwind_information_header_t *) data )->version_and_flags & 0x07;
+	internal_unwind_information->flags                  = ( (exe_unwind_information_header_t *) data )->version_and_flags >> 3;
+	internal_unwind_information->prolog_size            = ( (exe_unwind_information_header_t *) data )->prolog_size;
+	internal_unwind_information->number_of_unwind_codes = ( (exe_unwind_information_header_t *) data )->number_of_unwind_codes;
+	internal_unwind_information->frame_register         = ( (exe_unwind_information_header_t *) data )->frame_register_and_offset & 0x0f;
+	internal_unwind_information->frame_offset           = (uint16_t) ( ( (exe_unwind_information_header_t *) data )->frame_register_and_offset >> 4 ) * 16;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: version\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 internal_unwind_information->version );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 internal_unwind_information->flags );
+
+		libcnotify_printf(
+		 "%s: prolog size\t\t\t: %" PRIu8 "\n",
+		 function,
+		 internal_unwind_information->prolog_size );
+
+		libcnotify_printf(
+		 "%s: number of unwind codes\t\t: %" PRIu8 "\n",
+		 function,
+		 internal_unwind_information->number_of_unwind_codes );
+
+		libcnotify_printf(
+		 "%s: frame register\t\t\t: %" PRIu8 "\n",
+		 function,
+		 internal_unwind_information->frame_register );
+
+		libcnotify_printf(
+		 "%s: frame offset\t\t\t: %" PRIu16 "\n",
+		 function,
+		 internal_unwind_information->frame_offset );
+	}
+#endif
+	if( ( internal_unwind_information->version != 1 )
+	 && ( internal_unwind_information->version != 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported version: %" PRIu8 ".",
+		 function,
+		 internal_unwind_information->version );
+
+		goto on_error;
+	}
+	/* The unwind codes array is padded to an even number of entries
+	 */
+	required_data_size = sizeof( exe_unwind_information_header_t )
+	                   + ( ( ( (size_t) internal_unwind_information->number_of_unwind_codes + 1 ) & ~( (size_t) 1 ) ) * sizeof( exe_unwind_code_t ) );
+
+	if( ( internal_unwind_information->flags & LIBEXE_UNWIND_INFORMATION_FLAG_CHAINED_INFORMATION ) != 0 )
+	{
+		required_data_size += sizeof( exe_exception_table_entry_t );
+	}
+	else if( ( internal_unwind_information->flags & ( LIBEXE_UNWIND_INFORMATION_FLAG_EXCEPTION_HANDLER | LIBEXE_UNWIND_INFORMATION_FLAG_TERMINATION_HANDLER ) ) != 0 )
+	{
+		required_data_size += 4;
+	}
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_unwind_information->number_of_unwind_codes > 0 )
+	{
+		internal_unwind_information->operations = (libexe_unwind_operation_t *) memory_allocate(
+		                                                                         sizeof( libexe_unwind_operation_t ) * internal_unwind_information->number_of_unwind_codes );
+
+		if( internal_unwind_information->operations == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create operations.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	unwind_code_data = &( data[ sizeof( exe_unwind_information_header_t ) ] );
+
+	while( unwind_code_index < internal_unwind_information->number_of_unwind_codes )
+	{
+		operation = &( internal_unwind_information->operations[ internal_unwind_information->number_of_operations ] );
+
+		operation->code_offset           = ( (exe_unwind_code_t *) unwind_code_data )->code_offset;
+		operation->operation_code        = ( (exe_unwind_code_t *) unwind_code_data )->operation_code_and_information & 0x0f;
+		operation->operation_information = ( (exe_unwind_code_t *) unwind_code_data )->operation_code_and_information >> 4;
+		operation->operand               = 0;
+
+		/* Some operations store their operand in the subsequent 1 or 2 unwind codes
+		 */
+		switch( operation->operation_code )
+		{
+			case LIBEXE_UNWIND_OPERATION_CODE_PUSH_NON_VOLATILE:
+			case LIBEXE_UNWIND_OPERATION_CODE_SET_FRAME_POINTER:
+			case LIBEXE_UNWIND_OPERATION_CODE_PUSH_MACHINE_FRAME:
+				number_of_slots = 1;
+				break;
+
+			case LIBEXE_UNWIND_OPERATION_CODE_ALLOCATE_SMALL:
+				number_of_slots    = 1;
+				operation->operand = ( (uint32_t) operation->operation_information * 8 ) + 8;
+				break;
+
+			case LIBEXE_UNWIND_OPERATION_CODE_ALLOCATE_LARGE:
+				if( operation->operation_information == 0 )
+				{
+					number_of_slots = 2;
+				}
+				else if( operation->operation_information == 1 )
+				{
+					number_of_slots = 3;
+				}
+				else
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported allocate large operation information: %" PRIu8 ".",
+					 function,
+					 operation->operation_information );
+
+					goto on_error;
+				}
+				break;
+
+			case LIBEXE_UNWIND_OPERATION_CODE_SAVE_NON_VOLATILE:
+			case LIBEXE_UNWIND_OPERATION_CODE_SAVE_XMM128:
+				number_of_slots = 2;
+				break;
+
+			/* In version 1 unwind information operation code 6 is used to save a XMM register
+			 */
+			case LIBEXE_UNWIND_OPERATION_CODE_EPILOG:
+				if( internal_unwind_information->version == 1 )
+				{
+					number_of_slots = 2;
+				}
+				else
+				{
+					number_of_slots = 1;
+				}
+				break;
+
+			case LIBEXE_UNWIND_OPERATION_CODE_SAVE_NON_VOLATILE_FAR:
+			case LIBEXE_UNWIND_OPERATION_CODE_SPARE:
+			case LIBEXE_UNWIND_OPERATION_CODE_SAVE_XMM128_FAR:
+				number_of_slots = 3;
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported operation code: %" PRIu8 ".",
+				 function,
+				 operation->operation_code );
+
+				goto on_error;
+		}
+		if( number_of_slots > ( internal_unwind_information->number_of_unwind_codes - unwind_code_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid operation: %d number of unwind codes value out of bounds.",
+			 function,
+			 internal_unwind_information->number_of_operations );
+
+			goto on_error;
+		}
+		if( number_of_slots == 2 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( unwind_code_data[ 2 ] ),
+			 value_16bit );
+
+			/* The operand is scaled by 16 for XMM registers and by 8 otherwise
+			 */
+			if( ( operation->operation_code == LIBEXE_UNWIND_OPERATION_CODE_SAVE_XMM128 )
+			 || ( operation->operation_code == LIBEXE_UNWIND_OPERATION_CODE_EPILOG ) )
+			{
+				operation->operand = (uint32_t) value_16bit * 16;
+			}
+			else
+			{
+				operation->operand = (uint32_t) value_16bit * 8;
+			}
+		}
+		else if( number_of_slots == 3 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( unwind_code_data[ 2 ] ),
+			 operation->operand );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: operation: %02d code offset\t\t: %" PRIu8 "\n",
+			 function,
+			 internal_unwind_information->number_of_operations,
+			 operation->code_offset );
+
+			libcnotify_printf(
+			 "%s: operation: %02d operation code\t: %" PRIu8 "\n",
+			 function,
+			 internal_unwind_information->number_of_operations,
+			 operation->operation_code );
+
+			libcnotify_printf(
+			 "%s: operation: %02d operation information\t: %" PRIu8 "\n",
+			 function,
+			 internal_unwind_information->number_of_operations,
+			 operation->operation_information );
+
+			libcnotify_printf(
+			 "%s: operation: %02d operand\t\t: %" PRIu32 "\n",
+			 function,
+			 internal_unwind_information->number_of_operations,
+			 operation->operand );
+		}
+#endif
+		unwind_code_data  += number_of_slots * sizeof( exe_unwind_code_t );
+		unwind_code_index += number_of_slots;
+
+		internal_unwind_information->number_of_operations += 1;
+	}
+	data_offset = sizeof( exe_unwind_information_header_t )
+	            + ( ( ( (size_t) internal_unwind_information->number_of_unwind_codes + 1 ) & ~( (size_t) 1 ) ) * sizeof( exe_unwind_code_t ) );
+
+	if( ( internal_unwind_information->flags & LIBEXE_UNWIND_INFORMATION_FLAG_CHAINED_INFORMATION ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_exception_table_entry_t *) &( data[ data_offset ] ) )->begin_address,
+		 internal_unwind_information->chained_runtime_function.begin_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_exception_table_entry_t *) &( data[ data_offset ] ) )->end_address,
+		 internal_unwind_information->chained_runtime_function.end_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_exception_table_entry_t *) &( data[ data_offset ] ) )->unwind_information_address,
+		 internal_unwind_information->chained_runtime_function.unwind_information_address );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: chained begin address\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 internal_unwind_information->chained_runtime_function.begin_address );
+
+			libcnotify_printf(
+			 "%s: chained end address\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 internal_unwind_information->chained_runtime_function.end_address );
+
+			libcnotify_printf(
+			 "%s: chained unwind information address\t: 0x%08" PRIx32 "\n",
+			 function,
+			 internal_unwind_information->chained_runtime_function.unwind_information_address );
+		}
+#endif
+	}
+	else if( ( internal_unwind_information->flags & ( LIBEXE_UNWIND_INFORMATION_FLAG_EXCEPTION_HANDLER | LIBEXE_UNWIND_INFORMATION_FLAG_TERMINATION_HANDLER ) ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 internal_unwind_information->exception_handler_address );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: exception handler address\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 internal_unwind_information->exception_handler_address );
+		}
+#endif
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_unwind_information->operations != NULL )
+	{
+		memory_free(
+		 internal_unwind_information->operations );
+
+		internal_unwind_information->operations = NULL;
+	}
+	internal_unwind_information->number_of_operations = 0;
+
+	return( -1 );
+}
+
+/* Reads the unwind information
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_read_file_io_handle(
+     libexe_unwind_information_t *unwind_information,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBEXE_MAXIMUM_UNWIND_INFORMATION_SIZE ];
+
+	static char *function = "libexe_unwind_information_read_file_io_handle";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	uint8_t flags         = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading unwind information at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek unwind information offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              sizeof( exe_unwind_information_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) sizeof( exe_unwind_information_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read unwind information header.",
+		 function );
+
+		return( -1 );
+	}
+	flags = ( (exe_unwind_information_header_t *) data )->version_and_flags >> 3;
+
+	/* Only read the trailing data that is needed to prevent reading beyond the end of the file
+	 */
+	read_size = ( ( (size_t) ( (exe_unwind_information_header_t *) data )->number_of_unwind_codes + 1 ) & ~( (size_t) 1 ) ) * sizeof( exe_unwind_code_t );
+
+	if( ( flags & LIBEXE_UNWIND_INFORMATION_FLAG_CHAINED_INFORMATION ) != 0 )
+	{
+		read_size += sizeof( exe_exception_table_entry_t );
+	}
+	else if( ( flags & ( LIBEXE_UNWIND_INFORMATION_FLAG_EXCEPTION_HANDLER | LIBEXE_UNWIND_INFORMATION_FLAG_TERMINATION_HANDLER ) ) != 0 )
+	{
+		read_size += 4;
+	}
+	if( read_size > 0 )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( data[ sizeof( exe_unwind_information_header_t ) ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unwind information.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libexe_unwind_information_read_data(
+	     unwind_information,
+	     data,
+	     sizeof( exe_unwind_information_header_t ) + read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the version
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_get_version(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *version,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_version";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version.",
+		 function );
+
+		return( -1 );
+	}
+	*version = internal_unwind_information->version;
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_get_flags(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_flags";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = internal_unwind_information->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the prolog size
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_get_prolog_size(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *prolog_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_prolog_size";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( prolog_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prolog size.",
+		 function );
+
+		return( -1 );
+	}
+	*prolog_size = internal_unwind_information->prolog_size;
+
+	return( 1 );
+}
+
+/* Retrieves the frame register and the frame offset in bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_get_frame_register(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *frame_register,
+     uint16_t *frame_offset,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_frame_register";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( frame_register == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame register.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame offset.",
+		 function );
+
+		return( -1 );
+	}
+	*frame_register = internal_unwind_information->frame_register;
+	*frame_offset   = internal_unwind_information->frame_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of unwind codes
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_get_number_of_unwind_codes(
+     libexe_unwind_information_t *unwind_information,
+     int *number_of_unwind_codes,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_number_of_unwind_codes";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( number_of_unwind_codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of unwind codes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_unwind_codes = (int) internal_unwind_information->number_of_unwind_codes;
+
+	return( 1 );
+}
+
+/* Retrieves the number of unwind operations
+ * An operation consists of 1 to 3 unwind codes
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_get_number_of_operations(
+     libexe_unwind_information_t *unwind_information,
+     int *number_of_operations,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_number_of_operations";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( number_of_operations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of operations.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_operations = internal_unwind_information->number_of_operations;
+
+	return( 1 );
+}
+
+/* Retrieves a specific unwind operation
+ * The operand contains the allocation size or stack offset in bytes, otherwise 0
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_unwind_information_get_operation(
+     libexe_unwind_information_t *unwind_information,
+     int operation_index,
+     uint8_t *code_offset,
+     uint8_t *operation_code,
+     uint8_t *operation_information,
+     uint32_t *operand,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	libexe_unwind_operation_t *operation                              = NULL;
+	static char *function                                             = "libexe_unwind_information_get_operation";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( ( operation_index < 0 )
+	 || ( operation_index >= internal_unwind_information->number_of_operations ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid operation index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( operation_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid operation code.",
+		 function );
+
+		return( -1 );
+	}
+	if( operation_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid operation information.",
+		 function );
+
+		return( -1 );
+	}
+	if( operand == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid operand.",
+		 function );
+
+		return( -1 );
+	}
+	operation = &( internal_unwind_information->operations[ operation_index ] );
+
+	*code_offset           = operation->code_offset;
+	*operation_code        = operation->operation_code;
+	*operation_information = operation->operation_information;
+	*operand               = operation->operand;
+
+	return( 1 );
+}
+
+/* Retrieves the exception handler address
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_unwind_information_get_exception_handler_address(
+     libexe_unwind_information_t *unwind_information,
+     uint32_t *exception_handler_address,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_exception_handler_address";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( exception_handler_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception handler address.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_unwind_information->flags & LIBEXE_UNWIND_INFORMATION_FLAG_CHAINED_INFORMATION ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_unwind_information->flags & ( LIBEXE_UNWIND_INFORMATION_FLAG_EXCEPTION_HANDLER | LIBEXE_UNWIND_INFORMATION_FLAG_TERMINATION_HANDLER ) ) == 0 )
+	{
+		return( 0 );
+	}
+	*exception_handler_address = internal_unwind_information->exception_handler_address;
+
+	return( 1 );
+}
+
+/* Retrieves the chained function
+ * The chained function contains the primary unwind information of a function that is split into multiple parts
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_unwind_information_get_chained_function(
+     libexe_unwind_information_t *unwind_information,
+     uint32_t *begin_address,
+     uint32_t *end_address,
+     uint32_t *unwind_information_address,
+     libcerror_error_t **error )
+{
+	libexe_internal_unwind_information_t *internal_unwind_information = NULL;
+	static char *function                                             = "libexe_unwind_information_get_chained_function";
+
+	if( unwind_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_unwind_information = (libexe_internal_unwind_information_t *) unwind_information;
+
+	if( begin_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid begin address.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end address.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_information_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information address.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_unwind_information->flags & LIBEXE_UNWIND_INFORMATION_FLAG_CHAINED_INFORMATION ) == 0 )
+	{
+		return( 0 );
+	}
+	*begin_address              = internal_unwind_information->chained_runtime_function.begin_address;
+	*end_address                = internal_unwind_information->chained_runtime_function.end_address;
+	*unwind_information_address = internal_unwind_information->chained_runtime_function.unwind_information_address;
+
+	return( 1 );
+}
+
@@ -0,0 +1,215 @@
+/*
+ * Unwind information functions
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_UNWIND_INFORMATION_H )
+#define _LIBEXE_UNWIND_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_exception_table.h"
+#include "libexe_extern.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_unwind_operation libexe_unwind_operation_t;
+
+struct libexe_unwind_operation
+{
+	/* The code offset
+	 */
+	uint8_t code_offset;
+
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The operation information
+	 */
+	uint8_t operation_information;
+
+	/* The operand
+	 * Contains the allocation size or stack offset in bytes, otherwise 0
+	 */
+	uint32_t operand;
+};
+
+typedef struct libexe_internal_unwind_information libexe_internal_unwind_information_t;
+
+struct libexe_internal_unwind_information
+{
+	/* The version
+	 */
+	uint8_t version;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The prolog size
+	 */
+	uint8_t prolog_size;
+
+	/* The number of unwind codes
+	 */
+	uint8_t number_of_unwind_codes;
+
+	/* The frame register
+	 */
+	uint8_t frame_register;
+
+	/* The frame offset in bytes
+	 */
+	uint16_t frame_offset;
+
+	/* The unwind operations
+	 */
+	libexe_unwind_operation_t *operations;
+
+	/* The number of unwind operations
+	 * An operation can consist of multiple unwind codes
+	 */
+	int number_of_operations;
+
+	/* The exception handler address
+	 */
+	uint32_t exception_handler_address;
+
+	/* The chained runtime function
+	 */
+	libexe_runtime_function_t chained_runtime_function;
+};
+
+typedef struct libexe_unwind_information_location libexe_unwind_information_location_t;
+
+struct libexe_unwind_information_location
+{
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The runtime function index
+	 */
+	int runtime_function_index;
+};
+
+int libexe_unwind_information_initialize(
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_free(
+     libexe_unwind_information_t **unwind_information,
+     libcerror_error_t **error );
+
+int libexe_unwind_information_clone(
+     libexe_unwind_information_t **destination_unwind_information,
+     libexe_unwind_information_t *source_unwind_information,
+     libcerror_error_t **error );
+
+int libexe_unwind_information_compare_locations(
+     const void *first_location,
+     const void *second_location );
+
+int libexe_unwind_information_read_data(
+     libexe_unwind_information_t *unwind_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libexe_unwind_information_read_file_io_handle(
+     libexe_unwind_information_t *unwind_information,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_version(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *version,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_flags(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_prolog_size(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *prolog_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_frame_register(
+     libexe_unwind_information_t *unwind_information,
+     uint8_t *frame_register,
+     uint16_t *frame_offset,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_number_of_unwind_codes(
+     libexe_unwind_information_t *unwind_information,
+     int *number_of_unwind_codes,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_number_of_operations(
+     libexe_unwind_information_t *unwind_information,
+     int *number_of_operations,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_operation(
+     libexe_unwind_information_t *unwind_information,
+     int operation_index,
+     uint8_t *code_offset,
+     uint8_t *operation_code,
+     uint8_t *operation_information,
+     uint32_t *operand,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_exception_handler_address(
+     libexe_unwind_information_t *unwind_information,
+     uint32_t *exception_handler_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_unwind_information_get_chained_function(
+     libexe_unwind_information_t *unwind_information,
+     uint32_t *begin_address,
+     uint32_t *end_address,
+     uint32_t *unwind_information_address,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,813 @@
+/*
+ * Library access pattern functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+/* The name of the file the test fixture is written to
+ */
+const char *exe_test_access_pattern_filename = "exe_test_access_pattern.exe";
+
+/* Tests the libexe_file_open function with an access pattern set before the file is opened
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_access_pattern(
+     void )
+{
+	uint8_t buffer[ 16 ];
+	libcerror_error_t *error  = NULL;
+	libexe_file_t *file       = NULL;
+	libexe_section_t *section = NULL;
+	off64_t start_offset      = 0;
+	ssize_t read_count        = 0;
+	uint32_t checksum         = 0;
+	int access_pattern        = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = exe_test_write_fixture_file(
+	           exe_test_access_pattern_filename,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_initialize(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a file that is read from a descriptor held by the library
+	 */
+	result = libexe_file_set_access_pattern(
+	           file,
+	           LIBEXE_ACCESS_PATTERN_ONE_SHOT,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_open(
+	           file,
+	           exe_test_access_pattern_filename,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_compute_checksum(
+	           file,
+	           &checksum,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x0000a887UL );
+
+	result = libexe_file_set_section_access_pattern(
+	           file,
+	           0,
+	           LIBEXE_ACCESS_PATTERN_ONE_SHOT,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_section(
+	           file,
+	           0,
+	           &section,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_start_offset(
+	           section,
+	           &start_offset,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libexe_section_read_buffer_at_offset(
+	               section,
+	               buffer,
+	               16,
+	               0x81,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           buffer,
+	           &( exe_test_fixture_data[ start_offset + 0x81 ] ),
+	           16 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_section_free(
+	           &section,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the access pattern can be changed after the file was opened
+	 */
+	result = libexe_file_set_access_pattern(
+	           file,
+	           LIBEXE_ACCESS_PATTERN_RANDOM,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a file that is read using a libbfio file
+	 */
+	result = libexe_file_set_access_pattern(
+	           file,
+	           LIBEXE_ACCESS_PATTERN_NORMAL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_open(
+	           file,
+	           exe_test_access_pattern_filename,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Setting an access pattern after the file was opened only affects the size of the reads
+	 */
+	result = libexe_file_set_access_pattern(
+	           file,
+	           LIBEXE_ACCESS_PATTERN_SEQUENTIAL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_access_pattern(
+	           file,
+	           &access_pattern,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBEXE_ACCESS_PATTERN_SEQUENTIAL );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	checksum = 0;
+
+	result = libexe_file_compute_checksum(
+	           file,
+	           &checksum,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x0000a887UL );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_free(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_remove_fixture_file(
+	           exe_test_access_pattern_filename,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_access_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_access_pattern(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int access_pattern       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_access_pattern(
+	           file,
+	           &access_pattern,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBEXE_ACCESS_PATTERN_NORMAL );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_access_pattern(
+	           NULL,
+	           &access_pattern,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_access_pattern(
+	           file,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_set_access_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_set_access_pattern(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int access_pattern       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_set_access_pattern(
+	           file,
+	           LIBEXE_ACCESS_PATTERN_SEQUENTIAL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_access_pattern(
+	           file,
+	           &access_pattern,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBEXE_ACCESS_PATTERN_SEQUENTIAL );
+
+	result = libexe_file_set_access_pattern(
+	           file,
+	           LIBEXE_ACCESS_PATTERN_NORMAL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_set_access_pattern(
+	           NULL,
+	           LIBEXE_ACCESS_PATTERN_SEQUENTIAL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_set_access_pattern(
+	           file,
+	           -1,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_set_access_pattern(
+	           file,
+	           7,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_set_section_access_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_set_section_access_pattern(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_set_section_access_pattern(
+	           file,
+	           1,
+	           LIBEXE_ACCESS_PATTERN_ONE_SHOT,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the access pattern of a section can be reset
+	 */
+	result = libexe_file_set_section_access_pattern(
+	           file,
+	           1,
+	           LIBEXE_ACCESS_PATTERN_NORMAL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_set_section_access_pattern(
+	           NULL,
+	           1,
+	           LIBEXE_ACCESS_PATTERN_ONE_SHOT,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_set_section_access_pattern(
+	           file,
+	           -1,
+	           LIBEXE_ACCESS_PATTERN_ONE_SHOT,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_set_section_access_pattern(
+	           file,
+	           99,
+	           LIBEXE_ACCESS_PATTERN_ONE_SHOT,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_set_section_access_pattern(
+	           file,
+	           1,
+	           7,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EXE_TEST_RUN(
+	 "libexe_file_open",
+	 exe_test_file_open_access_pattern );
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_access_pattern",
+	 exe_test_file_get_access_pattern,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_set_access_pattern",
+	 exe_test_file_set_access_pattern,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_set_section_access_pattern",
+	 exe_test_file_set_section_access_pattern,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,282 @@
+/*
+ * Library Authenticode functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+uint8_t exe_test_authenticode_sha1_hash[ 20 ] = {
+	0xbc, 0x30, 0x13, 0x10, 0xf8, 0x2e, 0xce, 0x82, 0x10, 0x06, 0x42, 0xbb, 0x9f, 0xce, 0x6f, 0x2a,
+	0x92, 0x6a, 0x8c, 0xc9 };
+
+uint8_t exe_test_authenticode_sha256_hash[ 32 ] = {
+	0x86, 0x1f, 0x3c, 0xd7, 0x65, 0x17, 0xbf, 0x8b, 0xb5, 0xa8, 0x09, 0xb1, 0x62, 0x08, 0x1b, 0x77,
+	0x40, 0x23, 0x3c, 0x4d, 0xc3, 0x7c, 0xdb, 0x6f, 0x95, 0x79, 0xab, 0x97, 0x96, 0x76, 0xbb, 0x5d };
+
+/* Tests the libexe_file_compute_authenticode_digests function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_compute_authenticode_digests(
+     libexe_file_t *file )
+{
+	uint8_t sha1_hash[ 20 ];
+	uint8_t sha256_hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_compute_authenticode_digests(
+	           file,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           sha1_hash,
+	           exe_test_authenticode_sha1_hash,
+	           20 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	           sha256_hash,
+	           exe_test_authenticode_sha256_hash,
+	           32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_compute_authenticode_digests(
+	           NULL,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_compute_authenticode_digests(
+	           file,
+	           NULL,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_compute_authenticode_digests(
+	           file,
+	           sha1_hash,
+	           19,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_compute_authenticode_digests(
+	           file,
+	           sha1_hash,
+	           20,
+	           NULL,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_compute_authenticode_digests(
+	           file,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           31,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_compute_authenticode_digests",
+	 exe_test_file_compute_authenticode_digests,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,470 @@
+/*
+ * Library batch functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+/* The name of the file the test fixture is written to
+ */
+const char *exe_test_batch_filename = "exe_test_batch.exe";
+
+typedef struct exe_test_batch_files exe_test_batch_files_t;
+
+/* The files passed to the file callback
+ */
+struct exe_test_batch_files
+{
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The maximum number of files, after which the file callback stops the batch
+	 */
+	int maximum_number_of_files;
+
+	/* The file indexes
+	 */
+	int file_indexes[ 3 ];
+
+	/* Values to indicate a file was opened
+	 */
+	uint8_t is_opened[ 3 ];
+
+	/* The checksums
+	 */
+	uint32_t checksums[ 3 ];
+};
+
+/* Stores a file passed by the batch
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int exe_test_file_callback(
+     int file_index,
+     libexe_file_t *file,
+     void *callback_data )
+{
+	exe_test_batch_files_t *files = NULL;
+	int index                     = 0;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	files = (exe_test_batch_files_t *) callback_data;
+
+	if( files->number_of_files >= 3 )
+	{
+		return( -1 );
+	}
+	index = files->number_of_files;
+
+	files->file_indexes[ index ] = file_index;
+
+	if( file != NULL )
+	{
+		if( libexe_file_compute_checksum(
+		     file,
+		     &( files->checksums[ index ] ),
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		files->is_opened[ index ] = 1;
+	}
+	files->number_of_files += 1;
+
+	if( files->number_of_files == files->maximum_number_of_files )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libexe_batch_open_threaded function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_batch_open_threaded(
+     void )
+{
+	const char *filenames[ 3 ];
+	exe_test_batch_files_t files;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	filenames[ 0 ] = exe_test_batch_filename;
+	filenames[ 1 ] = "exe_test_batch_nonexistent.exe";
+	filenames[ 2 ] = exe_test_batch_filename;
+
+	result = exe_test_write_fixture_file(
+	           exe_test_batch_filename,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &files,
+	     0,
+	     sizeof( exe_test_batch_files_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_batch_open_threaded(
+	           filenames,
+	           3,
+	           1,
+	           LIBEXE_OPEN_READ,
+	           &exe_test_file_callback,
+	           &files,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 files.number_of_files,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 0 ]",
+	 files.file_indexes[ 0 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_opened[ 0 ]",
+	 files.is_opened[ 0 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksums[ 0 ]",
+	 files.checksums[ 0 ],
+	 (uint32_t) 0x0000a887UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 1 ]",
+	 files.file_indexes[ 1 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_opened[ 1 ]",
+	 files.is_opened[ 1 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 2 ]",
+	 files.file_indexes[ 2 ],
+	 2 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_opened[ 2 ]",
+	 files.is_opened[ 2 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksums[ 2 ]",
+	 files.checksums[ 2 ],
+	 (uint32_t) 0x0000a887UL );
+
+	/* Test if the files are passed in order of file index by multiple threads
+	 */
+	if( memory_set(
+	     &files,
+	     0,
+	     sizeof( exe_test_batch_files_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_batch_open_threaded(
+	           filenames,
+	           3,
+	           2,
+	           LIBEXE_OPEN_READ,
+	           &exe_test_file_callback,
+	           &files,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 files.number_of_files,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 0 ]",
+	 files.file_indexes[ 0 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_opened[ 0 ]",
+	 files.is_opened[ 0 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksums[ 0 ]",
+	 files.checksums[ 0 ],
+	 (uint32_t) 0x0000a887UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 1 ]",
+	 files.file_indexes[ 1 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_opened[ 1 ]",
+	 files.is_opened[ 1 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 2 ]",
+	 files.file_indexes[ 2 ],
+	 2 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_opened[ 2 ]",
+	 files.is_opened[ 2 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksums[ 2 ]",
+	 files.checksums[ 2 ],
+	 (uint32_t) 0x0000a887UL );
+
+	/* Test if the file callback can stop the batch
+	 */
+	if( memory_set(
+	     &files,
+	     0,
+	     sizeof( exe_test_batch_files_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	files.maximum_number_of_files = 1;
+
+	result = libexe_batch_open_threaded(
+	           filenames,
+	           3,
+	           2,
+	           LIBEXE_OPEN_READ,
+	           &exe_test_file_callback,
+	           &files,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 files.number_of_files,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 0 ]",
+	 files.file_indexes[ 0 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_opened[ 0 ]",
+	 files.is_opened[ 0 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksums[ 0 ]",
+	 files.checksums[ 0 ],
+	 (uint32_t) 0x0000a887UL );
+
+	/* Test error cases
+	 */
+	result = libexe_batch_open_threaded(
+	           NULL,
+	           3,
+	           1,
+	           LIBEXE_OPEN_READ,
+	           &exe_test_file_callback,
+	           &files,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_open_threaded(
+	           filenames,
+	           -1,
+	           1,
+	           LIBEXE_OPEN_READ,
+	           &exe_test_file_callback,
+	           &files,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_open_threaded(
+	           filenames,
+	           3,
+	           1,
+	           LIBEXE_OPEN_READ,
+	           NULL,
+	           &files,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if an error of the file callback is passed on
+	 */
+	result = libexe_batch_open_threaded(
+	           filenames,
+	           3,
+	           1,
+	           LIBEXE_OPEN_READ,
+	           &exe_test_file_callback,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = exe_test_remove_fixture_file(
+	           exe_test_batch_filename,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EXE_TEST_RUN(
+	 "libexe_batch_open_threaded",
+	 exe_test_batch_open_threaded );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
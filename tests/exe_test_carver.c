@@ -0,0 +1,634 @@
+/*
+ * Library carver functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+#define EXE_TEST_CARVER_BUFFER_SIZE	0x4000
+
+/* The name of the file the test fixture is written to
+ */
+const char *exe_test_carver_filename = "exe_test_carver.exe";
+
+typedef struct exe_test_images exe_test_images_t;
+
+/* The images passed to the image callback
+ */
+struct exe_test_images
+{
+	/* The number of images
+	 */
+	int number_of_images;
+
+	/* The maximum number of images, after which the image callback stops the carving
+	 */
+	int maximum_number_of_images;
+
+	/* The image offsets
+	 */
+	off64_t image_offsets[ 4 ];
+
+	/* The image sizes
+	 */
+	size64_t image_sizes[ 4 ];
+
+	/* The target architecture types
+	 */
+	uint16_t target_architecture_types[ 4 ];
+
+	/* The characteristic flags
+	 */
+	uint16_t characteristic_flags[ 4 ];
+};
+
+/* Stores an image passed by the carver
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int exe_test_image_callback(
+     off64_t image_offset,
+     size64_t image_size,
+     uint16_t target_architecture_type,
+     uint16_t characteristic_flags,
+     void *callback_data )
+{
+	exe_test_images_t *images = NULL;
+	int image_index           = 0;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	images = (exe_test_images_t *) callback_data;
+
+	if( images->number_of_images >= 4 )
+	{
+		return( -1 );
+	}
+	image_index = images->number_of_images;
+
+	images->image_offsets[ image_index ]             = image_offset;
+	images->image_sizes[ image_index ]               = image_size;
+	images->target_architecture_types[ image_index ] = target_architecture_type;
+	images->characteristic_flags[ image_index ]      = characteristic_flags;
+
+	images->number_of_images += 1;
+
+	if( images->number_of_images == images->maximum_number_of_images )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Fills a buffer with the test fixture at offset 0x1000 and a copy of only its headers at offset 0x2400
+ * where the remainder of the buffer is filled with 0x90 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_carver_fill_buffer(
+     uint8_t *buffer )
+{
+	if( memory_set(
+	     buffer,
+	     0x90,
+	     EXE_TEST_CARVER_BUFFER_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( buffer[ 0x1000 ] ),
+	     exe_test_fixture_data,
+	     EXE_TEST_FIXTURE_DATA_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( buffer[ 0x2400 ] ),
+	     exe_test_fixture_data,
+	     0x200 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libexe_carve_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_carve_buffer(
+     void )
+{
+	exe_test_images_t images;
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	          sizeof( uint8_t ) * EXE_TEST_CARVER_BUFFER_SIZE );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = exe_test_carver_fill_buffer(
+	           buffer );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( memory_set(
+	     &images,
+	     0,
+	     sizeof( exe_test_images_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_carve_buffer(
+	           buffer,
+	           EXE_TEST_CARVER_BUFFER_SIZE,
+	           1,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_images",
+	 images.number_of_images,
+	 2 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_offsets[ 0 ]",
+	 (uint64_t) images.image_offsets[ 0 ],
+	 (uint64_t) 0x00001000UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_sizes[ 0 ]",
+	 (uint64_t) images.image_sizes[ 0 ],
+	 (uint64_t) 0x00000820UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "target_architecture_types[ 0 ]",
+	 images.target_architecture_types[ 0 ],
+	 0x8664 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "characteristic_flags[ 0 ]",
+	 images.characteristic_flags[ 0 ],
+	 0x0022 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_offsets[ 1 ]",
+	 (uint64_t) images.image_offsets[ 1 ],
+	 (uint64_t) 0x00002400UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_sizes[ 1 ]",
+	 (uint64_t) images.image_sizes[ 1 ],
+	 (uint64_t) 0x00000820UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "target_architecture_types[ 1 ]",
+	 images.target_architecture_types[ 1 ],
+	 0x8664 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "characteristic_flags[ 1 ]",
+	 images.characteristic_flags[ 1 ],
+	 0x0022 );
+
+	/* Test if the result does not depend on the number of threads
+	 */
+	if( memory_set(
+	     &images,
+	     0,
+	     sizeof( exe_test_images_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_carve_buffer(
+	           buffer,
+	           EXE_TEST_CARVER_BUFFER_SIZE,
+	           3,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_images",
+	 images.number_of_images,
+	 2 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_offsets[ 0 ]",
+	 (uint64_t) images.image_offsets[ 0 ],
+	 (uint64_t) 0x00001000UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_sizes[ 0 ]",
+	 (uint64_t) images.image_sizes[ 0 ],
+	 (uint64_t) 0x00000820UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "target_architecture_types[ 0 ]",
+	 images.target_architecture_types[ 0 ],
+	 0x8664 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "characteristic_flags[ 0 ]",
+	 images.characteristic_flags[ 0 ],
+	 0x0022 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_offsets[ 1 ]",
+	 (uint64_t) images.image_offsets[ 1 ],
+	 (uint64_t) 0x00002400UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_sizes[ 1 ]",
+	 (uint64_t) images.image_sizes[ 1 ],
+	 (uint64_t) 0x00000820UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "target_architecture_types[ 1 ]",
+	 images.target_architecture_types[ 1 ],
+	 0x8664 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "characteristic_flags[ 1 ]",
+	 images.characteristic_flags[ 1 ],
+	 0x0022 );
+
+	/* Test if the image callback can stop the carving
+	 */
+	if( memory_set(
+	     &images,
+	     0,
+	     sizeof( exe_test_images_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	images.maximum_number_of_images = 1;
+
+	result = libexe_carve_buffer(
+	           buffer,
+	           EXE_TEST_CARVER_BUFFER_SIZE,
+	           1,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_images",
+	 images.number_of_images,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_carve_buffer(
+	           NULL,
+	           EXE_TEST_CARVER_BUFFER_SIZE,
+	           1,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_carve_buffer(
+	           buffer,
+	           (size_t) SSIZE_MAX + 1,
+	           1,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_carve_buffer(
+	           buffer,
+	           EXE_TEST_CARVER_BUFFER_SIZE,
+	           1,
+	           NULL,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if an error of the image callback is passed on
+	 */
+	result = libexe_carve_buffer(
+	           buffer,
+	           EXE_TEST_CARVER_BUFFER_SIZE,
+	           1,
+	           &exe_test_image_callback,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_carve_file function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_carve_file(
+     void )
+{
+	exe_test_images_t images;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = exe_test_write_fixture_file(
+	           exe_test_carver_filename,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &images,
+	     0,
+	     sizeof( exe_test_images_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_carve_file(
+	           exe_test_carver_filename,
+	           1,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_images",
+	 images.number_of_images,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_offsets[ 0 ]",
+	 (uint64_t) images.image_offsets[ 0 ],
+	 (uint64_t) 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "image_sizes[ 0 ]",
+	 (uint64_t) images.image_sizes[ 0 ],
+	 (uint64_t) 0x00000820UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "target_architecture_types[ 0 ]",
+	 images.target_architecture_types[ 0 ],
+	 0x8664 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "characteristic_flags[ 0 ]",
+	 images.characteristic_flags[ 0 ],
+	 0x0022 );
+
+	/* Test error cases
+	 */
+	result = libexe_carve_file(
+	           NULL,
+	           1,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_carve_file(
+	           exe_test_carver_filename,
+	           1,
+	           NULL,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = exe_test_remove_fixture_file(
+	           exe_test_carver_filename,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test carving a file that does not exist
+	 */
+	result = libexe_carve_file(
+	           exe_test_carver_filename,
+	           1,
+	           &exe_test_image_callback,
+	           &images,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EXE_TEST_RUN(
+	 "libexe_carve_buffer",
+	 exe_test_carve_buffer );
+
+	EXE_TEST_RUN(
+	 "libexe_carve_file",
+	 exe_test_carve_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,571 @@
+/*
+ * Library certificate table functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+uint8_t exe_test_certificate_data[ 24 ] = {
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+	0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47 };
+
+/* Tests the libexe_file_get_number_of_certificates function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_number_of_certificates(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	int number_of_certificates = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_certificates(
+	           file,
+	           &number_of_certificates,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_certificates",
+	 number_of_certificates,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_number_of_certificates(
+	           NULL,
+	           &number_of_certificates,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_certificates(
+	           file,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_certificate function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_certificate(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	off64_t data_offset       = 0;
+	size64_t data_size        = 0;
+	uint16_t certificate_type = 0;
+	uint16_t revision         = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_certificate(
+	           file,
+	           0,
+	           &revision,
+	           &certificate_type,
+	           &data_offset,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "revision",
+	 revision,
+	 0x0200 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "certificate_type",
+	 certificate_type,
+	 0x0002 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0x00000808UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) 24 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_certificate(
+	           NULL,
+	           0,
+	           &revision,
+	           &certificate_type,
+	           &data_offset,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_certificate(
+	           file,
+	           -1,
+	           &revision,
+	           &certificate_type,
+	           &data_offset,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_certificate(
+	           file,
+	           1,
+	           &revision,
+	           &certificate_type,
+	           &data_offset,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_certificate(
+	           file,
+	           0,
+	           NULL,
+	           &certificate_type,
+	           &data_offset,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_certificate(
+	           file,
+	           0,
+	           &revision,
+	           &certificate_type,
+	           NULL,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_read_certificate_data_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_read_certificate_data_at_offset(
+     libexe_file_t *file )
+{
+	uint8_t buffer[ 32 ];
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               file,
+	               0,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 24 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           buffer,
+	           exe_test_certificate_data,
+	           24 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               file,
+	               0,
+	               buffer,
+	               20,
+	               4,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 20 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           buffer,
+	           &( exe_test_certificate_data[ 4 ] ),
+	           20 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               file,
+	               0,
+	               buffer,
+	               32,
+	               24,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               NULL,
+	               0,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               file,
+	               1,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               file,
+	               0,
+	               NULL,
+	               32,
+	               0,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               file,
+	               0,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               0,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_file_read_certificate_data_at_offset(
+	               file,
+	               0,
+	               buffer,
+	               32,
+	               -1,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_number_of_certificates",
+	 exe_test_file_get_number_of_certificates,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_certificate",
+	 exe_test_file_get_certificate,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_read_certificate_data_at_offset",
+	 exe_test_file_read_certificate_data_at_offset,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
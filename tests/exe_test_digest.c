@@ -0,0 +1,678 @@
+/*
+ * Library digest functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+uint8_t exe_test_digest_file_md5_hash[ 16 ] = {
+	0x86, 0x05, 0xa4, 0x0b, 0x97, 0xad, 0x28, 0x48, 0xe8, 0x92, 0x25, 0x06, 0x1e, 0x1f, 0x64, 0xed };
+
+uint8_t exe_test_digest_file_sha256_hash[ 32 ] = {
+	0x58, 0x40, 0x28, 0xba, 0xce, 0xbe, 0xbd, 0x2f, 0x7b, 0x91, 0x1d, 0x90, 0xdf, 0x5d, 0x29, 0x94,
+	0xb5, 0xa7, 0x1d, 0x31, 0x9b, 0x03, 0xf0, 0x37, 0xe8, 0x34, 0x27, 0x05, 0xb0, 0x29, 0xa1, 0xa4 };
+
+uint8_t exe_test_digest_section_md5_hashes[ 48 ] = {
+	0x8e, 0x65, 0x97, 0x21, 0x3c, 0x1f, 0x34, 0xd3, 0x68, 0xbf, 0x65, 0xe5, 0x17, 0x8b, 0x5e, 0xa3,
+	0x1f, 0xad, 0xb5, 0x51, 0x73, 0x69, 0xc4, 0x1c, 0xbc, 0xcb, 0xea, 0x0c, 0x66, 0xd1, 0x68, 0x4a,
+	0x59, 0xa7, 0x68, 0xed, 0x67, 0xa1, 0xed, 0x2e, 0x85, 0x17, 0x29, 0x0c, 0xbc, 0x23, 0xc4, 0xbc };
+
+uint8_t exe_test_digest_section_sha256_hash[ 32 ] = {
+	0x47, 0xe5, 0xab, 0xa6, 0x13, 0x7b, 0xaa, 0xc4, 0x2e, 0xd7, 0x57, 0x7b, 0x59, 0xe9, 0x62, 0x7e,
+	0xb5, 0x44, 0x2f, 0x8e, 0x6c, 0xc3, 0x55, 0xae, 0x69, 0xa6, 0x3a, 0x85, 0x7f, 0x63, 0xd4, 0xfe };
+
+uint8_t exe_test_digest_overlay_md5_hash[ 16 ] = {
+	0xb7, 0xac, 0x46, 0xfc, 0xef, 0xa4, 0x53, 0xf7, 0x1f, 0xc9, 0xc0, 0xac, 0x26, 0x93, 0xae, 0x4c };
+
+/* Tests the libexe_file_compute_digests function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_compute_digests(
+     libexe_file_t *file )
+{
+	uint8_t hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SHA256,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_compute_digests(
+	           file,
+	           LIBEXE_DIGEST_TYPE_MD5 | LIBEXE_DIGEST_TYPE_SHA256,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_compute_digests(
+	           NULL,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_digest_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_digest_hash(
+     libexe_file_t *file )
+{
+	uint8_t hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SHA256,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           hash,
+	           exe_test_digest_file_sha256_hash,
+	           32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_file_get_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           hash,
+	           exe_test_digest_file_md5_hash,
+	           16 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_file_get_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SHA1,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_digest_hash(
+	           NULL,
+	           LIBEXE_DIGEST_TYPE_SHA256,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_digest_hash(
+	           file,
+	           0xffffffffUL,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SHA256,
+	           NULL,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SHA256,
+	           hash,
+	           31,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_digest_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_digest_hash(
+     libexe_file_t *file )
+{
+	uint8_t hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int section_index        = 0;
+
+	/* Test regular cases
+	 */
+	for( section_index = 0;
+	     section_index < 3;
+	     section_index++ )
+	{
+		result = libexe_file_get_section_digest_hash(
+		           file,
+		           section_index,
+		           LIBEXE_DIGEST_TYPE_MD5,
+		           hash,
+		           16,
+		           &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		           hash,
+		           &( exe_test_digest_section_md5_hashes[ section_index * 16 ] ),
+		           16 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libexe_file_get_section_digest_hash(
+	           file,
+	           0,
+	           LIBEXE_DIGEST_TYPE_SHA256,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           hash,
+	           exe_test_digest_section_sha256_hash,
+	           32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_digest_hash(
+	           NULL,
+	           0,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_digest_hash(
+	           file,
+	           -1,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_digest_hash(
+	           file,
+	           3,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_digest_hash(
+	           file,
+	           0,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           NULL,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_digest_hash(
+	           file,
+	           0,
+	           LIBEXE_DIGEST_TYPE_SHA256,
+	           hash,
+	           16,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_overlay_digest_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_overlay_digest_hash(
+     libexe_file_t *file )
+{
+	uint8_t hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_overlay_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           hash,
+	           exe_test_digest_overlay_md5_hash,
+	           16 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_overlay_digest_hash(
+	           NULL,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_overlay_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           NULL,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_overlay_digest_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           hash,
+	           15,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_compute_digests",
+	 exe_test_file_compute_digests,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_digest_hash",
+	 exe_test_file_get_digest_hash,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_section_digest_hash",
+	 exe_test_file_get_section_digest_hash,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_overlay_digest_hash",
+	 exe_test_file_get_overlay_digest_hash,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,676 @@
+/*
+ * Library exception table (.pdata) functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+/* Tests the libexe_file_get_number_of_functions function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_number_of_functions(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_functions  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_functions(
+	          file,
+	          &number_of_functions,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_functions",
+	 number_of_functions,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_number_of_functions(
+	          NULL,
+	          &number_of_functions,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_functions(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_function function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_function(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error            = NULL;
+	uint32_t begin_address              = 0;
+	uint32_t end_address                = 0;
+	uint32_t unwind_information_address = 0;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_function(
+	          file,
+	          1,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "begin_address",
+	 begin_address,
+	 (uint32_t) 0x00001020UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "end_address",
+	 end_address,
+	 (uint32_t) 0x00001035UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_information_address",
+	 unwind_information_address,
+	 (uint32_t) 0x000021b8UL );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_function(
+	          NULL,
+	          1,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_function(
+	          file,
+	          -1,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_function(
+	          file,
+	          3,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_function(
+	          file,
+	          1,
+	          NULL,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_function_by_rva function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_function_by_rva(
+     libexe_file_t *file )
+{
+	uint32_t expected_begin_addresses[ 3 ] = {
+		0x00001000UL, 0x00001020UL, 0x00001040UL };
+
+	uint32_t relative_virtual_addresses[ 3 ] = {
+		0x00001000UL, 0x00001034UL, 0x00001050UL };
+
+	libcerror_error_t *error               = NULL;
+	uint32_t begin_address                 = 0;
+	uint32_t end_address                   = 0;
+	uint32_t unwind_information_address    = 0;
+	int address_index                      = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	for( address_index = 0;
+	     address_index < 3;
+	     address_index++ )
+	{
+		result = libexe_file_get_function_by_rva(
+		          file,
+		          relative_virtual_addresses[ address_index ],
+		          &begin_address,
+		          &end_address,
+		          &unwind_information_address,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_UINT32(
+		 "begin_address",
+		 begin_address,
+		 expected_begin_addresses[ address_index ] );
+	}
+	/* Test addresses that are not part of a function, before the first function,
+	 * between 2 functions and at the end address, which is exclusive
+	 */
+	result = libexe_file_get_function_by_rva(
+	          file,
+	          0x00000fffUL,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_function_by_rva(
+	          file,
+	          0x00001018UL,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_function_by_rva(
+	          file,
+	          0x00001055UL,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_function_by_rva(
+	          NULL,
+	          0x00001000UL,
+	          &begin_address,
+	          &end_address,
+	          &unwind_information_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_function_by_rva(
+	          file,
+	          0x00001000UL,
+	          &begin_address,
+	          &end_address,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests opening a file with a corrupt exception table
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_corrupt_exception_table(
+     void )
+{
+	uint8_t data[ EXE_TEST_FIXTURE_DATA_SIZE ];
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int number_of_functions  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_initialize(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an exception table that is not stored in the data of a section
+	 */
+	if( memory_copy(
+	     data,
+	     exe_test_fixture_data,
+	     EXE_TEST_FIXTURE_DATA_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0x120 ] ),
+	 0x00008000UL );
+
+	result = libexe_file_open_buffer(
+	           file,
+	           data,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_number_of_functions(
+	           file,
+	           &number_of_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_functions",
+	 number_of_functions,
+	 0 );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an exception table that is truncated
+	 */
+	if( memory_copy(
+	     data,
+	     exe_test_fixture_data,
+	     EXE_TEST_FIXTURE_DATA_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0x124 ] ),
+	 0x00001000UL );
+
+	result = libexe_file_open_buffer(
+	           file,
+	           data,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_number_of_functions(
+	           file,
+	           &number_of_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_functions",
+	 number_of_functions,
+	 0 );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_free(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	          &file,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_number_of_functions",
+	 exe_test_file_get_number_of_functions,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_function",
+	 exe_test_file_get_function,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_function_by_rva",
+	 exe_test_file_get_function_by_rva,
+	 file );
+
+	EXE_TEST_RUN(
+	 "libexe_file_open_corrupt_exception_table",
+	 exe_test_file_open_corrupt_exception_table );
+
+	result = exe_test_close_fixture(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,61 @@
+/*
+ * Functions for testing
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_TEST_FUNCTIONS_H )
+#define _EXE_TEST_FUNCTIONS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define EXE_TEST_FIXTURE_DATA_SIZE	2080
+
+extern const uint8_t exe_test_fixture_data[ EXE_TEST_FIXTURE_DATA_SIZE ];
+
+int exe_test_open_fixture(
+     libexe_file_t **file,
+     int access_flags,
+     libcerror_error_t **error );
+
+int exe_test_close_fixture(
+     libexe_file_t **file,
+     libcerror_error_t **error );
+
+int exe_test_write_fixture_file(
+     const char *filename,
+     libcerror_error_t **error );
+
+int exe_test_remove_fixture_file(
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXE_TEST_FUNCTIONS_H ) */
+
@@ -0,0 +1,646 @@
+/*
+ * Library fuzzy hash functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+char *exe_test_fuzzy_hash_file_ssdeep = \
+	"12:qGSG8COs1/rEShcwwTgsoG+D+Vb/CWvxnSv1OlaLhV:qGSlsxEJksr+69aWp6DLL";
+
+char *exe_test_fuzzy_hash_section_ssdeep[ 3 ] = {
+	"6:7mSkwBBglsm7G5DWlD1/kb+jYURerEYHMOM4sYjTE9K44kZFos3Uw5D6HU9SENlJ:7wwTgsoG+D+VY",
+	"3:uTklQlll/lbXDMlulalskHs/f1sFtjxllssmlVVlf4LjKFltll:0km/5MYaakM/+FvsjVlQLOf",
+	"3:B/VJvldM/y:l9y/" };
+
+size_t exe_test_fuzzy_hash_section_ssdeep_lengths[ 3 ] = {
+	80, 76, 17 };
+
+char *exe_test_fuzzy_hash_overlay_ssdeep = \
+	"3:Nlf4aLhV:gaLhV";
+
+/* Tests the libexe_file_compute_digests function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_compute_digests(
+     libexe_file_t *file )
+{
+	char string[ LIBEXE_SSDEEP_STRING_SIZE ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_compute_digests(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SSDEEP | LIBEXE_DIGEST_TYPE_TLSH,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_fuzzy_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_fuzzy_hash(
+     libexe_file_t *file )
+{
+	char string[ LIBEXE_SSDEEP_STRING_SIZE ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           string,
+	           exe_test_fuzzy_hash_file_ssdeep,
+	           68 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_file_get_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_TLSH,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "string[ 0 ]",
+	 string[ 0 ],
+	 'T' );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "string[ 1 ]",
+	 string[ 1 ],
+	 '1' );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "string[ 72 ]",
+	 string[ 72 ],
+	 0 );
+
+	for( string_index = 2;
+	     string_index < 72;
+	     string_index++ )
+	{
+		result = ( ( string[ string_index ] >= '0' ) && ( string[ string_index ] <= '9' ) )
+		      || ( ( string[ string_index ] >= 'A' ) && ( string[ string_index ] <= 'F' ) );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_fuzzy_hash(
+	           NULL,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_MD5,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           NULL,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE - 1,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_TLSH,
+	           string,
+	           LIBEXE_TLSH_STRING_SIZE - 1,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_fuzzy_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_fuzzy_hash(
+     libexe_file_t *file )
+{
+	char string[ LIBEXE_SSDEEP_STRING_SIZE ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int section_index        = 0;
+
+	/* Test regular cases
+	 */
+	for( section_index = 0;
+	     section_index < 3;
+	     section_index++ )
+	{
+		result = libexe_file_get_section_fuzzy_hash(
+		           file,
+		           section_index,
+		           LIBEXE_DIGEST_TYPE_SSDEEP,
+		           string,
+		           LIBEXE_SSDEEP_STRING_SIZE,
+		           &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		           string,
+		           exe_test_fuzzy_hash_section_ssdeep[ section_index ],
+		           exe_test_fuzzy_hash_section_ssdeep_lengths[ section_index ] + 1 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libexe_file_get_section_fuzzy_hash(
+	           file,
+	           0,
+	           LIBEXE_DIGEST_TYPE_TLSH,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data of the third section is too uniform for a TLSH
+	 */
+	result = libexe_file_get_section_fuzzy_hash(
+	           file,
+	           2,
+	           LIBEXE_DIGEST_TYPE_TLSH,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_fuzzy_hash(
+	           NULL,
+	           0,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_fuzzy_hash(
+	           file,
+	           -1,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_fuzzy_hash(
+	           file,
+	           3,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_fuzzy_hash(
+	           file,
+	           0,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           NULL,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_overlay_fuzzy_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_overlay_fuzzy_hash(
+     libexe_file_t *file )
+{
+	char string[ LIBEXE_SSDEEP_STRING_SIZE ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_overlay_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           string,
+	           exe_test_fuzzy_hash_overlay_ssdeep,
+	           17 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_overlay_fuzzy_hash(
+	           NULL,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           string,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_overlay_fuzzy_hash(
+	           file,
+	           LIBEXE_DIGEST_TYPE_SSDEEP,
+	           NULL,
+	           LIBEXE_SSDEEP_STRING_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_compute_digests",
+	 exe_test_file_compute_digests,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_fuzzy_hash",
+	 exe_test_file_get_fuzzy_hash,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_section_fuzzy_hash",
+	 exe_test_file_get_section_fuzzy_hash,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_overlay_fuzzy_hash",
+	 exe_test_file_get_overlay_fuzzy_hash,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,576 @@
+/*
+ * Library byte histogram functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+/* The expected number of 0-byte values of the sections of the test fixture
+ */
+uint64_t exe_test_histogram_section_zero_counts[ 3 ] = {
+	138, 440, 495 };
+
+/* The expected entropy of the sections of the test fixture in thousands of bits per byte
+ */
+int exe_test_histogram_section_entropies[ 3 ] = {
+	5937, 1164, 306 };
+
+/* Tests the libexe_file_compute_byte_histograms function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_compute_byte_histograms(
+     libexe_file_t *file )
+{
+	uint64_t histogram[ 256 ];
+	libcerror_error_t *error = NULL;
+	double entropy           = 0.0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_headers_byte_histogram(
+	           file,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_compute_byte_histograms(
+	           file,
+	           0,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_compute_byte_histograms(
+	           NULL,
+	           0,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_headers_byte_histogram function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_headers_byte_histogram(
+     libexe_file_t *file )
+{
+	uint64_t histogram[ 256 ];
+	libcerror_error_t *error = NULL;
+	double entropy           = 0.0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_headers_byte_histogram(
+	           file,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "histogram[ 0 ]",
+	 histogram[ 0 ],
+	 (uint64_t) 374 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entropy",
+	 (int) ( entropy * 1000.0 ),
+	 2293 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_headers_byte_histogram(
+	           NULL,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_headers_byte_histogram(
+	           file,
+	           NULL,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_headers_byte_histogram(
+	           file,
+	           histogram,
+	           255,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_headers_byte_histogram(
+	           file,
+	           histogram,
+	           256,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_byte_histogram function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_byte_histogram(
+     libexe_file_t *file )
+{
+	uint64_t histogram[ 256 ];
+	libcerror_error_t *error  = NULL;
+	double entropy            = 0.0;
+	uint64_t number_of_values = 0;
+	int byte_value            = 0;
+	int result                = 0;
+	int section_index         = 0;
+
+	/* Test regular cases
+	 */
+	for( section_index = 0;
+	     section_index < 3;
+	     section_index++ )
+	{
+		result = libexe_file_get_section_byte_histogram(
+		           file,
+		           section_index,
+		           histogram,
+		           256,
+		           &entropy,
+		           &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_UINT64(
+		 "histogram[ 0 ]",
+		 histogram[ 0 ],
+		 exe_test_histogram_section_zero_counts[ section_index ] );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "entropy",
+		 (int) ( entropy * 1000.0 ),
+		 exe_test_histogram_section_entropies[ section_index ] );
+
+		number_of_values = 0;
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			number_of_values += histogram[ byte_value ];
+		}
+		EXE_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_values",
+		 number_of_values,
+		 (uint64_t) 512 );
+	}
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_byte_histogram(
+	           NULL,
+	           0,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_byte_histogram(
+	           file,
+	           -1,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_byte_histogram(
+	           file,
+	           3,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_byte_histogram(
+	           file,
+	           0,
+	           histogram,
+	           255,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_overlay_byte_histogram function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_overlay_byte_histogram(
+     libexe_file_t *file )
+{
+	uint64_t histogram[ 256 ];
+	libcerror_error_t *error = NULL;
+	double entropy           = 0.0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_overlay_byte_histogram(
+	           file,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entropy",
+	 (int) ( entropy * 1000.0 ),
+	 4574 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_overlay_byte_histogram(
+	           NULL,
+	           histogram,
+	           256,
+	           &entropy,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_overlay_byte_histogram(
+	           file,
+	           histogram,
+	           256,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_compute_byte_histograms",
+	 exe_test_file_compute_byte_histograms,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_headers_byte_histogram",
+	 exe_test_file_get_headers_byte_histogram,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_section_byte_histogram",
+	 exe_test_file_get_section_byte_histogram,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_overlay_byte_histogram",
+	 exe_test_file_get_overlay_byte_histogram,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
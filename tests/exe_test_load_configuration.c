@@ -0,0 +1,621 @@
+/*
+ * Library load configuration functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+/* Tests the libexe_file_get_security_cookie function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_security_cookie(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t security_cookie = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_security_cookie(
+	           file,
+	           &security_cookie,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "security_cookie",
+	 security_cookie,
+	 (uint64_t) 0x140002100ULL );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_security_cookie(
+	           NULL,
+	           &security_cookie,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_security_cookie(
+	           file,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_guard_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_guard_flags(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t guard_flags     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_guard_flags(
+	           file,
+	           &guard_flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "guard_flags",
+	 guard_flags,
+	 (uint32_t) 0x10000500UL );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_guard_flags(
+	           NULL,
+	           &guard_flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_guard_flags(
+	           file,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_number_of_guard_cf_functions function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_number_of_guard_cf_functions(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error         = NULL;
+	int number_of_guard_cf_functions = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_guard_cf_functions(
+	           file,
+	           &number_of_guard_cf_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_guard_cf_functions",
+	 number_of_guard_cf_functions,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_number_of_guard_cf_functions(
+	           NULL,
+	           &number_of_guard_cf_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_guard_cf_functions(
+	           file,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_guard_cf_function function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_guard_cf_function(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error          = NULL;
+	uint32_t relative_virtual_address = 0;
+	uint8_t flags                     = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_guard_cf_function(
+	           file,
+	           1,
+	           &relative_virtual_address,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_address",
+	 relative_virtual_address,
+	 (uint32_t) 0x00001020UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 LIBEXE_GUARD_CF_FUNCTION_FLAG_SUPPRESSED );
+
+	result = libexe_file_get_guard_cf_function(
+	           file,
+	           2,
+	           &relative_virtual_address,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_address",
+	 relative_virtual_address,
+	 (uint32_t) 0x00001040UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_guard_cf_function(
+	           NULL,
+	           1,
+	           &relative_virtual_address,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_guard_cf_function(
+	           file,
+	           -1,
+	           &relative_virtual_address,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_guard_cf_function(
+	           file,
+	           3,
+	           &relative_virtual_address,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_guard_cf_function(
+	           file,
+	           1,
+	           NULL,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_guard_cf_function(
+	           file,
+	           1,
+	           &relative_virtual_address,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_has_guard_cf_function function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_has_guard_cf_function(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_has_guard_cf_function(
+	           file,
+	           0x00001020UL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_has_guard_cf_function(
+	           file,
+	           0x00001030UL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_has_guard_cf_function(
+	           file,
+	           0x00000fffUL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_has_guard_cf_function(
+	           NULL,
+	           0x00001020UL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_security_cookie",
+	 exe_test_file_get_security_cookie,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_guard_flags",
+	 exe_test_file_get_guard_flags,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_number_of_guard_cf_functions",
+	 exe_test_file_get_number_of_guard_cf_functions,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_guard_cf_function",
+	 exe_test_file_get_guard_cf_function,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_has_guard_cf_function",
+	 exe_test_file_has_guard_cf_function,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,120 @@
+/*
+ * The macros for testing
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_TEST_MACROS_H )
+#define _EXE_TEST_MACROS_H
+
+#include <common.h>
+#include <file_stream.h>
+
+#define EXE_TEST_ASSERT_EQUAL_INT( name, value, expected_value ) \
+	if( value != expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%d) != %d\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_NOT_EQUAL_INT( name, value, expected_value ) \
+	if( value == expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%d) == %d\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_GREATER_THAN_INT( name, value, expected_value ) \
+	if( value <= expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%d) <= %d\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_EQUAL_SSIZE( name, value, expected_value ) \
+	if( value != expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIzd ") != %" PRIzd "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_EQUAL_SIZE( name, value, expected_value ) \
+	if( value != expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIzu ") != %" PRIzu "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_EQUAL_UINT8( name, value, expected_value ) \
+	if( value != expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIu8 ") != %" PRIu8 "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_EQUAL_UINT16( name, value, expected_value ) \
+	if( value != expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (0x%04" PRIx16 ") != 0x%04" PRIx16 "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_EQUAL_UINT32( name, value, expected_value ) \
+	if( value != expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (0x%08" PRIx32 ") != 0x%08" PRIx32 "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_EQUAL_UINT64( name, value, expected_value ) \
+	if( value != expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (0x%08" PRIx64 ") != 0x%08" PRIx64 "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_IS_NULL( name, value ) \
+	if( value != NULL ) \
+	{ \
+		fprintf( stdout, "%s:%d %s != NULL\n", __FILE__, __LINE__, name ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_ASSERT_IS_NOT_NULL( name, value ) \
+	if( value == NULL ) \
+	{ \
+		fprintf( stdout, "%s:%d %s == NULL\n", __FILE__, __LINE__, name ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_RUN( name, function ) \
+	if( function() != 1 ) \
+	{ \
+		fprintf( stdout, "Unable to run test: %s\n", name ); \
+		goto on_error; \
+	}
+
+#define EXE_TEST_RUN_WITH_ARGS( name, function, ... ) \
+	if( function( __VA_ARGS__ ) != 1 ) \
+	{ \
+		fprintf( stdout, "Unable to run test: %s\n", name ); \
+		goto on_error; \
+	}
+
+#endif /* !defined( _EXE_TEST_MACROS_H ) */
+
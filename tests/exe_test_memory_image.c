@@ -0,0 +1,458 @@
+/*
+ * Library memory image functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+#define EXE_TEST_MEMORY_IMAGE_SIZE	0x4000
+
+/* Fills a buffer with the test fixture in the layout of a loaded module, where the headers
+ * are stored at offset 0 and the data of the sections at their virtual address
+ * The data at the file offsets of the sections is filled with 0xcc bytes
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_memory_image_fill_buffer(
+     uint8_t *buffer )
+{
+	if( memory_set(
+	     buffer,
+	     0xcc,
+	     EXE_TEST_MEMORY_IMAGE_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The headers
+	 */
+	if( memory_copy(
+	     buffer,
+	     exe_test_fixture_data,
+	     0x200 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The .text section
+	 */
+	if( memory_copy(
+	     &( buffer[ 0x1000 ] ),
+	     &( exe_test_fixture_data[ 0x200 ] ),
+	     0x200 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The .rdata section
+	 */
+	if( memory_copy(
+	     &( buffer[ 0x2000 ] ),
+	     &( exe_test_fixture_data[ 0x400 ] ),
+	     0x200 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The .pdata section
+	 */
+	if( memory_copy(
+	     &( buffer[ 0x3000 ] ),
+	     &( exe_test_fixture_data[ 0x600 ] ),
+	     0x200 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libexe_file_open_buffer function with the memory image access flag
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_memory_image(
+     void )
+{
+	uint8_t data[ 16 ];
+	libcerror_error_t *error  = NULL;
+	libexe_file_t *file       = NULL;
+	libexe_section_t *section = NULL;
+	uint8_t *buffer           = NULL;
+	off64_t start_offset      = 0;
+	size64_t size             = 0;
+	ssize_t read_count        = 0;
+	uint32_t virtual_address  = 0;
+	int number_of_functions   = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	          sizeof( uint8_t ) * EXE_TEST_MEMORY_IMAGE_SIZE );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = exe_test_memory_image_fill_buffer(
+	           buffer );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libexe_file_initialize(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_open_buffer(
+	           file,
+	           buffer,
+	           EXE_TEST_MEMORY_IMAGE_SIZE,
+	           LIBEXE_OPEN_READ_MEMORY_IMAGE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the section data is stored at the virtual address
+	 */
+	result = libexe_file_get_section(
+	           file,
+	           0,
+	           &section,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section",
+	 section );
+
+	result = libexe_section_get_virtual_address(
+	           section,
+	           &virtual_address,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "virtual_address",
+	 virtual_address,
+	 (uint32_t) 0x00001000UL );
+
+	result = libexe_section_get_start_offset(
+	           section,
+	           &start_offset,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "start_offset",
+	 (uint64_t) start_offset,
+	 (uint64_t) 0x00001000UL );
+
+	/* The size of the section data is the virtual size
+	 */
+	result = libexe_section_get_size(
+	           section,
+	           &size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0x00000100UL );
+
+	read_count = libexe_section_read_buffer_at_offset(
+	               section,
+	               data,
+	               16,
+	               0,
+	               &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	           data,
+	           &( exe_test_fixture_data[ 0x200 ] ),
+	           16 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_section_free(
+	           &section,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the relative virtual address of the exception table is used as the offset
+	 */
+	result = libexe_file_get_number_of_functions(
+	           file,
+	           &number_of_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_functions",
+	 number_of_functions,
+	 3 );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the layout is reset when the file is opened without the memory image access flag
+	 */
+	result = libexe_file_open_buffer(
+	           file,
+	           exe_test_fixture_data,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_section(
+	           file,
+	           0,
+	           &section,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_start_offset(
+	           section,
+	           &start_offset,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "start_offset",
+	 (uint64_t) start_offset,
+	 (uint64_t) 0x00000200UL );
+
+	result = libexe_section_free(
+	           &section,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_free(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EXE_TEST_RUN(
+	 "libexe_file_open_memory_image",
+	 exe_test_file_open_memory_image );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,820 @@
+/*
+ * Library Merkle tree functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+/* The sections of the test fixture each consist of a single chunk
+ * where the root hash is the SHA256 of a 0 byte followed by the section data
+ */
+uint8_t exe_test_merkle_tree_root_hashes[ 96 ] = {
+	0x40, 0x27, 0x0f, 0x60, 0x47, 0xed, 0x3e, 0x0c, 0xb8, 0x53, 0x16, 0x81, 0x75, 0x2a, 0xc3, 0x39,
+	0x88, 0xd5, 0x42, 0x8b, 0x5a, 0x37, 0xb1, 0x0b, 0x78, 0x96, 0x7b, 0x29, 0xd0, 0xf3, 0xb6, 0xd8,
+	0x16, 0x10, 0xc5, 0xd4, 0x1f, 0x26, 0x96, 0x02, 0x1b, 0x4f, 0x50, 0x33, 0x43, 0x05, 0x4b, 0x80,
+	0x17, 0x08, 0xd0, 0x8c, 0xf5, 0xe6, 0x31, 0x11, 0x94, 0x78, 0xeb, 0x7e, 0x9a, 0x1a, 0x75, 0xc9,
+	0x82, 0x34, 0xeb, 0xa3, 0x4b, 0x5c, 0xe0, 0x22, 0x9d, 0xa8, 0x1a, 0x1e, 0x76, 0xf2, 0x0c, 0xf8,
+	0x23, 0x2a, 0x4f, 0xb1, 0x4d, 0x23, 0x81, 0x0c, 0x53, 0x59, 0x42, 0x7c, 0xb3, 0xa7, 0x4a, 0x62 };
+
+/* Tests the libexe_file_compute_section_merkle_trees function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_compute_section_merkle_trees(
+     libexe_file_t *file )
+{
+	uint8_t hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_section_merkle_tree_root_hash(
+	           file,
+	           0,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_compute_section_merkle_trees(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_compute_section_merkle_trees(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_merkle_tree_root_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_merkle_tree_root_hash(
+     libexe_file_t *file )
+{
+	uint8_t hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int section_index        = 0;
+
+	/* Test regular cases
+	 */
+	for( section_index = 0;
+	     section_index < 3;
+	     section_index++ )
+	{
+		result = libexe_file_get_section_merkle_tree_root_hash(
+		           file,
+		           section_index,
+		           hash,
+		           32,
+		           &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		           hash,
+		           &( exe_test_merkle_tree_root_hashes[ section_index * 32 ] ),
+		           32 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_merkle_tree_root_hash(
+	           NULL,
+	           0,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_root_hash(
+	           file,
+	           -1,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_root_hash(
+	           file,
+	           3,
+	           hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_root_hash(
+	           file,
+	           0,
+	           NULL,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_root_hash(
+	           file,
+	           0,
+	           hash,
+	           31,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_merkle_tree_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_merkle_tree_data_size(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_section_merkle_tree_data_size(
+	           file,
+	           0,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 64 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_merkle_tree_data_size(
+	           NULL,
+	           0,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_data_size(
+	           file,
+	           3,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_data_size(
+	           file,
+	           0,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_merkle_tree_data function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_merkle_tree_data(
+     libexe_file_t *file )
+{
+	uint8_t data[ 64 ];
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_section_merkle_tree_data(
+	           file,
+	           0,
+	           data,
+	           64,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The root hash is stored at the end of the data
+	 */
+	result = memory_compare(
+	           &( data[ 32 ] ),
+	           exe_test_merkle_tree_root_hashes,
+	           32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_merkle_tree_data(
+	           NULL,
+	           0,
+	           data,
+	           64,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_data(
+	           file,
+	           3,
+	           data,
+	           64,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_data(
+	           file,
+	           0,
+	           NULL,
+	           64,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_merkle_tree_data(
+	           file,
+	           0,
+	           data,
+	           63,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_merkle_tree_data_get_next_differing_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_merkle_tree_data_get_next_differing_chunk(
+     libexe_file_t *file )
+{
+	uint8_t data1[ 64 ];
+	uint8_t data2[ 64 ];
+	libcerror_error_t *error = NULL;
+	uint64_t chunk_offset    = 0;
+	uint64_t chunk_size      = 0;
+	int chunk_index          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_section_merkle_tree_data(
+	           file,
+	           0,
+	           data1,
+	           64,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_section_merkle_tree_data(
+	           file,
+	           1,
+	           data2,
+	           64,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_merkle_tree_data_get_next_differing_chunk(
+	           data1,
+	           64,
+	           data2,
+	           64,
+	           0,
+	           &chunk_index,
+	           &chunk_offset,
+	           &chunk_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "chunk_index",
+	 chunk_index,
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_offset",
+	 chunk_offset,
+	 (uint64_t) 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_size",
+	 chunk_size,
+	 (uint64_t) 512 );
+
+	result = libexe_merkle_tree_data_get_next_differing_chunk(
+	           data1,
+	           64,
+	           data2,
+	           64,
+	           1,
+	           &chunk_index,
+	           &chunk_offset,
+	           &chunk_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_merkle_tree_data_get_next_differing_chunk(
+	           data1,
+	           64,
+	           data1,
+	           64,
+	           0,
+	           &chunk_index,
+	           &chunk_offset,
+	           &chunk_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_merkle_tree_data_get_next_differing_chunk(
+	           NULL,
+	           64,
+	           data2,
+	           64,
+	           0,
+	           &chunk_index,
+	           &chunk_offset,
+	           &chunk_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_merkle_tree_data_get_next_differing_chunk(
+	           data1,
+	           8,
+	           data2,
+	           64,
+	           0,
+	           &chunk_index,
+	           &chunk_offset,
+	           &chunk_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_merkle_tree_data_get_next_differing_chunk(
+	           data1,
+	           64,
+	           NULL,
+	           64,
+	           0,
+	           &chunk_index,
+	           &chunk_offset,
+	           &chunk_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_merkle_tree_data_get_next_differing_chunk(
+	           data1,
+	           64,
+	           data2,
+	           64,
+	           0,
+	           NULL,
+	           &chunk_offset,
+	           &chunk_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_compute_section_merkle_trees",
+	 exe_test_file_compute_section_merkle_trees,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_section_merkle_tree_root_hash",
+	 exe_test_file_get_section_merkle_tree_root_hash,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_section_merkle_tree_data_size",
+	 exe_test_file_get_section_merkle_tree_data_size,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_section_merkle_tree_data",
+	 exe_test_file_get_section_merkle_tree_data,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_merkle_tree_data_get_next_differing_chunk",
+	 exe_test_merkle_tree_data_get_next_differing_chunk,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
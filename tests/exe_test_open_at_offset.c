@@ -0,0 +1,453 @@
+/*
+ * Library open at offset functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libbfio.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+#define EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET	0x100
+
+#define EXE_TEST_OPEN_AT_OFFSET_BUFFER_SIZE	( EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET + EXE_TEST_FIXTURE_DATA_SIZE + 0x40 )
+
+#if defined( LIBEXE_HAVE_BFIO )
+
+/* Tests the libexe_file_open_file_io_handle_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_file_io_handle_at_offset(
+     void )
+{
+	uint8_t buffer[ EXE_TEST_OPEN_AT_OFFSET_BUFFER_SIZE ];
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_file_t *file              = NULL;
+	off64_t data_offset              = 0;
+	size64_t data_size               = 0;
+	uint32_t checksum                = 0;
+	uint16_t certificate_type        = 0;
+	uint16_t revision                = 0;
+	int number_of_functions          = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     buffer,
+	     0xcc,
+	     EXE_TEST_OPEN_AT_OFFSET_BUFFER_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( buffer[ EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET ] ),
+	     exe_test_fixture_data,
+	     EXE_TEST_FIXTURE_DATA_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libbfio_memory_range_initialize(
+	           &file_io_handle,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	result = libbfio_memory_range_set(
+	           file_io_handle,
+	           buffer,
+	           EXE_TEST_OPEN_AT_OFFSET_BUFFER_SIZE,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_initialize(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_open_file_io_handle_at_offset(
+	           file,
+	           file_io_handle,
+	           EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The offsets are relative to the base offset
+	 */
+	result = libexe_file_get_certificate(
+	           file,
+	           0,
+	           &revision,
+	           &certificate_type,
+	           &data_offset,
+	           &data_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0x00000808UL );
+
+	result = libexe_file_compute_checksum(
+	           file,
+	           &checksum,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x0000a887UL );
+
+	result = libexe_file_get_number_of_functions(
+	           file,
+	           &number_of_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_functions",
+	 number_of_functions,
+	 3 );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size limit of 0, which represents the remainder of the file IO handle,
+	 * where the checksum includes the 0x40 bytes that follow the test fixture
+	 */
+	result = libexe_file_open_file_io_handle_at_offset(
+	           file,
+	           file_io_handle,
+	           EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET,
+	           0,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_compute_checksum(
+	           file,
+	           &checksum,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x00004261UL );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_open_file_io_handle_at_offset(
+	           NULL,
+	           file_io_handle,
+	           EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET,
+	           0,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_file_io_handle_at_offset(
+	           file,
+	           NULL,
+	           EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET,
+	           0,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_file_io_handle_at_offset(
+	           file,
+	           file_io_handle,
+	           -1,
+	           0,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a base offset that does not contain an executable
+	 */
+	result = libexe_file_open_file_io_handle_at_offset(
+	           file,
+	           file_io_handle,
+	           0,
+	           0,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a size limit that is too small to contain the headers
+	 */
+	result = libexe_file_open_file_io_handle_at_offset(
+	           file,
+	           file_io_handle,
+	           EXE_TEST_OPEN_AT_OFFSET_BASE_OFFSET,
+	           0x40,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_free(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	           &file_io_handle,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBEXE_HAVE_BFIO ) */
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( LIBEXE_HAVE_BFIO )
+
+	EXE_TEST_RUN(
+	 "libexe_file_open_file_io_handle_at_offset",
+	 exe_test_file_open_file_io_handle_at_offset );
+
+#endif /* defined( LIBEXE_HAVE_BFIO ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
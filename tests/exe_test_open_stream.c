@@ -0,0 +1,765 @@
+/*
+ * Library open stream functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+#define EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE	0x00030200UL
+
+typedef struct exe_test_stream exe_test_stream_t;
+
+/* The stream read by the read callback
+ */
+struct exe_test_stream
+{
+	/* The stream data
+	 */
+	const uint8_t *data;
+
+	/* The stream data size
+	 */
+	size_t data_size;
+
+	/* The current offset
+	 */
+	size_t offset;
+
+	/* The maximum size of a read
+	 */
+	size_t read_size;
+};
+
+typedef struct exe_test_section_data exe_test_section_data_t;
+
+/* The section data passed to the data callback
+ */
+struct exe_test_section_data
+{
+	/* The number of calls of the data callback
+	 */
+	int number_of_calls;
+
+	/* The section data sizes
+	 */
+	size_t data_sizes[ 3 ];
+};
+
+/* Reads data from the stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t exe_test_read_callback(
+         uint8_t *buffer,
+         size_t size,
+         void *callback_data )
+{
+	exe_test_stream_t *stream = NULL;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	stream = (exe_test_stream_t *) callback_data;
+
+	if( size > stream->read_size )
+	{
+		size = stream->read_size;
+	}
+	if( size > ( stream->data_size - stream->offset ) )
+	{
+		size = stream->data_size - stream->offset;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( stream->data[ stream->offset ] ),
+	     size ) == NULL )
+	{
+		return( -1 );
+	}
+	stream->offset += size;
+
+	return( (ssize_t) size );
+}
+
+/* Checks the section data passed by the file against the test fixture
+ * Returns 1 to continue or -1 on error
+ */
+int exe_test_data_callback(
+     int section_index,
+     off64_t section_data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data )
+{
+	exe_test_section_data_t *section_data = NULL;
+	size_t fixture_offset                 = 0;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	section_data = (exe_test_section_data_t *) callback_data;
+
+	if( ( section_index < 0 )
+	 || ( section_index >= 3 ) )
+	{
+		return( -1 );
+	}
+	/* The section data of the test fixture is stored at offset 0x200 in blocks of 512 bytes
+	 */
+	fixture_offset = 0x200 + ( (size_t) section_index * 512 ) + (size_t) section_data_offset;
+
+	if( ( fixture_offset + data_size ) > EXE_TEST_FIXTURE_DATA_SIZE )
+	{
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     &( exe_test_fixture_data[ fixture_offset ] ),
+	     data_size ) != 0 )
+	{
+		return( -1 );
+	}
+	section_data->number_of_calls             += 1;
+	section_data->data_sizes[ section_index ] += data_size;
+
+	return( 1 );
+}
+
+/* Tests the libexe_file_open_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_stream(
+     void )
+{
+	exe_test_section_data_t section_data;
+	exe_test_stream_t stream;
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	uint32_t checksum        = 0;
+	int number_of_functions  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_initialize(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a data callback and reads that are smaller than requested
+	 */
+	stream.data      = exe_test_fixture_data;
+	stream.data_size = EXE_TEST_FIXTURE_DATA_SIZE;
+	stream.offset    = 0;
+	stream.read_size = 100;
+
+	if( memory_set(
+	     &section_data,
+	     0,
+	     sizeof( exe_test_section_data_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_open_stream(
+	           file,
+	           &exe_test_read_callback,
+	           &stream,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           0,
+	           &exe_test_data_callback,
+	           &section_data,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_sizes[ 0 ]",
+	 section_data.data_sizes[ 0 ],
+	 (size_t) 512 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_sizes[ 1 ]",
+	 section_data.data_sizes[ 1 ],
+	 (size_t) 512 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_sizes[ 2 ]",
+	 section_data.data_sizes[ 2 ],
+	 (size_t) 512 );
+
+	result = libexe_file_compute_checksum(
+	           file,
+	           &checksum,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x0000a887UL );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without a data callback
+	 */
+	stream.data      = exe_test_fixture_data;
+	stream.data_size = EXE_TEST_FIXTURE_DATA_SIZE;
+	stream.offset    = 0;
+	stream.read_size = EXE_TEST_FIXTURE_DATA_SIZE;
+
+	if( memory_set(
+	     &section_data,
+	     0,
+	     sizeof( exe_test_section_data_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_open_stream(
+	           file,
+	           &exe_test_read_callback,
+	           &stream,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           0,
+	           NULL,
+	           NULL,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_number_of_functions(
+	           file,
+	           &number_of_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_functions",
+	 number_of_functions,
+	 3 );
+
+	result = libexe_file_stream_section_data(
+	           file,
+	           &exe_test_data_callback,
+	           &section_data,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_calls",
+	 section_data.number_of_calls,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_sizes[ 2 ]",
+	 section_data.data_sizes[ 2 ],
+	 (size_t) 512 );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	stream.data      = exe_test_fixture_data;
+	stream.data_size = EXE_TEST_FIXTURE_DATA_SIZE;
+	stream.offset    = 0;
+	stream.read_size = EXE_TEST_FIXTURE_DATA_SIZE;
+
+	result = libexe_file_open_stream(
+	           NULL,
+	           &exe_test_read_callback,
+	           &stream,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           0,
+	           NULL,
+	           NULL,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_stream(
+	           file,
+	           NULL,
+	           &stream,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           0,
+	           NULL,
+	           NULL,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a stream that ends before the end of the headers
+	 */
+	stream.data      = exe_test_fixture_data;
+	stream.data_size = EXE_TEST_FIXTURE_DATA_SIZE;
+	stream.offset    = 0;
+	stream.read_size = EXE_TEST_FIXTURE_DATA_SIZE;
+
+	stream.data_size = 0x100;
+
+	result = libexe_file_open_stream(
+	           file,
+	           &exe_test_read_callback,
+	           &stream,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           0,
+	           NULL,
+	           NULL,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if an error of the data callback is passed on
+	 */
+	stream.data      = exe_test_fixture_data;
+	stream.data_size = EXE_TEST_FIXTURE_DATA_SIZE;
+	stream.offset    = 0;
+	stream.read_size = EXE_TEST_FIXTURE_DATA_SIZE;
+
+	result = libexe_file_open_stream(
+	           file,
+	           &exe_test_read_callback,
+	           &stream,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           0,
+	           &exe_test_data_callback,
+	           NULL,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_free(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Fills a buffer with a copy of the test fixture where the data of the .pdata section,
+ * which contains the exception table, is stored at offset 0x30000
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_open_stream_fill_seek_back_buffer(
+     uint8_t *buffer )
+{
+	if( memory_set(
+	     buffer,
+	     0,
+	     EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     buffer,
+	     exe_test_fixture_data,
+	     0x600 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( buffer[ 0x30000 ] ),
+	     &( exe_test_fixture_data[ 0x600 ] ),
+	     0x200 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* The pointer to the raw data of the .pdata section
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer[ 0x1ec ] ),
+	 0x00030000UL );
+
+	return( 1 );
+}
+
+/* Tests the libexe_file_open_stream function with data that is read out of order
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_stream_seek_back(
+     void )
+{
+	exe_test_stream_t stream;
+	libcerror_error_t *error    = NULL;
+	libexe_file_t *file         = NULL;
+	uint8_t *buffer             = NULL;
+	int number_of_functions     = 0;
+	int number_of_tls_callbacks = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	          sizeof( uint8_t ) * EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = exe_test_open_stream_fill_seek_back_buffer(
+	           buffer );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libexe_file_initialize(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the TLS callbacks can be read after the exception table when the stream is buffered without maximum
+	 */
+	stream.data      = buffer;
+	stream.data_size = EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE;
+	stream.offset    = 0;
+	stream.read_size = EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE;
+
+	result = libexe_file_open_stream(
+	           file,
+	           &exe_test_read_callback,
+	           &stream,
+	           EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE,
+	           0,
+	           NULL,
+	           NULL,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_number_of_functions(
+	           file,
+	           &number_of_functions,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_functions",
+	 number_of_functions,
+	 3 );
+
+	result = libexe_file_get_number_of_tls_callbacks(
+	           file,
+	           &number_of_tls_callbacks,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tls_callbacks",
+	 number_of_tls_callbacks,
+	 2 );
+
+	result = libexe_file_close(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	/* Test if opening fails when the TLS callbacks are stored more than half the maximum buffer size
+	 * before the exception table, since they are read after the data directories
+	 */
+	stream.data      = buffer;
+	stream.data_size = EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE;
+	stream.offset    = 0;
+	stream.read_size = EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE;
+
+	result = libexe_file_open_stream(
+	           file,
+	           &exe_test_read_callback,
+	           &stream,
+	           EXE_TEST_OPEN_STREAM_SEEK_BACK_DATA_SIZE,
+	           0x10000,
+	           NULL,
+	           NULL,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_free(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EXE_TEST_RUN(
+	 "libexe_file_open_stream",
+	 exe_test_file_open_stream );
+
+	EXE_TEST_RUN(
+	 "libexe_file_open_stream_seek_back",
+	 exe_test_file_open_stream_seek_back );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
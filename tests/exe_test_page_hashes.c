@@ -0,0 +1,564 @@
+/*
+ * Library Authenticode page hash functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+uint8_t exe_test_page_hashes_sha1_hash[ 20 ] = {
+	0x1c, 0xbf, 0x06, 0x10, 0x54, 0x9e, 0x2f, 0x60, 0x4c, 0x04, 0xc9, 0x03, 0xf2, 0x71, 0x95, 0x44,
+	0x33, 0x82, 0x42, 0x25 };
+
+uint8_t exe_test_page_hashes_sha256_hash[ 32 ] = {
+	0x67, 0x6b, 0x40, 0x00, 0x18, 0x09, 0x75, 0xd0, 0xb0, 0x48, 0xfc, 0xd3, 0x4f, 0xf0, 0x6d, 0x29,
+	0x8e, 0x0f, 0x40, 0xd3, 0x94, 0x15, 0xa9, 0xc4, 0x61, 0x54, 0x63, 0x2b, 0x80, 0x6c, 0x68, 0xfe };
+
+uint8_t exe_test_page_hashes_section_sha256_hash[ 32 ] = {
+	0x74, 0x8c, 0x0a, 0xdd, 0x59, 0x48, 0xac, 0xc9, 0xea, 0x29, 0x0f, 0x43, 0x5f, 0x00, 0x2a, 0x21,
+	0xa8, 0x61, 0x7b, 0xc7, 0xef, 0xeb, 0xa7, 0x8b, 0xb9, 0xf3, 0xbe, 0xb2, 0x66, 0x81, 0x7d, 0x32 };
+
+uint8_t exe_test_page_hashes_empty_hash[ 32 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libexe_file_compute_page_hashes function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_compute_page_hashes(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int number_of_page_hashes = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_page_hashes(
+	           file,
+	           &number_of_page_hashes,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_page_hashes",
+	 number_of_page_hashes,
+	 0 );
+
+	result = libexe_file_compute_page_hashes(
+	           file,
+	           1,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_number_of_page_hashes(
+	           file,
+	           &number_of_page_hashes,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_page_hashes",
+	 number_of_page_hashes,
+	 5 );
+
+	result = libexe_file_compute_page_hashes(
+	           file,
+	           4,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_number_of_page_hashes(
+	           file,
+	           &number_of_page_hashes,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_page_hashes",
+	 number_of_page_hashes,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_compute_page_hashes(
+	           NULL,
+	           1,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_page_hashes(
+	           NULL,
+	           &number_of_page_hashes,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_page_hashes(
+	           file,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_page_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_page_hash(
+     libexe_file_t *file )
+{
+	uint8_t sha1_hash[ 20 ];
+	uint8_t sha256_hash[ 32 ];
+	libcerror_error_t *error = NULL;
+	uint32_t file_offset     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_page_hash(
+	           file,
+	           0,
+	           &file_offset,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "file_offset",
+	 file_offset,
+	 (uint32_t) 0 );
+
+	result = memory_compare(
+	           sha1_hash,
+	           exe_test_page_hashes_sha1_hash,
+	           20 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	           sha256_hash,
+	           exe_test_page_hashes_sha256_hash,
+	           32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_file_get_page_hash(
+	           file,
+	           1,
+	           &file_offset,
+	           NULL,
+	           0,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "file_offset",
+	 file_offset,
+	 (uint32_t) 0x00000200UL );
+
+	result = memory_compare(
+	           sha256_hash,
+	           exe_test_page_hashes_section_sha256_hash,
+	           32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_file_get_page_hash(
+	           file,
+	           4,
+	           &file_offset,
+	           NULL,
+	           0,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "file_offset",
+	 file_offset,
+	 (uint32_t) 0x00000800UL );
+
+	result = memory_compare(
+	           sha256_hash,
+	           exe_test_page_hashes_empty_hash,
+	           32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_page_hash(
+	           NULL,
+	           0,
+	           &file_offset,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_page_hash(
+	           file,
+	           -1,
+	           &file_offset,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_page_hash(
+	           file,
+	           5,
+	           &file_offset,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_page_hash(
+	           file,
+	           0,
+	           NULL,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_page_hash(
+	           file,
+	           0,
+	           &file_offset,
+	           sha1_hash,
+	           19,
+	           sha256_hash,
+	           32,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_page_hash(
+	           file,
+	           0,
+	           &file_offset,
+	           sha1_hash,
+	           20,
+	           sha256_hash,
+	           31,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_compute_page_hashes",
+	 exe_test_file_compute_page_hashes,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_page_hash",
+	 exe_test_file_get_page_hash,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
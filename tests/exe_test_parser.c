@@ -0,0 +1,1133 @@
+/*
+ * Library parser functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+typedef struct exe_test_event exe_test_event_t;
+
+/* An event passed to the event callback
+ */
+struct exe_test_event
+{
+	/* The event type
+	 */
+	int event_type;
+
+	/* The event index
+	 */
+	int event_index;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The relative virtual address
+	 */
+	uint32_t relative_virtual_address;
+};
+
+typedef struct exe_test_events exe_test_events_t;
+
+/* The events passed to the event callback
+ */
+struct exe_test_events
+{
+	/* The number of events
+	 */
+	int number_of_events;
+
+	/* The maximum number of events, after which the event callback stops parsing
+	 */
+	int maximum_number_of_events;
+
+	/* The events
+	 */
+	exe_test_event_t events[ 16 ];
+};
+
+/* The expected events of the test fixture
+ */
+exe_test_event_t exe_test_parser_expected_events[ 10 ] = {
+	{ LIBEXE_PARSER_EVENT_TYPE_MZ_HEADER, 0, 0x00000000UL, 176, 0 },
+	{ LIBEXE_PARSER_EVENT_TYPE_COFF_HEADER, 0, 0x00000084UL, 20, 0 },
+	{ LIBEXE_PARSER_EVENT_TYPE_COFF_OPTIONAL_HEADER, 0, 0x00000098UL, 240, 0 },
+	{ LIBEXE_PARSER_EVENT_TYPE_SECTION, 0, 0x00000200UL, 512, 0x00001000UL },
+	{ LIBEXE_PARSER_EVENT_TYPE_SECTION, 1, 0x00000400UL, 512, 0x00002000UL },
+	{ LIBEXE_PARSER_EVENT_TYPE_SECTION, 2, 0x00000600UL, 512, 0x00003000UL },
+	{ LIBEXE_PARSER_EVENT_TYPE_DATA_DIRECTORY, 3, 0x00000600UL, 36, 0x00003000UL },
+	{ LIBEXE_PARSER_EVENT_TYPE_DATA_DIRECTORY, 4, 0x00000800UL, 32, 0 },
+	{ LIBEXE_PARSER_EVENT_TYPE_DATA_DIRECTORY, 9, 0x00000540UL, 40, 0x00002140UL },
+	{ LIBEXE_PARSER_EVENT_TYPE_DATA_DIRECTORY, 10, 0x00000400UL, 320, 0x00002000UL } };
+
+/* Stores an event passed by the parser
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int exe_test_event_callback(
+     int event_type,
+     int event_index,
+     off64_t file_offset,
+     size64_t size,
+     uint32_t relative_virtual_address,
+     void *callback_data )
+{
+	exe_test_event_t *event    = NULL;
+	exe_test_events_t *events = NULL;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	events = (exe_test_events_t *) callback_data;
+
+	if( events->number_of_events >= 16 )
+	{
+		return( -1 );
+	}
+	event = &( events->events[ events->number_of_events ] );
+
+	event->event_type               = event_type;
+	event->event_index              = event_index;
+	event->file_offset              = file_offset;
+	event->size                     = size;
+	event->relative_virtual_address = relative_virtual_address;
+
+	events->number_of_events += 1;
+
+	if( events->number_of_events == events->maximum_number_of_events )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Compares the events against the expected events of the test fixture
+ * Returns 1 if the events match or 0 if not
+ */
+int exe_test_parser_check_events(
+     exe_test_events_t *events )
+{
+	exe_test_event_t *event          = NULL;
+	exe_test_event_t *expected_event = NULL;
+	int event_index                  = 0;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 events->number_of_events,
+	 10 );
+
+	for( event_index = 0;
+	     event_index < 10;
+	     event_index++ )
+	{
+		event          = &( events->events[ event_index ] );
+		expected_event = &( exe_test_parser_expected_events[ event_index ] );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "event_type",
+		 event->event_type,
+		 expected_event->event_type );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "event_index",
+		 event->event_index,
+		 expected_event->event_index );
+
+		EXE_TEST_ASSERT_EQUAL_UINT64(
+		 "file_offset",
+		 (uint64_t) event->file_offset,
+		 (uint64_t) expected_event->file_offset );
+
+		EXE_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 (uint64_t) event->size,
+		 (uint64_t) expected_event->size );
+
+		EXE_TEST_ASSERT_EQUAL_UINT32(
+		 "relative_virtual_address",
+		 event->relative_virtual_address,
+		 expected_event->relative_virtual_address );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libexe_parser_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_parser_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libexe_parser_t *parser  = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "parser",
+	 parser );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "parser",
+	 parser );
+
+	/* Test error cases
+	 */
+	result = libexe_parser_initialize(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parser = (libexe_parser_t *) 0x12345678UL;
+
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	parser = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libexe_parser_free(
+		 &parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_parser_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_parser_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_parser_free(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_parser_get_required_range function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_parser_get_required_range(
+     void )
+{
+	exe_test_events_t events;
+	libcerror_error_t *error = NULL;
+	libexe_parser_t *parser  = NULL;
+	off64_t offset           = 0;
+	size_t size              = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     &events,
+	     0,
+	     sizeof( exe_test_events_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initially the MZ header is required
+	 */
+	result = libexe_parser_get_required_range(
+	           parser,
+	           &offset,
+	           &size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "offset",
+	 (uint64_t) offset,
+	 (uint64_t) 0 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 176 );
+
+	result = libexe_parser_feed(
+	           parser,
+	           exe_test_fixture_data,
+	           64,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The size excludes the data that was already fed
+	 */
+	result = libexe_parser_get_required_range(
+	           parser,
+	           &offset,
+	           &size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "offset",
+	 (uint64_t) offset,
+	 (uint64_t) 64 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 112 );
+
+	/* Test error cases
+	 */
+	result = libexe_parser_get_required_range(
+	           NULL,
+	           &offset,
+	           &size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_get_required_range(
+	           parser,
+	           NULL,
+	           &size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_get_required_range(
+	           parser,
+	           &offset,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libexe_parser_free(
+		 &parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_parser_feed function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_parser_feed(
+     void )
+{
+	exe_test_events_t events;
+	uint8_t data[ 256 ];
+	libcerror_error_t *error          = NULL;
+	libexe_parser_t *parser           = NULL;
+	off64_t offset                    = 0;
+	size_t data_offset                = 0;
+	size_t size                       = 0;
+	uint16_t target_architecture_type = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test feeding the data in chunks of 64 bytes, where parsing finishes
+	 * after the data directories at the end of the section table have been decoded
+	 */
+	if( memory_set(
+	     &events,
+	     0,
+	     sizeof( exe_test_events_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     data_offset < EXE_TEST_FIXTURE_DATA_SIZE;
+	     data_offset += 64 )
+	{
+		result = libexe_parser_feed(
+		          parser,
+		          &( exe_test_fixture_data[ data_offset ] ),
+		          64,
+		          &exe_test_event_callback,
+		          &events,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 448 );
+
+	result = exe_test_parser_check_events(
+	           &events );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libexe_parser_get_required_range(
+	           parser,
+	           &offset,
+	           &size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_parser_get_target_architecture_type(
+	           parser,
+	           &target_architecture_type,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "target_architecture_type",
+	 target_architecture_type,
+	 0x8664 );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test feeding all the data at once
+	 */
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &events,
+	     0,
+	     sizeof( exe_test_events_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_parser_feed(
+	           parser,
+	           exe_test_fixture_data,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_parser_check_events(
+	           &events );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the event callback can stop parsing
+	 */
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &events,
+	     0,
+	     sizeof( exe_test_events_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	events.maximum_number_of_events = 1;
+
+	result = libexe_parser_feed(
+	           parser,
+	           exe_test_fixture_data,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 events.number_of_events,
+	 1 );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &events,
+	     0,
+	     sizeof( exe_test_events_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_parser_feed(
+	           NULL,
+	           exe_test_fixture_data,
+	           64,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_feed(
+	           parser,
+	           NULL,
+	           64,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_feed(
+	           parser,
+	           exe_test_fixture_data,
+	           (size_t) SSIZE_MAX + 1,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if an error of the event callback is passed on
+	 */
+	result = libexe_parser_feed(
+	           parser,
+	           exe_test_fixture_data,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           &exe_test_event_callback,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that does not contain an executable
+	 */
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     data,
+	     0,
+	     256 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_parser_feed(
+	           parser,
+	           data,
+	           256,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libexe_parser_free(
+		 &parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_parser_get_target_architecture_type function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_parser_get_target_architecture_type(
+     void )
+{
+	exe_test_events_t events;
+	libcerror_error_t *error          = NULL;
+	libexe_parser_t *parser           = NULL;
+	uint16_t target_architecture_type = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_parser_initialize(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &events,
+	     0,
+	     sizeof( exe_test_events_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_parser_feed(
+	           parser,
+	           exe_test_fixture_data,
+	           EXE_TEST_FIXTURE_DATA_SIZE,
+	           &exe_test_event_callback,
+	           &events,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_parser_get_target_architecture_type(
+	           parser,
+	           &target_architecture_type,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "target_architecture_type",
+	 target_architecture_type,
+	 0x8664 );
+
+	/* Test error cases
+	 */
+	result = libexe_parser_get_target_architecture_type(
+	           NULL,
+	           &target_architecture_type,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_get_target_architecture_type(
+	           parser,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_parser_free(
+	           &parser,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libexe_parser_free(
+		 &parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EXE_TEST_RUN(
+	 "libexe_parser_initialize",
+	 exe_test_parser_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_parser_free",
+	 exe_test_parser_free );
+
+	EXE_TEST_RUN(
+	 "libexe_parser_get_required_range",
+	 exe_test_parser_get_required_range );
+
+	EXE_TEST_RUN(
+	 "libexe_parser_feed",
+	 exe_test_parser_feed );
+
+	EXE_TEST_RUN(
+	 "libexe_parser_get_target_architecture_type",
+	 exe_test_parser_get_target_architecture_type );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1259 @@
+/*
+ * Library pattern set functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+uint8_t exe_test_pattern_set_pattern1[ 4 ] = {
+	0xde, 0xad, 0xbe, 0xef };
+
+/* A sub rsp, imm8 instruction with a wildcard immediate
+ */
+uint8_t exe_test_pattern_set_pattern2[ 4 ] = {
+	0x48, 0x83, 0xec, 0x00 };
+
+uint8_t exe_test_pattern_set_mask2[ 4 ] = {
+	0xff, 0xff, 0xff, 0x00 };
+
+typedef struct exe_test_matches exe_test_matches_t;
+
+/* The matches passed to the match callback
+ */
+struct exe_test_matches
+{
+	/* The number of matches
+	 */
+	int number_of_matches;
+
+	/* The maximum number of matches, after which the match callback stops the scan
+	 */
+	int maximum_number_of_matches;
+
+	/* The pattern indexes
+	 */
+	int pattern_indexes[ 4 ];
+
+	/* The file offsets
+	 */
+	off64_t file_offsets[ 4 ];
+
+	/* The section indexes
+	 */
+	int section_indexes[ 4 ];
+
+	/* The relative virtual addresses
+	 */
+	uint32_t relative_virtual_addresses[ 4 ];
+};
+
+/* Stores a match passed by the scan
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int exe_test_match_callback(
+     int pattern_index,
+     off64_t file_offset,
+     int section_index,
+     uint32_t relative_virtual_address,
+     void *callback_data )
+{
+	exe_test_matches_t *matches = NULL;
+	int match_index             = 0;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	matches = (exe_test_matches_t *) callback_data;
+
+	if( matches->number_of_matches >= 4 )
+	{
+		return( -1 );
+	}
+	match_index = matches->number_of_matches;
+
+	matches->pattern_indexes[ match_index ]            = pattern_index;
+	matches->file_offsets[ match_index ]               = file_offset;
+	matches->section_indexes[ match_index ]            = section_index;
+	matches->relative_virtual_addresses[ match_index ] = relative_virtual_address;
+
+	matches->number_of_matches += 1;
+
+	if( matches->number_of_matches == matches->maximum_number_of_matches )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Creates a compiled pattern set with the test patterns
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_pattern_set_create(
+     libexe_pattern_set_t **pattern_set,
+     libcerror_error_t **error )
+{
+	int pattern_index = 0;
+
+	if( libexe_pattern_set_initialize(
+	     pattern_set,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libexe_pattern_set_append_pattern(
+	     *pattern_set,
+	     exe_test_pattern_set_pattern1,
+	     NULL,
+	     4,
+	     &pattern_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libexe_pattern_set_append_pattern(
+	     *pattern_set,
+	     exe_test_pattern_set_pattern2,
+	     exe_test_pattern_set_mask2,
+	     4,
+	     &pattern_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libexe_pattern_set_compile(
+	     *pattern_set,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libexe_pattern_set_free(
+	 pattern_set,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libexe_pattern_set_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_pattern_set_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libexe_pattern_set_t *pattern_set = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_pattern_set_initialize(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "pattern_set",
+	 pattern_set );
+
+	result = libexe_pattern_set_free(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "pattern_set",
+	 pattern_set );
+
+	/* Test error cases
+	 */
+	result = libexe_pattern_set_initialize(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pattern_set = (libexe_pattern_set_t *) 0x12345678UL;
+
+	result = libexe_pattern_set_initialize(
+	           &pattern_set,
+	           &error );
+
+	pattern_set = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern_set != NULL )
+	{
+		libexe_pattern_set_free(
+		 &pattern_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_pattern_set_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_pattern_set_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_pattern_set_free(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_pattern_set_append_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_pattern_set_append_pattern(
+     void )
+{
+	uint8_t mask[ 4 ]                 = { 0x00, 0x0f, 0xf0, 0x00 };
+	libcerror_error_t *error          = NULL;
+	libexe_pattern_set_t *pattern_set = NULL;
+	int pattern_index                 = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_pattern_set_initialize(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           exe_test_pattern_set_pattern1,
+	           NULL,
+	           4,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 0 );
+
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           exe_test_pattern_set_pattern2,
+	           exe_test_pattern_set_mask2,
+	           4,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_pattern_set_append_pattern(
+	           NULL,
+	           exe_test_pattern_set_pattern1,
+	           NULL,
+	           4,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           NULL,
+	           NULL,
+	           4,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           exe_test_pattern_set_pattern1,
+	           NULL,
+	           0,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           exe_test_pattern_set_pattern1,
+	           NULL,
+	           4,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a pattern without a byte with a mask of 0xff
+	 */
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           exe_test_pattern_set_pattern2,
+	           mask,
+	           4,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test appending a pattern after the pattern set is compiled
+	 */
+	result = libexe_pattern_set_compile(
+	           pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           exe_test_pattern_set_pattern1,
+	           NULL,
+	           4,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_pattern_set_free(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern_set != NULL )
+	{
+		libexe_pattern_set_free(
+		 &pattern_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_pattern_set_compile function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_pattern_set_compile(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libexe_pattern_set_t *pattern_set = NULL;
+	int pattern_index                 = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_pattern_set_initialize(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_pattern_set_append_pattern(
+	           pattern_set,
+	           exe_test_pattern_set_pattern1,
+	           NULL,
+	           4,
+	           &pattern_index,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_pattern_set_compile(
+	           pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_pattern_set_free(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_pattern_set_compile(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern_set != NULL )
+	{
+		libexe_pattern_set_free(
+		 &pattern_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_scan(
+     libexe_file_t *file )
+{
+	exe_test_matches_t matches;
+	libcerror_error_t *error          = NULL;
+	libexe_pattern_set_t *pattern_set = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = exe_test_pattern_set_create(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &matches,
+	     0,
+	     sizeof( exe_test_matches_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_scan(
+	           file,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 matches.number_of_matches,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_indexes[ 0 ]",
+	 matches.pattern_indexes[ 0 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 0 ]",
+	 (uint64_t) matches.file_offsets[ 0 ],
+	 (uint64_t) 0x00000200UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_indexes[ 0 ]",
+	 matches.section_indexes[ 0 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 0 ]",
+	 matches.relative_virtual_addresses[ 0 ],
+	 (uint32_t) 0x00001000UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_indexes[ 1 ]",
+	 matches.pattern_indexes[ 1 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 1 ]",
+	 (uint64_t) matches.file_offsets[ 1 ],
+	 (uint64_t) 0x00000246UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_indexes[ 1 ]",
+	 matches.section_indexes[ 1 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 1 ]",
+	 matches.relative_virtual_addresses[ 1 ],
+	 (uint32_t) 0x00001046UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_indexes[ 2 ]",
+	 matches.pattern_indexes[ 2 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 2 ]",
+	 (uint64_t) matches.file_offsets[ 2 ],
+	 (uint64_t) 0x000002c0UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_indexes[ 2 ]",
+	 matches.section_indexes[ 2 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 2 ]",
+	 matches.relative_virtual_addresses[ 2 ],
+	 (uint32_t) 0x000010c0UL );
+
+	/* Test if the match callback can stop the scan
+	 */
+	if( memory_set(
+	     &matches,
+	     0,
+	     sizeof( exe_test_matches_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	matches.maximum_number_of_matches = 1;
+
+	result = libexe_file_scan(
+	           file,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 matches.number_of_matches,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_scan(
+	           NULL,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_scan(
+	           file,
+	           NULL,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_scan(
+	           file,
+	           pattern_set,
+	           NULL,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if an error of the match callback is passed on
+	 */
+	result = libexe_file_scan(
+	           file,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_pattern_set_free(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern_set != NULL )
+	{
+		libexe_pattern_set_free(
+		 &pattern_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_scan_section function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_scan_section(
+     libexe_file_t *file )
+{
+	exe_test_matches_t matches;
+	libcerror_error_t *error          = NULL;
+	libexe_pattern_set_t *pattern_set = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = exe_test_pattern_set_create(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     &matches,
+	     0,
+	     sizeof( exe_test_matches_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_scan_section(
+	           file,
+	           0,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 matches.number_of_matches,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_indexes[ 0 ]",
+	 matches.pattern_indexes[ 0 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 0 ]",
+	 (uint64_t) matches.file_offsets[ 0 ],
+	 (uint64_t) 0x00000200UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_indexes[ 0 ]",
+	 matches.section_indexes[ 0 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 0 ]",
+	 matches.relative_virtual_addresses[ 0 ],
+	 (uint32_t) 0x00001000UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_indexes[ 1 ]",
+	 matches.pattern_indexes[ 1 ],
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 1 ]",
+	 (uint64_t) matches.file_offsets[ 1 ],
+	 (uint64_t) 0x00000246UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_indexes[ 1 ]",
+	 matches.section_indexes[ 1 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 1 ]",
+	 matches.relative_virtual_addresses[ 1 ],
+	 (uint32_t) 0x00001046UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pattern_indexes[ 2 ]",
+	 matches.pattern_indexes[ 2 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 2 ]",
+	 (uint64_t) matches.file_offsets[ 2 ],
+	 (uint64_t) 0x000002c0UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_indexes[ 2 ]",
+	 matches.section_indexes[ 2 ],
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 2 ]",
+	 matches.relative_virtual_addresses[ 2 ],
+	 (uint32_t) 0x000010c0UL );
+
+	if( memory_set(
+	     &matches,
+	     0,
+	     sizeof( exe_test_matches_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_scan_section(
+	           file,
+	           2,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 matches.number_of_matches,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_scan_section(
+	           NULL,
+	           0,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_scan_section(
+	           file,
+	           -1,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_scan_section(
+	           file,
+	           3,
+	           pattern_set,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_scan_section(
+	           file,
+	           0,
+	           NULL,
+	           &exe_test_match_callback,
+	           &matches,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_pattern_set_free(
+	           &pattern_set,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern_set != NULL )
+	{
+		libexe_pattern_set_free(
+		 &pattern_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN(
+	 "libexe_pattern_set_initialize",
+	 exe_test_pattern_set_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_pattern_set_free",
+	 exe_test_pattern_set_free );
+
+	EXE_TEST_RUN(
+	 "libexe_pattern_set_append_pattern",
+	 exe_test_pattern_set_append_pattern );
+
+	EXE_TEST_RUN(
+	 "libexe_pattern_set_compile",
+	 exe_test_pattern_set_compile );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_scan",
+	 exe_test_file_scan,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_scan_section",
+	 exe_test_file_scan_section,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,662 @@
+/*
+ * Library string extraction functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+typedef struct exe_test_strings exe_test_strings_t;
+
+/* The strings passed to the string callback
+ */
+struct exe_test_strings
+{
+	/* The number of strings
+	 */
+	int number_of_strings;
+
+	/* The maximum number of strings, after which the string callback stops the extraction
+	 */
+	int maximum_number_of_strings;
+
+	/* The string types
+	 */
+	uint8_t string_types[ 4 ];
+
+	/* The strings
+	 */
+	uint8_t strings[ 4 ][ 32 ];
+
+	/* The string lengths
+	 */
+	size_t string_lengths[ 4 ];
+
+	/* The file offsets
+	 */
+	off64_t file_offsets[ 4 ];
+
+	/* The relative virtual addresses
+	 */
+	uint32_t relative_virtual_addresses[ 4 ];
+};
+
+/* Stores a string passed by the string extraction
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int exe_test_string_callback(
+     uint8_t string_type,
+     const uint8_t *string,
+     size_t string_length,
+     off64_t file_offset,
+     uint32_t relative_virtual_address,
+     void *callback_data )
+{
+	exe_test_strings_t *strings = NULL;
+	int string_index            = 0;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	strings = (exe_test_strings_t *) callback_data;
+
+	if( strings->number_of_strings >= 4 )
+	{
+		return( -1 );
+	}
+	string_index = strings->number_of_strings;
+
+	strings->string_types[ string_index ]               = string_type;
+	strings->string_lengths[ string_index ]             = string_length;
+	strings->file_offsets[ string_index ]               = file_offset;
+	strings->relative_virtual_addresses[ string_index ] = relative_virtual_address;
+
+	if( string_length > 32 )
+	{
+		string_length = 32;
+	}
+	if( memory_copy(
+	     strings->strings[ string_index ],
+	     string,
+	     string_length ) == NULL )
+	{
+		return( -1 );
+	}
+	strings->number_of_strings += 1;
+
+	if( strings->number_of_strings == strings->maximum_number_of_strings )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libexe_file_extract_section_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_extract_section_strings(
+     libexe_file_t *file )
+{
+	exe_test_strings_t strings;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     &strings,
+	     0,
+	     sizeof( exe_test_strings_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_extract_section_strings(
+	           file,
+	           0,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 strings.number_of_strings,
+	 2 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "string_types[ 0 ]",
+	 strings.string_types[ 0 ],
+	 LIBEXE_STRING_TYPE_ASCII );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_lengths[ 0 ]",
+	 strings.string_lengths[ 0 ],
+	 (size_t) 19 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 0 ]",
+	 (uint64_t) strings.file_offsets[ 0 ],
+	 (uint64_t) 0x00000280UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 0 ]",
+	 strings.relative_virtual_addresses[ 0 ],
+	 (uint32_t) 0x00001080UL );
+
+	result = memory_compare(
+	           strings.strings[ 0 ],
+	           "libexe test fixture",
+	           19 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "string_types[ 1 ]",
+	 strings.string_types[ 1 ],
+	 LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_lengths[ 1 ]",
+	 strings.string_lengths[ 1 ],
+	 (size_t) 13 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 1 ]",
+	 (uint64_t) strings.file_offsets[ 1 ],
+	 (uint64_t) 0x000002a0UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 1 ]",
+	 strings.relative_virtual_addresses[ 1 ],
+	 (uint32_t) 0x000010a0UL );
+
+	result = memory_compare(
+	           strings.strings[ 1 ],
+	           "UTF-16 string",
+	           13 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with only ASCII strings
+	 */
+	if( memory_set(
+	     &strings,
+	     0,
+	     sizeof( exe_test_strings_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_extract_section_strings(
+	           file,
+	           0,
+	           LIBEXE_STRING_TYPE_ASCII,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 strings.number_of_strings,
+	 1 );
+
+	/* Test with a minimum length that exceeds the length of the strings
+	 */
+	if( memory_set(
+	     &strings,
+	     0,
+	     sizeof( exe_test_strings_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_extract_section_strings(
+	           file,
+	           0,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           20,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 strings.number_of_strings,
+	 0 );
+
+	/* Test if the string callback can stop the extraction
+	 */
+	if( memory_set(
+	     &strings,
+	     0,
+	     sizeof( exe_test_strings_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	strings.maximum_number_of_strings = 1;
+
+	result = libexe_file_extract_section_strings(
+	           file,
+	           0,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 strings.number_of_strings,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_extract_section_strings(
+	           NULL,
+	           0,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_extract_section_strings(
+	           file,
+	           -1,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_extract_section_strings(
+	           file,
+	           3,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_extract_section_strings(
+	           file,
+	           0,
+	           0,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_extract_section_strings(
+	           file,
+	           0,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           NULL,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if an error of the string callback is passed on
+	 */
+	result = libexe_file_extract_section_strings(
+	           file,
+	           0,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_extract_overlay_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_extract_overlay_strings(
+     libexe_file_t *file )
+{
+	exe_test_strings_t strings;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     &strings,
+	     0,
+	     sizeof( exe_test_strings_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libexe_file_extract_overlay_strings(
+	           file,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 strings.number_of_strings,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_lengths[ 0 ]",
+	 strings.string_lengths[ 0 ],
+	 (size_t) 24 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "file_offsets[ 0 ]",
+	 (uint64_t) strings.file_offsets[ 0 ],
+	 (uint64_t) 0x00000808UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_addresses[ 0 ]",
+	 strings.relative_virtual_addresses[ 0 ],
+	 0 );
+
+	result = memory_compare(
+	           strings.strings[ 0 ],
+	           "0123456789:;<=>?@ABCDEFG",
+	           24 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_extract_overlay_strings(
+	           NULL,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           &exe_test_string_callback,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_extract_overlay_strings(
+	           file,
+	           LIBEXE_STRING_TYPE_ASCII | LIBEXE_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	           6,
+	           NULL,
+	           &strings,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_extract_section_strings",
+	 exe_test_file_extract_section_strings,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_extract_overlay_strings",
+	 exe_test_file_extract_overlay_strings,
+	 file );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
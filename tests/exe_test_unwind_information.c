@@ -0,0 +1,1384 @@
+/*
+ * Library unwind information functions test program
+ *
+ * Copyright (C) 2011-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_unused.h"
+
+/* Retrieves the unwind information of a specific function of the test fixture
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_get_unwind_information(
+     libexe_file_t *file,
+     int function_index,
+     libexe_unwind_information_t **unwind_information )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libexe_file_get_function_unwind_information(
+	           file,
+	           function_index,
+	           unwind_information,
+	           &error );
+
+	if( result != 1 )
+	{
+		if( error != NULL )
+		{
+			libcerror_error_backtrace_fprint(
+			 error,
+			 stderr );
+			libcerror_error_free(
+			 &error );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libexe_file_get_function_unwind_information function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_function_unwind_information(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error                        = NULL;
+	libexe_unwind_information_t *unwind_information = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_function_unwind_information(
+	           file,
+	           0,
+	           &unwind_information,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "unwind_information",
+	 unwind_information );
+
+	result = libexe_unwind_information_free(
+	           &unwind_information,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "unwind_information",
+	 unwind_information );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_function_unwind_information(
+	           NULL,
+	           0,
+	           &unwind_information,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_function_unwind_information(
+	           file,
+	           3,
+	           &unwind_information,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_function_unwind_information(
+	           file,
+	           0,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_read_unwind_information function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_read_unwind_information(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_read_unwind_information(
+	           file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_read_unwind_information(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_free(
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_version function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_version(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t version          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_version(
+	           unwind_information,
+	           &version,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "version",
+	 version,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_version(
+	           NULL,
+	           &version,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_version(
+	           unwind_information,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_flags(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t flags            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_flags(
+	           unwind_information,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 LIBEXE_UNWIND_INFORMATION_FLAG_EXCEPTION_HANDLER );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_flags(
+	           NULL,
+	           &flags,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_flags(
+	           unwind_information,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_prolog_size function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_prolog_size(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t prolog_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_prolog_size(
+	           unwind_information,
+	           &prolog_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "prolog_size",
+	 prolog_size,
+	 9 );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_prolog_size(
+	           NULL,
+	           &prolog_size,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_prolog_size(
+	           unwind_information,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_frame_register function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_frame_register(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t frame_offset    = 0;
+	uint8_t frame_register   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_frame_register(
+	           unwind_information,
+	           &frame_register,
+	           &frame_offset,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "frame_register",
+	 frame_register,
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "frame_offset",
+	 frame_offset,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_frame_register(
+	           NULL,
+	           &frame_register,
+	           &frame_offset,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_frame_register(
+	           unwind_information,
+	           NULL,
+	           &frame_offset,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_frame_register(
+	           unwind_information,
+	           &frame_register,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_number_of_unwind_codes function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_number_of_unwind_codes(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error   = NULL;
+	int number_of_unwind_codes = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_number_of_unwind_codes(
+	           unwind_information,
+	           &number_of_unwind_codes,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_unwind_codes",
+	 number_of_unwind_codes,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_number_of_unwind_codes(
+	           NULL,
+	           &number_of_unwind_codes,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_number_of_unwind_codes(
+	           unwind_information,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_number_of_operations function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_number_of_operations(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_operations = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_number_of_operations(
+	           unwind_information,
+	           &number_of_operations,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_operations",
+	 number_of_operations,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_number_of_operations(
+	           NULL,
+	           &number_of_operations,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_number_of_operations(
+	           unwind_information,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_operation function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_operation(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error      = NULL;
+	uint32_t operand              = 0;
+	uint8_t code_offset           = 0;
+	uint8_t operation_code        = 0;
+	uint8_t operation_information = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_operation(
+	           unwind_information,
+	           0,
+	           &code_offset,
+	           &operation_code,
+	           &operation_information,
+	           &operand,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "code_offset",
+	 code_offset,
+	 9 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "operation_code",
+	 operation_code,
+	 LIBEXE_UNWIND_OPERATION_CODE_ALLOCATE_LARGE );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "operand",
+	 operand,
+	 256 );
+
+	result = libexe_unwind_information_get_operation(
+	           unwind_information,
+	           1,
+	           &code_offset,
+	           &operation_code,
+	           &operation_information,
+	           &operand,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "code_offset",
+	 code_offset,
+	 2 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "operation_code",
+	 operation_code,
+	 LIBEXE_UNWIND_OPERATION_CODE_PUSH_NON_VOLATILE );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "operation_information",
+	 operation_information,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_operation(
+	           NULL,
+	           0,
+	           &code_offset,
+	           &operation_code,
+	           &operation_information,
+	           &operand,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_operation(
+	           unwind_information,
+	           -1,
+	           &code_offset,
+	           &operation_code,
+	           &operation_information,
+	           &operand,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_operation(
+	           unwind_information,
+	           2,
+	           &code_offset,
+	           &operation_code,
+	           &operation_information,
+	           &operand,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_operation(
+	           unwind_information,
+	           0,
+	           &code_offset,
+	           &operation_code,
+	           &operation_information,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_exception_handler_address function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_exception_handler_address(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error           = NULL;
+	uint32_t exception_handler_address = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_exception_handler_address(
+	           unwind_information,
+	           &exception_handler_address,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "exception_handler_address",
+	 exception_handler_address,
+	 (uint32_t) 0x00001060UL );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_exception_handler_address(
+	           NULL,
+	           &exception_handler_address,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_exception_handler_address(
+	           unwind_information,
+	           NULL,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_unwind_information_get_chained_function function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_get_chained_function(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error            = NULL;
+	uint32_t begin_address              = 0;
+	uint32_t end_address                = 0;
+	uint32_t unwind_information_address = 0;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_chained_function(
+	           unwind_information,
+	           &begin_address,
+	           &end_address,
+	           &unwind_information_address,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_unwind_information_get_chained_function(
+	           NULL,
+	           &begin_address,
+	           &end_address,
+	           &unwind_information_address,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_unwind_information_get_chained_function(
+	           unwind_information,
+	           NULL,
+	           &end_address,
+	           &unwind_information_address,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the unwind information of a function without exception handler
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_unwind_information_without_handler(
+     libexe_unwind_information_t *unwind_information )
+{
+	libcerror_error_t *error           = NULL;
+	uint32_t exception_handler_address = 0;
+	uint32_t operand                   = 0;
+	uint8_t code_offset                = 0;
+	uint8_t operation_code             = 0;
+	uint8_t operation_information      = 0;
+	int number_of_operations           = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_unwind_information_get_number_of_operations(
+	           unwind_information,
+	           &number_of_operations,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_operations",
+	 number_of_operations,
+	 3 );
+
+	result = libexe_unwind_information_get_operation(
+	           unwind_information,
+	           2,
+	           &code_offset,
+	           &operation_code,
+	           &operation_information,
+	           &operand,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "code_offset",
+	 code_offset,
+	 5 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "operation_code",
+	 operation_code,
+	 LIBEXE_UNWIND_OPERATION_CODE_SAVE_NON_VOLATILE );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "operation_information",
+	 operation_information,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "operand",
+	 operand,
+	 48 );
+
+	result = libexe_unwind_information_get_exception_handler_address(
+	           unwind_information,
+	           &exception_handler_address,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error                        = NULL;
+	libexe_file_t *file                             = NULL;
+	libexe_unwind_information_t *unwind_information = NULL;
+	int result                                      = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	result = exe_test_open_fixture(
+	           &file,
+	           LIBEXE_OPEN_READ,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_RUN(
+	 "libexe_unwind_information_free",
+	 exe_test_unwind_information_free );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_get_function_unwind_information",
+	 exe_test_file_get_function_unwind_information,
+	 file );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_file_read_unwind_information",
+	 exe_test_file_read_unwind_information,
+	 file );
+
+	result = exe_test_get_unwind_information(
+	           file,
+	           1,
+	           &unwind_information );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_version",
+	 exe_test_unwind_information_get_version,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_flags",
+	 exe_test_unwind_information_get_flags,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_prolog_size",
+	 exe_test_unwind_information_get_prolog_size,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_frame_register",
+	 exe_test_unwind_information_get_frame_register,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_number_of_unwind_codes",
+	 exe_test_unwind_information_get_number_of_unwind_codes,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_number_of_operations",
+	 exe_test_unwind_information_get_number_of_operations,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_operation",
+	 exe_test_unwind_information_get_operation,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_exception_handler_address",
+	 exe_test_unwind_information_get_exception_handler_address,
+	 unwind_information );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_chained_function",
+	 exe_test_unwind_information_get_chained_function,
+	 unwind_information );
+
+	result = libexe_unwind_information_free(
+	           &unwind_information,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = exe_test_get_unwind_information(
+	           file,
+	           2,
+	           &unwind_information );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_unwind_information_get_operation",
+	 exe_test_unwind_information_without_handler,
+	 unwind_information );
+
+	result = libexe_unwind_information_free(
+	           &unwind_information,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = exe_test_close_fixture(
+	           &file,
+	           &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( unwind_information != NULL )
+	{
+		libexe_unwind_information_free(
+		 &unwind_information,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		exe_test_close_fixture(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -11,7 +11,7 @@ TEST_PREFIX=`dirname ${PWD}`;
 TEST_PREFIX=`basename ${TEST_PREFIX} | sed 's/^lib\([^-]*\).*$/\1/'`;
 
 TEST_PROFILE="lib${TEST_PREFIX}";
-TEST_FUNCTIONS="get_version";
+TEST_FUNCTIONS="access_pattern authenticode batch block_cache carver certificate_table checksum digest direct_io exception_table fuzzy_hash get_version histogram load_configuration memory_image merkle_tree open_at_offset open_buffer open_stream page_hashes parser pattern_set read_plan string_extractor tls_directory unwind_information";
 TEST_FUNCTIONS_WITH_INPUT="open_close seek read";
 OPTION_SETS="";
 